@@ -136,6 +136,25 @@ namespace geom {
         const int polygon_vertex_count,
         const int polygon_plane_normal_largest_component);
 
+    // Triangulate a (simple) polygon by ear clipping. Each triangle is appended to "triangle_indices"
+    // as three indices into "polygon_vertices", with the same winding order as the polygon.
+    // NOTE: a polygon with 'n' vertices always yields 'n-2' triangles. If no ear can be found (i.e.
+    // the polygon is degenerate) then a vertex is clipped regardless.
+    void triangulate_polygon(
+        std::vector<int>& triangle_indices,
+        const math::vec3* polygon_vertices,
+        const int polygon_vertex_count);
+
+    // Test if two polygons intersect, i.e. an edge of one polygon passes through the area of the
+    // other polygon. Contacts (e.g. a vertex that lies on the other polygon) also count as intersections.
+    // NOTE: like the kernel, this only considers edges that reach the area of the other polygon, so two
+    // coplanar polygons which overlap without a vertex inside the other polygon are not detected.
+    bool compute_polygon_intersection_test(
+        const math::vec3* polygon_a_vertices,
+        const int polygon_a_vertex_count,
+        const math::vec3* polygon_b_vertices,
+        const int polygon_b_vertex_count);
+
     bool collinear(const math::vec2& a, const math::vec2& b, const math::vec2& c, math::real_number_t& predResult);
 
     bool collinear(const math::vec2& a, const math::vec2& b, const math::vec2& c);
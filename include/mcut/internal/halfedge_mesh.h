@@ -27,19 +27,25 @@
 #include "mcut/internal/utils.h"
 
 #include <algorithm>
+#include <cstdint>
+#include <functional> // std::hash
+#include <iterator>
 #include <limits>
 #include <map>
 #include <memory> // shared_ptr
+#include <type_traits>
 #include <vector>
 
 namespace mcut {
 
+// NOTE: descriptors are plain (trivially copyable) 4-byte indices i.e. there is no
+// vtable. They are stored in bulk throughout the kernel (vectors, maps etc.), so
+// keep them free of virtual functions and additional data members.
 template <typename T>
 class descriptor_t_ {
 public:
     typedef unsigned int index_type;
-    descriptor_t_() { }
-    virtual ~descriptor_t_() { }
+
     explicit descriptor_t_(index_type i = (std::numeric_limits<index_type>::max)())
         : m_value(i)
     {
@@ -61,12 +67,6 @@ public:
         return *this;
     }
 
-    descriptor_t_& operator=(const T& _rhs) const
-    {
-        m_value = _rhs.m_value;
-        return *this;
-    }
-
     bool operator==(const T& _rhs) const
     {
         return m_value == _rhs.m_value;
@@ -129,10 +129,6 @@ public:
         : descriptor_t_<halfedge_descriptor_t>(idx)
     {
     }
-
-    virtual ~halfedge_descriptor_t()
-    {
-    }
 };
 
 class edge_descriptor_t : public descriptor_t_<edge_descriptor_t> {
@@ -146,10 +142,6 @@ public:
         : descriptor_t_<edge_descriptor_t>(idx)
     {
     }
-
-    virtual ~edge_descriptor_t()
-    {
-    }
 };
 
 class face_descriptor_t : public descriptor_t_<face_descriptor_t> {
@@ -163,10 +155,6 @@ public:
         : descriptor_t_<face_descriptor_t>(idx)
     {
     }
-
-    virtual ~face_descriptor_t()
-    {
-    }
 };
 
 class vertex_descriptor_t : public descriptor_t_<vertex_descriptor_t> {
@@ -180,9 +168,23 @@ public:
         : descriptor_t_<vertex_descriptor_t>(idx)
     {
     }
+};
 
-    virtual ~vertex_descriptor_t()
+static_assert(sizeof(halfedge_descriptor_t) == sizeof(unsigned int), "descriptor must be a plain 4-byte index");
+static_assert(sizeof(edge_descriptor_t) == sizeof(unsigned int), "descriptor must be a plain 4-byte index");
+static_assert(sizeof(face_descriptor_t) == sizeof(unsigned int), "descriptor must be a plain 4-byte index");
+static_assert(sizeof(vertex_descriptor_t) == sizeof(unsigned int), "descriptor must be a plain 4-byte index");
+static_assert(std::is_trivially_copyable<halfedge_descriptor_t>::value && std::is_standard_layout<halfedge_descriptor_t>::value, "descriptor must be trivially copyable and standard-layout");
+static_assert(std::is_trivially_copyable<edge_descriptor_t>::value && std::is_standard_layout<edge_descriptor_t>::value, "descriptor must be trivially copyable and standard-layout");
+static_assert(std::is_trivially_copyable<face_descriptor_t>::value && std::is_standard_layout<face_descriptor_t>::value, "descriptor must be trivially copyable and standard-layout");
+static_assert(std::is_trivially_copyable<vertex_descriptor_t>::value && std::is_standard_layout<vertex_descriptor_t>::value, "descriptor must be trivially copyable and standard-layout");
+
+// hash function for descriptors (e.g. for use as keys in std::unordered_map)
+template <typename D>
+struct descriptor_hasher_t {
+    std::size_t operator()(const D& d) const
     {
+        return std::hash<typename D::index_type>()(static_cast<typename D::index_type>(d));
     }
 };
 
@@ -238,108 +240,79 @@ public:
     };
 
     struct vertex_data_t {
-        mcut::math::vec3 p; // geometry coordinates
         std::vector<face_descriptor_t> m_faces; // ... incident to vertex
         std::vector<halfedge_descriptor_t> m_halfedges; // ... which point to vertex (note: can be used to infer edges too)
     };
 
-    typedef std::map<vertex_descriptor_t, vertex_data_t> vertex_map_t;
-    typedef std::map<edge_descriptor_t, edge_data_t> edge_map_t;
-    typedef std::map<halfedge_descriptor_t, halfedge_data_t> halfedge_map_t;
-    typedef std::map<face_descriptor_t, face_data_t> face_map_t;
-
-    // iterator over the keys of a map (base class)
-    template <typename M>
-    class key_iterator_t : public M::const_iterator {
-        const mesh_t* const mesh_ptr;
+    // iterator over the descriptors of a given mesh element type (e.g. faces).
+    // Descriptors are indices into the (dense) element arrays of the mesh, so
+    // iterating is simply a matter of walking the index range and skipping the
+    // slots that are marked as removed.
+    template <typename D>
+    class key_iterator_t {
+        D m_descr;
+        const mesh_t* mesh_ptr;
 
     public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef D value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const D* pointer;
+        typedef const D& reference;
+
         key_iterator_t()
-            : M::const_iterator()
+            : m_descr()
             , mesh_ptr(nullptr) {};
-        explicit key_iterator_t(typename M::const_iterator it_, const mesh_t* const mesh)
-            : M::const_iterator(it_)
+        explicit key_iterator_t(const D& descr, const mesh_t* const mesh)
+            : m_descr(descr)
             , mesh_ptr(mesh)
         {
         }
 
-        typename M::key_type* operator->()
+        const D* operator->() const
         {
-            return (typename M::key_type* const)&(M::const_iterator::operator->()->first);
+            return &m_descr;
         }
 
-        typename M::key_type& operator*()
+        const D& operator*() const
         {
-            return *this->operator->();
+            return m_descr;
         }
 
         // postfix increment (i++)
         // increment pointer to the next valid element (i.e. we skip removed elements).
-        typename M::key_type operator++(int)
+        D operator++(int)
         {
-            bool old_elem_is_removed = false;
-
-            do {
-                typename M::const_iterator old_elem = M::const_iterator::operator++(0); // (i++)
-                old_elem_is_removed = mesh_ptr->is_removed(old_elem->first);
-                if (!old_elem_is_removed) {
-                    return old_elem->first;
-                }
-
-                // keep iterating until the value returned by the (i++) operator returns a valid element
-                // i.e. one that is not marked removed!
-            } while ((*this) != cend<std::remove_reference<decltype(*this)>::type>() && old_elem_is_removed);
-
-            return M::key_type();
+            const D old_descr = m_descr;
+            ++(*this);
+            return old_descr;
         }
 
         // prefix increment (++i)
         // increment pointer to the next valid element (i.e. we skip removed elements).
-        typename M::key_type& operator++()
+        const D& operator++()
         {
-            bool cur_elem_is_removed = false;
-            bool reached_end = false;
+            const typename D::index_type end = (typename D::index_type)number_of_slots(identity<D>());
             do {
-                M::const_iterator::operator++(); // (++i)
-                reached_end = (*this) == cend<typename std::remove_reference<decltype(*this)>::type>();
-                cur_elem_is_removed = false;
+                ++m_descr;
+            } while ((typename D::index_type)m_descr < end && mesh_ptr->is_removed(m_descr));
 
-                if (!reached_end) {
-                    cur_elem_is_removed = mesh_ptr->is_removed(this->operator*());
-                    if (!cur_elem_is_removed) {
-                        break;
-                    }
-                }
-
-                // keep iterating until the value pointed to after the (++i) operator is a valid element
-                // i.e. one that is not marked removed!
-
-            } while (cur_elem_is_removed);
-            static typename M::key_type garbage;
-
-            return !reached_end ? this->operator*() : garbage;
+            return m_descr;
         }
 
-        // The following are helper functions which are specialised (via type-deduction)
-        // for the type of mesh elements that *this* iterator walks over in "mesh_ptr"
-        // e.g. faces. These functions are used to determine when *this* iterator has
-        // reached the end of the respective std::map data structure over which we are
-        // iterating.
-
-        template <typename T>
-        struct identity {
-            typedef T type;
-        };
+        bool operator==(const key_iterator_t<D>& other) const
+        {
+            return m_descr == other.m_descr;
+        }
 
-        template <typename I>
-        I cend()
+        bool operator!=(const key_iterator_t<D>& other) const
         {
-            return cend(identity<I>()); // https://stackoverflow.com/questions/3052579/explicit-specialization-in-non-namespace-scope
+            return m_descr != other.m_descr;
         }
 
-        static std::ptrdiff_t distance(const key_iterator_t<M>& beg, const key_iterator_t<M>& end)
+        static std::ptrdiff_t distance(const key_iterator_t<D>& beg, const key_iterator_t<D>& end)
         {
-            key_iterator_t<M> it = beg;
+            key_iterator_t<D> it = beg;
             typename std::ptrdiff_t dist = 0;
             while (it != end) {
                 dist++;
@@ -349,37 +322,41 @@ public:
         }
 
     private:
-        template <typename I>
-        I cend(identity<I>)
-        {
-            return I(); // unused
-        }
+        // The following are helper functions which are specialised (via type-deduction)
+        // for the type of mesh elements that *this* iterator walks over in "mesh_ptr"
+        // e.g. faces. These functions are used to determine when *this* iterator has
+        // reached the end of the respective array over which we are iterating.
+
+        template <typename T>
+        struct identity {
+            typedef T type;
+        };
 
-        key_iterator_t<face_map_t> cend(identity<key_iterator_t<face_map_t>>)
+        int number_of_slots(identity<face_descriptor_t>) const
         {
-            return mesh_ptr->faces_end();
+            return mesh_ptr->number_of_internal_faces();
         }
 
-        key_iterator_t<edge_map_t> cend(identity<key_iterator_t<edge_map_t>>)
+        int number_of_slots(identity<edge_descriptor_t>) const
         {
-            return mesh_ptr->edges_end();
+            return mesh_ptr->number_of_internal_edges();
         }
 
-        key_iterator_t<halfedge_map_t> cend(identity<key_iterator_t<halfedge_map_t>>)
+        int number_of_slots(identity<halfedge_descriptor_t>) const
         {
-            return mesh_ptr->halfedges_end();
+            return mesh_ptr->number_of_internal_halfedges();
         }
 
-        key_iterator_t<vertex_map_t> cend(identity<key_iterator_t<vertex_map_t>>)
+        int number_of_slots(identity<vertex_descriptor_t>) const
         {
-            return mesh_ptr->vertices_end();
+            return mesh_ptr->number_of_internal_vertices();
         }
     };
 
-    typedef key_iterator_t<vertex_map_t> vertex_iterator_t;
-    typedef key_iterator_t<edge_map_t> edge_iterator_t;
-    typedef key_iterator_t<halfedge_map_t> halfedge_iterator_t;
-    typedef key_iterator_t<face_map_t> face_iterator_t;
+    typedef key_iterator_t<vertex_descriptor_t> vertex_iterator_t;
+    typedef key_iterator_t<edge_descriptor_t> edge_iterator_t;
+    typedef key_iterator_t<halfedge_descriptor_t> halfedge_iterator_t;
+    typedef key_iterator_t<face_descriptor_t> face_iterator_t;
 
     mesh_t();
     ~mesh_t();
@@ -457,20 +434,45 @@ public:
 
     face_descriptor_t add_face(const std::vector<vertex_descriptor_t>& vi);
 
+    // builds the mesh in one pass from a polygon soup given as index arrays, where the mesh
+    // must be empty. "face_indices" holds the vertex indices of all faces (stored consecutively)
+    // and "face_sizes" holds the number of vertices of each face. The faces must be valid
+    // polygons (i.e. at least 3 distinct and in-range vertex indices).
+    // Returns false (leaving the mesh empty) if the faces do not define a manifold i.e. an
+    // edge is shared by more than two faces or by two faces with the same orientation. Such
+    // edges are written to "non_manifold_edges" (if provided).
+    // NOTE: the resulting descriptors are the same as those produced by calling "add_vertex"
+    // and then "add_face" for each element in order.
+    bool build_from_arrays(
+        const std::vector<math::vec3>& vertices,
+        const uint32_t* face_indices,
+        const uint32_t* face_sizes,
+        const uint32_t num_faces,
+        std::vector<std::pair<vertex_descriptor_t, vertex_descriptor_t>>* non_manifold_edges = nullptr);
+
+    // appends the elements of "other" to this mesh (as a disjoint part), where the
+    // descriptors of the appended elements are those of "other" offset by the number
+    // of (internal) elements of the same type that this mesh had before the call.
+    // Removed element slots of "other" are appended as removed slots.
+    // NOTE: when neither mesh has removed elements, the resulting descriptors are the
+    // same as those produced by calling "add_vertex" and then "add_face" for each
+    // element of "other" in order.
+    void append(const mesh_t& other);
+
     // also disassociates (not remove) any halfedges(s) and vertices incident to face
     void remove_face(const face_descriptor_t f)
     {
         MCUT_ASSERT(f != null_face());
-        MCUT_ASSERT(std::find(m_faces_removed.cbegin(), m_faces_removed.cend(), f) == m_faces_removed.cend());
+        MCUT_ASSERT(!is_removed(f));
 
-        face_data_t& fd = m_faces.at(f);
+        face_data_t& fd = m_faces[f];
 
         std::vector<vertex_descriptor_t> face_vertices; // ... that are used by face
 
         // disassociate halfedges
 
         for (std::vector<halfedge_descriptor_t>::const_iterator it = fd.m_halfedges.cbegin(); it != fd.m_halfedges.cend(); ++it) {
-            halfedge_data_t& hd = m_halfedges.at(*it);
+            halfedge_data_t& hd = m_halfedges[*it];
             MCUT_ASSERT(hd.f != null_face());
             hd.f = null_face();
 
@@ -479,7 +481,7 @@ public:
             // by a face
             if (hd.n != null_halfedge()) { // disassociate "next"
                 const halfedge_descriptor_t hn = hd.n;
-                halfedge_data_t& hnd = m_halfedges.at(hn);
+                halfedge_data_t& hnd = m_halfedges[hn];
                 MCUT_ASSERT(hnd.p == *it);
                 hnd.p = null_halfedge();
                 //
@@ -488,7 +490,7 @@ public:
 
             if (hd.p != null_halfedge()) { // disassociate "previous"
                 const halfedge_descriptor_t hp = hd.p;
-                halfedge_data_t& hpd = m_halfedges.at(hp);
+                halfedge_data_t& hpd = m_halfedges[hp];
                 MCUT_ASSERT(hpd.n == *it);
                 hpd.n = null_halfedge();
                 //
@@ -503,7 +505,7 @@ public:
         // for each vertex used by face
         for (std::vector<vertex_descriptor_t>::const_iterator it = face_vertices.cbegin(); it != face_vertices.cend(); ++it) {
             vertex_descriptor_t face_vertex = *it;
-            vertex_data_t& vd = m_vertices.at(face_vertex);
+            vertex_data_t& vd = m_vertices[face_vertex];
 
             std::vector<face_descriptor_t>::const_iterator fIter = std::find(vd.m_faces.cbegin(), vd.m_faces.cend(), f);
 
@@ -513,22 +515,23 @@ public:
         }
 
         m_faces_removed.push_back(f);
+        m_faces_removed_flags[f] = true;
     }
 
     // also disassociates (not remove) the halfedges(s) and vertex incident to this halfedge
     void remove_halfedge(halfedge_descriptor_t h)
     {
         MCUT_ASSERT(h != null_halfedge());
-        MCUT_ASSERT(std::find(m_halfedges_removed.cbegin(), m_halfedges_removed.cend(), h) == m_halfedges_removed.cend());
+        MCUT_ASSERT(!is_removed(h));
 
-        halfedge_data_t& hd = m_halfedges.at(h);
+        halfedge_data_t& hd = m_halfedges[h];
 
         MCUT_ASSERT(hd.e == null_edge()); // there must not be an edge dependent on h if we are to remove h
         MCUT_ASSERT(hd.f == null_face()); // there must not be a face dependent on h if we are to remove h
 
         if (hd.n != null_halfedge()) { // disassociate next
             const halfedge_descriptor_t hn = hd.n;
-            halfedge_data_t& hnd = m_halfedges.at(hn);
+            halfedge_data_t& hnd = m_halfedges[hn];
             MCUT_ASSERT(hnd.p == h);
             hnd.p = null_halfedge();
             //
@@ -537,7 +540,7 @@ public:
 
         if (hd.o != null_halfedge()) { // disassociate opposite
             const halfedge_descriptor_t ho = hd.o;
-            halfedge_data_t& hod = m_halfedges.at(ho);
+            halfedge_data_t& hod = m_halfedges[ho];
             MCUT_ASSERT(hod.o == h);
             hod.o = null_halfedge();
             //
@@ -546,7 +549,7 @@ public:
 
         if (hd.p != null_halfedge()) { // disassociate previous
             const halfedge_descriptor_t hp = hd.p;
-            halfedge_data_t& hpd = m_halfedges.at(hp);
+            halfedge_data_t& hpd = m_halfedges[hp];
             MCUT_ASSERT(hpd.n == h);
             hpd.n = null_halfedge();
             //
@@ -556,7 +559,7 @@ public:
         MCUT_ASSERT(hd.t != null_vertex()); // every h has a target vertex which is effectively dependent on h
 
         // disassociate target vertex
-        vertex_data_t& htd = m_vertices.at(hd.t);
+        vertex_data_t& htd = m_vertices[hd.t];
         std::vector<halfedge_descriptor_t>::const_iterator hIter = std::find(htd.m_halfedges.cbegin(), htd.m_halfedges.cend(), h);
 
         MCUT_ASSERT(hIter != htd.m_halfedges.cend()); // because not yet removed h
@@ -564,15 +567,16 @@ public:
         htd.m_halfedges.erase(hIter); // remove association
 
         m_halfedges_removed.push_back(h);
+        m_halfedges_removed_flags[h] = true;
     }
 
     // also disassociates (not remove) any face(s) incident to edge via its halfedges, and also disassociates the halfedges
     void remove_edge(const edge_descriptor_t e, bool remove_halfedges = true)
     {
         MCUT_ASSERT(e != null_edge());
-        MCUT_ASSERT(std::find(m_edges_removed.cbegin(), m_edges_removed.cend(), e) == m_edges_removed.cend());
+        MCUT_ASSERT(!is_removed(e));
 
-        edge_data_t& ed = m_edges.at(e);
+        edge_data_t& ed = m_edges[e];
         std::vector<halfedge_descriptor_t> halfedges = { ed.h, opposite(ed.h) }; // both halfedges incident to edge must be disassociated
 
         for (std::vector<halfedge_descriptor_t>::const_iterator it = halfedges.cbegin(); it != halfedges.cend(); ++it) {
@@ -580,7 +584,7 @@ public:
             MCUT_ASSERT(h != null_halfedge());
 
             // disassociate halfedge
-            halfedge_data_t& hd = m_halfedges.at(h);
+            halfedge_data_t& hd = m_halfedges[h];
             MCUT_ASSERT(hd.e == e);
             hd.e = null_edge();
             if (remove_halfedges) {
@@ -591,16 +595,18 @@ public:
         ed.h = null_halfedge(); // we are removing the edge so every associated data element must be nullified
 
         m_edges_removed.push_back(e);
+        m_edges_removed_flags[e] = true;
     }
 
     void remove_vertex(const vertex_descriptor_t v)
     {
         MCUT_ASSERT(v != null_vertex());
-        MCUT_ASSERT(std::find(m_vertices_removed.cbegin(), m_vertices_removed.cend(), v) == m_vertices_removed.cend());
-        MCUT_ASSERT(m_vertices.at(v).m_faces.empty());
-        MCUT_ASSERT(m_vertices.at(v).m_halfedges.empty());
+        MCUT_ASSERT(!is_removed(v));
+        MCUT_ASSERT(m_vertices[v].m_faces.empty());
+        MCUT_ASSERT(m_vertices[v].m_halfedges.empty());
 
         m_vertices_removed.push_back(v);
+        m_vertices_removed_flags[v] = true;
     }
 
     void remove_elements()
@@ -665,26 +671,29 @@ public:
 
     bool is_removed(face_descriptor_t f) const
     {
-        return std::find(m_faces_removed.cbegin(), m_faces_removed.cend(), f) != m_faces_removed.cend();
+        return m_faces_removed_flags[f];
     }
 
     bool is_removed(edge_descriptor_t e) const
     {
-        return std::find(m_edges_removed.cbegin(), m_edges_removed.cend(), e) != m_edges_removed.cend();
+        return m_edges_removed_flags[e];
     }
 
     bool is_removed(halfedge_descriptor_t h) const
     {
-        return std::find(m_halfedges_removed.cbegin(), m_halfedges_removed.cend(), h) != m_halfedges_removed.cend();
+        return m_halfedges_removed_flags[h];
     }
 
     bool is_removed(vertex_descriptor_t v) const
     {
-        return std::find(m_vertices_removed.cbegin(), m_vertices_removed.cend(), v) != m_vertices_removed.cend();
+        return m_vertices_removed_flags[v];
     }
 
     const math::vec3& vertex(const vertex_descriptor_t& vd) const;
 
+    // move a vertex to "point" (the connectivity is unchanged)
+    void set_vertex(const vertex_descriptor_t& vd, const math::vec3& point);
+
     // returns vector of halfedges which point to vertex (i.e. "v" is their target)
     const std::vector<halfedge_descriptor_t>& get_halfedges_around_vertex(const vertex_descriptor_t v) const;
 
@@ -717,11 +726,18 @@ private:
     // member variables
     // ----------------
 
-    std::map<vertex_descriptor_t, vertex_data_t> m_vertices;
-    std::map<edge_descriptor_t, edge_data_t> m_edges;
-    std::map<halfedge_descriptor_t, halfedge_data_t> m_halfedges;
-    std::map<face_descriptor_t, face_data_t> m_faces;
-
+    // NOTE: the element arrays are indexed directly with descriptors (i.e. the
+    // slot of an element is its descriptor value). Vertex coordinates are kept
+    // in their own packed array, separate from the vertex connectivity data, so
+    // that geometric queries do not drag adjacency lists through the cache.
+    std::vector<math::vec3> m_vertex_positions;
+    std::vector<vertex_data_t> m_vertices;
+    std::vector<edge_data_t> m_edges;
+    std::vector<halfedge_data_t> m_halfedges;
+    std::vector<face_data_t> m_faces;
+
+    // The free lists of removed elements, in the order of removal. New elements
+    // are taken from here first (see "add_*" functions).
     // NOTE: I use std::vector because we'll have very few (typically zero)
     // elements removed at a given time. In fact removal only happens during
     // input-mesh face-partitioning to resolve floating polygons, which is
@@ -731,6 +747,13 @@ private:
     std::vector<halfedge_descriptor_t> m_halfedges_removed;
     std::vector<vertex_descriptor_t> m_vertices_removed;
 
+    // one bit per element slot, which is set while the slot is in the free list
+    // (for constant-time "is_removed" queries)
+    std::vector<bool> m_faces_removed_flags;
+    std::vector<bool> m_edges_removed_flags;
+    std::vector<bool> m_halfedges_removed_flags;
+    std::vector<bool> m_vertices_removed_flags;
+
 }; // class mesh_t {
 
 typedef vertex_descriptor_t vd_t;
@@ -743,4 +766,22 @@ void read_off(mcut::mesh_t& mesh, const char* fpath);
 
 } // namespace mcut
 
+namespace std {
+template <>
+struct hash<mcut::vertex_descriptor_t> : public mcut::descriptor_hasher_t<mcut::vertex_descriptor_t> {
+};
+
+template <>
+struct hash<mcut::edge_descriptor_t> : public mcut::descriptor_hasher_t<mcut::edge_descriptor_t> {
+};
+
+template <>
+struct hash<mcut::halfedge_descriptor_t> : public mcut::descriptor_hasher_t<mcut::halfedge_descriptor_t> {
+};
+
+template <>
+struct hash<mcut::face_descriptor_t> : public mcut::descriptor_hasher_t<mcut::face_descriptor_t> {
+};
+} // namespace std
+
 #endif // #ifndef MCUT_HALFEDGE_MESH_H_
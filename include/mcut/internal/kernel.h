@@ -24,11 +24,14 @@
 #define MCUT_KERNEL_H
 #include <mcut/internal/halfedge_mesh.h>
 
+#include <functional>
 #include <map>
 #include <vector>
 
 namespace mcut {
 
+class thread_pool;
+
 //
 // final execution states (i.e. did anything go wrong..?)
 //
@@ -105,10 +108,25 @@ struct floating_polygon_info_t {
     std::vector<math::vec3> polygon_vertices;
 };
 
+// a cut-mesh polygon that has just been stitched into a fragment (see input_t::stitched_polygon_callback)
+struct stitched_polygon_info_t {
+    // the patches that seal the fragment (i.e. sealing from inside or outside)
+    cut_surface_patch_location_t location = cut_surface_patch_location_t::UNDEFINED;
+    // number of polygons with the same location that were stitched before this one
+    int stitch_index = -1;
+    // the face of input_t::cut_mesh from which the polygon is traced
+    fd_t cut_mesh_face;
+    // the vertices of the polygon in the fragment, which are shared with the other polygons of the same location
+    std::vector<vd_t> vertices;
+    std::vector<math::vec3> vertex_coords;
+};
+
 //
 // settings for how to execute the function "mcut::dispatch(...)"
 //
 struct input_t {
+    // the threads that execute the parallel parts of the kernel
+    thread_pool* scheduler = nullptr;
     const mesh_t* src_mesh = nullptr;
     const mesh_t* cut_mesh = nullptr;
     const std::vector<std::pair<fd_t, fd_t>>* intersecting_sm_cm_face_pairs = nullptr;
@@ -139,6 +157,11 @@ struct input_t {
     // bool include_fragment_sealed_partial = false; // See: variable above "keep_partially_sealed_connected_components"
     bool keep_fragments_sealed_inside_exhaustive = false;
     bool keep_fragments_sealed_outside_exhaustive = false;
+    // called after each cut-mesh polygon is stitched (in stitching order), so that the intermediate states of the sealed
+    // fragments can be consumed without the kernel keeping a copy of each state. If set, the "exhaustive" options stream
+    // the intermediate states to this function and only output the fully sealed fragments.
+    // NOTE: may be called concurrently for polygons with different locations
+    std::function<void(const stitched_polygon_info_t&)> stitched_polygon_callback;
     // NOTE TO SELF: if the user simply wants patches, then kernel should not have to proceed to stitching!!!
 };
 
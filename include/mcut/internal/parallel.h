@@ -0,0 +1,379 @@
+/**
+ * Copyright (c) 2020-2021 CutDigital Ltd.
+ * All rights reserved.
+ * 
+ * NOTE: This file is licensed under GPL-3.0-or-later (default). 
+ * A commercial license can be purchased from CutDigital Ltd. 
+ *  
+ * License details:
+ * 
+ * (A)  GNU General Public License ("GPL"); a copy of which you should have 
+ *      recieved with this file.
+ * 	    - see also: <http://www.gnu.org/licenses/>
+ * (B)  Commercial license.
+ *      - email: contact@cut-digital.com
+ * 
+ * The commercial license options is for users that wish to use MCUT in 
+ * their products for comercial purposes but do not wish to release their 
+ * software products under the GPL license. 
+ * 
+ * Author(s)     : Floyd M. Chitalu
+ */
+
+#ifndef MCUT_PARALLEL_H_
+#define MCUT_PARALLEL_H_
+
+#include "mcut/internal/utils.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if defined(MCUT_MULTI_THREADED_IMPL)
+#include <condition_variable>
+#include <deque>
+
+#if defined(MCUT_WITH_ARBITRARY_PRECISION_NUMBERS)
+#include "mcut/internal/number.h"
+#else
+#include <cfenv>
+#endif // #if defined(MCUT_WITH_ARBITRARY_PRECISION_NUMBERS)
+#endif // #if defined(MCUT_MULTI_THREADED_IMPL)
+
+namespace mcut {
+
+#if defined(MCUT_MULTI_THREADED_IMPL)
+// The floating-point settings (rounding mode etc.) are per-thread state, which the
+// worker threads must share with the calling thread to compute the same results
+struct thread_numerical_settings_t {
+#if defined(MCUT_WITH_ARBITRARY_PRECISION_NUMBERS)
+    mp_rnd_t rounding_mode = math::arbitrary_precision_number_t::get_default_rounding_mode();
+    mp_prec_t precision = math::arbitrary_precision_number_t::get_default_precision();
+
+    void apply() const
+    {
+        math::arbitrary_precision_number_t::set_default_rounding_mode(rounding_mode);
+        math::arbitrary_precision_number_t::set_default_precision(precision);
+    }
+#else
+    int rounding_mode = std::fegetround();
+
+    void apply() const
+    {
+        std::fesetround(rounding_mode);
+    }
+#endif // #if defined(MCUT_WITH_ARBITRARY_PRECISION_NUMBERS)
+};
+#endif // #if defined(MCUT_MULTI_THREADED_IMPL)
+
+//
+// A fixed set of helper threads which execute the parallel parts of dispatch calls.
+// The thread that submits work to the pool also executes part of it, so a pool with
+// zero helper threads runs everything on the calling thread.
+//
+class thread_pool {
+public:
+    explicit thread_pool(uint32_t helper_thread_count);
+    ~thread_pool();
+
+    // number of helper threads that are used when no count is specified by the user
+    static uint32_t get_default_helper_thread_count();
+
+    uint32_t get_helper_thread_count() const
+    {
+        return m_helper_thread_count;
+    }
+
+    // invoke "fn(task_index)" for every index in [0, num_tasks) and return once all tasks have
+    // completed. The calling thread executes the last task and then helps with the remaining ones.
+    // If a task throws, the first exception is rethrown on the calling thread after all tasks
+    // have finished (tasks that have not started by then are skipped).
+    // NOTE: without MCUT_MULTI_THREADED_IMPL, the tasks are executed in order on the calling thread
+    template <typename function_type>
+    void run(const uint32_t num_tasks, const function_type& fn);
+
+private:
+    thread_pool(const thread_pool&) = delete;
+    thread_pool& operator=(const thread_pool&) = delete;
+
+#if defined(MCUT_MULTI_THREADED_IMPL)
+    // the tasks submitted by one call to "run" (excluding the caller's task)
+    struct task_group_t {
+        std::mutex mutex;
+        std::condition_variable all_done;
+        uint32_t remaining;
+        std::exception_ptr first_exception; // thrown by a task of the group
+
+        explicit task_group_t(uint32_t n)
+            : remaining(n)
+        {
+        }
+
+        void finish_one()
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (--remaining == 0) {
+                all_done.notify_all();
+            }
+        }
+
+        // record the exception currently being handled, unless an earlier one was recorded
+        void set_exception()
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!first_exception) {
+                first_exception = std::current_exception();
+            }
+        }
+
+        bool failed()
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            return first_exception != nullptr;
+        }
+    };
+
+    // pop a queued task and execute it. Returns false if the queue is empty.
+    bool run_pending_task();
+    // return once all tasks of "group" have completed, executing queued tasks while waiting
+    void wait(task_group_t& group);
+    void helper_thread_main();
+
+    std::vector<std::thread> m_threads;
+    std::deque<std::function<void()>> m_queue;
+    std::mutex m_queue_mutex;
+    std::condition_variable m_queue_not_empty;
+    bool m_terminate;
+#endif // #if defined(MCUT_MULTI_THREADED_IMPL)
+    uint32_t m_helper_thread_count;
+};
+
+template <typename function_type>
+void thread_pool::run(const uint32_t num_tasks, const function_type& fn)
+{
+#if defined(MCUT_MULTI_THREADED_IMPL)
+    if (num_tasks > 1 && m_helper_thread_count > 0) {
+        const thread_numerical_settings_t numerical_settings;
+        task_group_t group(num_tasks - 1);
+
+        {
+            std::lock_guard<std::mutex> lock(m_queue_mutex);
+
+            for (uint32_t i = 0; i < (num_tasks - 1); ++i) {
+                // NOTE: the task must not throw, otherwise the group would never finish
+                m_queue.emplace_back([&fn, &numerical_settings, &group, i]() {
+                    if (!group.failed()) {
+                        const thread_numerical_settings_t executing_thread_settings; // restored after the task
+                        numerical_settings.apply();
+                        try {
+                            fn(i);
+                        } catch (...) {
+                            group.set_exception();
+                        }
+                        executing_thread_settings.apply();
+                    }
+                    group.finish_one();
+                });
+            }
+        }
+
+        m_queue_not_empty.notify_all();
+
+        try {
+            fn(num_tasks - 1); // calling thread
+        } catch (...) {
+            group.set_exception();
+        }
+
+        // the queued tasks refer to "fn", "numerical_settings" and "group", so we cannot
+        // leave this frame (even by throwing) until they have all completed
+        wait(group);
+
+        if (group.first_exception) {
+            std::rethrow_exception(group.first_exception);
+        }
+        return;
+    }
+#endif // #if defined(MCUT_MULTI_THREADED_IMPL)
+
+    for (uint32_t i = 0; i < num_tasks; ++i) {
+        fn(i);
+    }
+}
+
+// compute the number of contiguous blocks (one per thread) into which to split
+// "length" work items, such that each block has at least "min_per_block" items.
+// Returns 1 if the work is too small to be worth running in parallel.
+inline uint32_t get_parallel_block_count(const thread_pool& pool, const uint32_t length, const uint32_t min_per_block)
+{
+    MCUT_ASSERT(min_per_block > 0);
+    const uint32_t max_blocks = (length + min_per_block - 1) / min_per_block;
+    const uint32_t num_blocks = std::min(pool.get_helper_thread_count() + 1, max_blocks);
+    return std::max(num_blocks, (uint32_t)1);
+}
+
+// invoke "fn(thread_index)" on "num_threads" threads of "pool" concurrently, where
+// the calling thread is the last one (i.e. "thread_index == num_threads - 1").
+template <typename function_type>
+void parallel_invoke(thread_pool& pool, const uint32_t num_threads, const function_type& fn)
+{
+    MCUT_ASSERT(num_threads >= 1);
+    pool.run(num_threads, fn);
+}
+
+// split the range [0, length) into "num_blocks" contiguous blocks and invoke
+// "fn(block_index, block_begin, block_end)" on each block concurrently. Blocks
+// are numbered in range order and the calling thread processes the last block.
+// NOTE: the block boundaries depend only on "length" and "num_blocks".
+template <typename function_type>
+void parallel_for_blocks(thread_pool& pool, const uint32_t length, const uint32_t num_blocks, const function_type& fn)
+{
+    MCUT_ASSERT(num_blocks >= 1);
+
+    if (num_blocks == 1) {
+        fn(0, 0, length);
+        return;
+    }
+
+    const uint32_t block_size = length / num_blocks;
+
+    parallel_invoke(pool, num_blocks, [&](uint32_t block_index) {
+        const uint32_t block_begin = block_index * block_size;
+        const uint32_t block_end = (block_index == (num_blocks - 1)) ? length : (block_begin + block_size);
+        fn(block_index, block_begin, block_end);
+    });
+}
+
+// invoke "fn(begin, end)" on contiguous blocks of the range [0, length) concurrently,
+// where each block holds at least "min_per_block" items.
+template <typename function_type>
+void parallel_for(thread_pool& pool, const uint32_t length, const uint32_t min_per_block, const function_type& fn)
+{
+    parallel_for_blocks(pool, length, get_parallel_block_count(pool, length, min_per_block),
+        [&fn](uint32_t /*block_index*/, uint32_t block_begin, uint32_t block_end) { fn(block_begin, block_end); });
+}
+
+//
+// A reader-writer lock for data that is read often and rarely modified (C++11 has no std::shared_mutex).
+// Readers only increment a shared counter, so they do not serialize on each other, while a writer waits
+// for the current readers to finish. Writers should be rare because waiting readers and writers spin.
+//
+class shared_mutex {
+public:
+    shared_mutex()
+        : m_num_readers(0)
+        , m_writer(false)
+    {
+    }
+
+    void lock()
+    {
+        m_writer_mutex.lock(); // one writer at a time
+        m_writer.store(true);
+
+        while (m_num_readers.load() != 0) {
+            std::this_thread::yield();
+        }
+    }
+
+    void unlock()
+    {
+        m_writer.store(false);
+        m_writer_mutex.unlock();
+    }
+
+    void lock_shared()
+    {
+        for (;;) {
+            m_num_readers.fetch_add(1);
+
+            if (!m_writer.load()) {
+                return;
+            }
+
+            m_num_readers.fetch_sub(1); // let the writer proceed
+
+            while (m_writer.load()) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    void unlock_shared()
+    {
+        m_num_readers.fetch_sub(1);
+    }
+
+private:
+    shared_mutex(const shared_mutex&) = delete;
+    shared_mutex& operator=(const shared_mutex&) = delete;
+
+    std::atomic<uint32_t> m_num_readers;
+    std::atomic<bool> m_writer;
+    std::mutex m_writer_mutex;
+};
+
+// holds the shared (i.e. reader) lock of a "shared_mutex" for its lifetime
+class shared_lock_guard {
+public:
+    explicit shared_lock_guard(shared_mutex& mutex)
+        : m_mutex(mutex)
+    {
+        m_mutex.lock_shared();
+    }
+
+    ~shared_lock_guard()
+    {
+        m_mutex.unlock_shared();
+    }
+
+private:
+    shared_lock_guard(const shared_lock_guard&) = delete;
+    shared_lock_guard& operator=(const shared_lock_guard&) = delete;
+
+    shared_mutex& m_mutex;
+};
+
+//
+// Executes functions one at a time in the order that they are submitted, on a dedicated
+// thread which runs asynchronously to the submitting threads. The thread is created when
+// the first function is submitted.
+//
+class command_queue {
+public:
+    command_queue();
+    // executes all pending functions before returning
+    ~command_queue();
+
+    // submit "fn" for execution and return immediately. "fn" should not throw: its exceptions are discarded.
+    // NOTE: without MCUT_MULTI_THREADED_IMPL, "fn" is executed on the calling thread before returning
+    void enqueue(const std::function<void()>& fn);
+
+    // return once all submitted functions have been executed
+    void finish();
+
+private:
+    command_queue(const command_queue&) = delete;
+    command_queue& operator=(const command_queue&) = delete;
+
+#if defined(MCUT_MULTI_THREADED_IMPL)
+    void worker_thread_main();
+
+    std::thread m_thread;
+    std::deque<std::function<void()>> m_queue;
+    std::mutex m_mutex;
+    std::condition_variable m_queue_not_empty;
+    std::condition_variable m_idle;
+    bool m_busy; // worker thread is executing a function
+    bool m_terminate;
+#endif // #if defined(MCUT_MULTI_THREADED_IMPL)
+};
+
+} // namespace mcut {
+
+#endif // #ifndef MCUT_PARALLEL_H_
@@ -88,6 +88,22 @@ typedef struct McConnectedComponent_T* McConnectedComponent;
  */
 typedef struct McContext_T* McContext;
 
+/**
+ * \struct McEvent
+ * @brief Event handle.
+ *
+ * Opaque type referencing the execution status of an asynchronous command (e.g. a dispatch call enqueued with ::mcEnqueueDispatch), which the client can wait on, poll or attach callbacks to.
+ */
+typedef struct McEvent_T* McEvent;
+
+/**
+ * \struct McMesh
+ * @brief Mesh handle.
+ *
+ * Opaque type referencing a source mesh that is prepared once (i.e. checked, and with its bounding volume hierarchy built) and can then be cut many times (See also: ::mcDispatchMesh).
+ */
+typedef struct McMesh_T* McMesh;
+
 /**
  * @brief Bitfield type.
  *
@@ -228,7 +244,10 @@ typedef enum McConnectedComponentData {
     MC_CONNECTED_COMPONENT_DATA_SEAM_VERTEX = (1 << 13), /**< List of seam-vertices as an array of indices. */
     MC_CONNECTED_COMPONENT_DATA_ORIGIN = (1 << 14), /**< The input mesh (source- or cut-mesh) from which a "seam" is derived (See also: ::McSeamedConnectedComponentOrigin). */
     MC_CONNECTED_COMPONENT_DATA_VERTEX_MAP = (1 << 15), /**< List of a subset of vertex indices from one of the input meshes (source-mesh or the cut-mesh). Each value will be the index of an input mesh vertex or MC_UNDEFINED_VALUE. This index-value corresponds to the connected component vertex at the accessed index. The value at index 0 of the queried array is the index of the vertex in the original input mesh. In order to clearly distinguish indices of the cut mesh from those of the source mesh, this index value corresponds to a cut mesh vertex index if it is great-than-or-equal-to the number of source-mesh vertices. Intersection points are mapped to MC_UNDEFINED_VALUE. The input mesh will be deduced by the user from the type of connected component with which the information is queried.*/
-    MC_CONNECTED_COMPONENT_DATA_FACE_MAP = (1 << 16) /**< List a subset of face indices from one of the input meshes (source-mesh or the cut-mesh). Each value will be the index of an input mesh face. This index-value corresponds to the connected component face at the accessed index. Example: the value at index 0 of the queried array is the index of the face in the original input mesh. Note that all faces are mapped to a defined value. In order to clearly distinguish indices of the cut mesh from those of the source mesh, an input-mesh face index value corresponds to a cut-mesh vertex-index if it is great-than-or-equal-to the number of source-mesh faces.*/
+    MC_CONNECTED_COMPONENT_DATA_FACE_MAP = (1 << 16), /**< List a subset of face indices from one of the input meshes (source-mesh or the cut-mesh). Each value will be the index of an input mesh face. This index-value corresponds to the connected component face at the accessed index. Example: the value at index 0 of the queried array is the index of the face in the original input mesh. Note that all faces are mapped to a defined value. In order to clearly distinguish indices of the cut mesh from those of the source mesh, an input-mesh face index value corresponds to a cut-mesh vertex-index if it is great-than-or-equal-to the number of source-mesh faces.*/
+    MC_CONNECTED_COMPONENT_DATA_CUT_MESH_INDEX = (1 << 17), /**< Index of the cut-mesh that produced the connected component in a batched dispatch (uint32_t). Connected components that are produced by ::mcDispatch have index zero (See also: ::mcDispatchBatch). */
+    MC_CONNECTED_COMPONENT_DATA_FACE_TRIANGULATION = (1 << 18), /**< List of triangles as an array of vertex indices (three per triangle), which is computed by triangulating each face. The triangles of a face are listed contiguously, in the order of faces, and have the same winding order as the face. A face with N vertices yields N-2 triangles. */
+    MC_CONNECTED_COMPONENT_DATA_FACE_TRIANGULATION_MAP = (1 << 19) /**< List of face indices from one of the input meshes (source-mesh or the cut-mesh), one per triangle of MC_CONNECTED_COMPONENT_DATA_FACE_TRIANGULATION. Each value is the MC_CONNECTED_COMPONENT_DATA_FACE_MAP value of the face from which the triangle was produced. */
 } McConnectedComponentData;
 
 /**
@@ -333,7 +352,8 @@ typedef enum McDispatchFlags {
         MC_DISPATCH_FILTER_PATCH_OUTSIDE | //
         MC_DISPATCH_FILTER_SEAM_SRCMESH | //
         MC_DISPATCH_FILTER_SEAM_CUTMESH), /** Keep all connected components resulting from the dispatched cut. */
-    MC_DISPATCH_ENFORCE_GENERAL_POSITION = (1 << 15) /** Allow MCUT to perturb the cut-mesh if the inputs are not in general position.  */
+    MC_DISPATCH_ENFORCE_GENERAL_POSITION = (1 << 15), /** Allow MCUT to perturb the cut-mesh if the inputs are not in general position.  */
+    MC_DISPATCH_OUTPUT_VERTEX_ARRAY_FLOAT = (1 << 16) /** Store the vertices of the resulting connected components as 32-bit floating-point numbers, which halves their memory footprint. Cutting is still performed with the internal number type and exact predicates, so only the output coordinates are rounded. MC_CONNECTED_COMPONENT_DATA_VERTEX_FLOAT is then returned (and mapped) without conversion, while MC_CONNECTED_COMPONENT_DATA_VERTEX_DOUBLE is converted from the 32-bit values. */
 } McDispatchFlags;
 
 /**
@@ -349,9 +369,35 @@ typedef enum McQueryFlags {
     MC_DEFAULT_ROUNDING_MODE = 1 << 3, /**< Default way to round the result of a floating-point operation.*/
     MC_PRECISION_MAX = 1 << 4, /**< Maximum value for precision bits.*/
     MC_PRECISION_MIN = 1 << 5, /**< Minimum value for precision bits.*/
-    MC_DEBUG_KERNEL_TRACE = 1 << 6 /**< Verbose log of the kernel execution trace.*/
+    MC_DEBUG_KERNEL_TRACE = 1 << 6, /**< Verbose log of the kernel execution trace.*/
+    MC_CONTEXT_HELPER_THREAD_COUNT = 1 << 7 /**< Number of helper threads used by a context (uint32_t).*/
 } McQueryFlags;
 
+/**
+ * \enum McEventInfo
+ * @brief Flags for querying the state of an event.
+ *
+ * This enum structure defines the flags which are used to query for specific information about an event with ::mcGetEventInfo.
+ */
+typedef enum McEventInfo {
+    MC_EVENT_COMMAND_EXECUTION_STATUS = 1 << 0, /**< Execution status of the command associated with the event (::McEventCommandExecStatus).*/
+    MC_EVENT_RUNTIME_EXECUTION_STATUS = 1 << 1, /**< Error code returned by the command associated with the event (::McResult). Valid once the command is complete.*/
+    MC_EVENT_CONTEXT = 1 << 2 /**< Context on which the command associated with the event was enqueued (::McContext).*/
+} McEventInfo;
+
+/**
+ * \enum McEventCommandExecStatus
+ * @brief Execution status of the command associated with an event.
+ *
+ * A command first has status MC_SUBMITTED, then MC_RUNNING and finally MC_COMPLETE.
+ */
+typedef enum McEventCommandExecStatus {
+    MC_SUBMITTED = 1 << 0, /**< The command has been enqueued but has not started executing.*/
+    MC_RUNNING = 1 << 1, /**< The command is executing.*/
+    MC_COMPLETE = 1 << 2, /**< The command has finished executing (see also MC_EVENT_RUNTIME_EXECUTION_STATUS).*/
+    MC_EVENT_COMMAND_EXEC_STATUS_MAX_ENUM = 0xFFFFFFFF /**< Wildcard (match all) . */
+} McEventCommandExecStatus;
+
 /**
  *  
  * @brief Debug callback function signature type.
@@ -367,6 +413,98 @@ typedef void (*pfn_mcDebugOutput_CALLBACK)(
     const char* message,
     const void* userParam);
 
+/**
+ *  
+ * @brief Event callback function signature type.
+ *
+ * The callback function should have this prototype (in C), or be otherwise compatible with such a prototype.
+ * It is called when the command associated with \p event is complete, possibly on a thread that is internal to MCUT.
+ */
+typedef void (*pfn_McEvent_CALLBACK)(
+    McEvent event,
+    void* data);
+
+/**
+ *  
+ * @brief Allocation callback function signature type.
+ *
+ * The callback function should have this prototype (in C), or be otherwise compatible with such a prototype.
+ * It returns memory of at least \p numBytes bytes whose address is a multiple of \p alignment, or NULL if the memory 
+ * cannot be allocated.
+ */
+typedef void* (*pfn_mcAllocate_CALLBACK)(
+    uint64_t numBytes,
+    uint64_t alignment,
+    const void* userParam);
+
+/**
+ *  
+ * @brief Deallocation callback function signature type.
+ *
+ * The callback function should have this prototype (in C), or be otherwise compatible with such a prototype.
+ * It frees memory that was returned by the corresponding allocation callback.
+ */
+typedef void (*pfn_mcFree_CALLBACK)(
+    void* pMem,
+    const void* userParam);
+
+/**
+ * \struct McStitchedPolygonDesc
+ * @brief A cut-mesh polygon that has been stitched into a fragment to seal its holes (see ::mcSetStitchingCallback).
+ *
+ * The polygon is the only difference between the current state of the fragment and the previous one. The arrays are
+ * read-only and only valid for the duration of the callback.
+ */
+typedef struct McStitchedPolygonDesc {
+    uint32_t cutMeshIndex; /**< Index of the cut-mesh in the ::mcDispatchBatch call (0 for the other dispatch functions). */
+    McPatchLocation location; /**< Whether the fragment is sealed from the inside or from the outside (See also: ::McFragmentSealType). */
+    uint32_t stitchIndex; /**< The number of polygons with the same cut-mesh index and location that were stitched before this one. */
+    uint32_t cutMeshFace; /**< Index of the cut-mesh face from which the polygon was created. */
+    uint32_t numVertices; /**< The number of vertices of the polygon. */
+    const uint32_t* pVertexIds; /**< Identifiers of the vertices (in order), which are shared with the polygons of the same cut-mesh index and location. */
+    const double* pVertexCoords; /**< Coordinates of the vertices (x, y, z for each vertex). */
+} McStitchedPolygonDesc;
+
+/**
+ *  
+ * @brief Stitching callback function signature type.
+ *
+ * The callback function should have this prototype (in C), or be otherwise compatible with such a prototype.
+ * It is called after each polygon is stitched by a dispatch call, possibly on a thread that is internal to MCUT.
+ */
+typedef void (*pfn_mcStitching_CALLBACK)(
+    const McStitchedPolygonDesc* pPolygon,
+    const void* userParam);
+
+/**
+ * \struct McConnectedComponentDataDesc
+ * @brief The data of a connected component that is returned by ::mcGetConnectedComponentsData.
+ *
+ * The counts, type and cut-mesh index are always returned. An array pointer is NULL unless the corresponding
+ * ::McConnectedComponentData flag is requested (and the array is not empty), in which case it points to the same 
+ * read-only data as would be returned by ::mcMapConnectedComponentData.
+ */
+typedef struct McConnectedComponentDataDesc {
+    McConnectedComponentType type; /**< See MC_CONNECTED_COMPONENT_DATA_TYPE. */
+    uint32_t cutMeshIndex; /**< See MC_CONNECTED_COMPONENT_DATA_CUT_MESH_INDEX. */
+    uint32_t numVertices; /**< Number of vertices. */
+    uint32_t numFaces; /**< Number of faces. */
+    uint32_t numFaceIndices; /**< Number of elements in \p pFaceIndices (i.e. the sum of the face sizes). */
+    uint32_t numEdges; /**< Number of edges. */
+    uint32_t numSeamVertices; /**< Number of elements in \p pSeamVertexIndices. */
+    uint32_t numTriangles; /**< Number of triangles in \p pFaceTriangulation (only returned if MC_CONNECTED_COMPONENT_DATA_FACE_TRIANGULATION or MC_CONNECTED_COMPONENT_DATA_FACE_TRIANGULATION_MAP is requested). */
+    const float* pVerticesFloat; /**< MC_CONNECTED_COMPONENT_DATA_VERTEX_FLOAT (3 * \p numVertices elements). */
+    const double* pVerticesDouble; /**< MC_CONNECTED_COMPONENT_DATA_VERTEX_DOUBLE (3 * \p numVertices elements). */
+    const uint32_t* pFaceIndices; /**< MC_CONNECTED_COMPONENT_DATA_FACE (\p numFaceIndices elements). */
+    const uint32_t* pFaceSizes; /**< MC_CONNECTED_COMPONENT_DATA_FACE_SIZE (\p numFaces elements). */
+    const uint32_t* pEdges; /**< MC_CONNECTED_COMPONENT_DATA_EDGE (2 * \p numEdges elements). */
+    const uint32_t* pSeamVertexIndices; /**< MC_CONNECTED_COMPONENT_DATA_SEAM_VERTEX (\p numSeamVertices elements). */
+    const uint32_t* pVertexMap; /**< MC_CONNECTED_COMPONENT_DATA_VERTEX_MAP (\p numVertices elements). */
+    const uint32_t* pFaceMap; /**< MC_CONNECTED_COMPONENT_DATA_FACE_MAP (\p numFaces elements). */
+    const uint32_t* pFaceTriangulation; /**< MC_CONNECTED_COMPONENT_DATA_FACE_TRIANGULATION (3 * \p numTriangles elements). */
+    const uint32_t* pFaceTriangulationMap; /**< MC_CONNECTED_COMPONENT_DATA_FACE_TRIANGULATION_MAP (\p numTriangles elements). */
+} McConnectedComponentDataDesc;
+
 /** @brief Create an MCUT context.
 *
 * This method creates a context object, which is a handle used by a client application to control the API state and access data.
@@ -397,6 +535,42 @@ typedef void (*pfn_mcDebugOutput_CALLBACK)(
 extern MCAPI_ATTR McResult MCAPI_CALL mcCreateContext(
     McContext* pContext, McFlags flags);
 
+/** @brief Create an MCUT context with a given number of helper threads.
+*
+* This method is the same as ::mcCreateContext except that it also specifies the number of helper threads which are created
+* with the context. The helper threads persist for the lifetime of the context, and assist the thread that calls ::mcDispatch
+* with the parallel parts of the dispatch. A context that is created with ::mcCreateContext has one helper thread less than the
+* number of concurrent threads supported by the hardware.
+* 
+* @param [out] pContext a pointer to the allocated context handle
+* @param [in] flags bitfield containing the context creation flags
+* @param [in] helperThreadCount the number of helper threads. Zero means that dispatch calls run on the calling thread only.
+*
+ * An example of usage:
+ * @code
+ * McContext myContext = MC_NULL_HANDLE;
+ * McResult err = mcCreateContextWithHelpers(&myContext, MC_NULL_HANDLE, 3);
+ * if(err != MC_NO_ERROR)
+ * {
+ *  // deal with error
+ * }
+ * @endcode
+*
+* @return Error code.
+* 
+* <b>Error codes</b> 
+* - MC_NO_ERROR  
+*   -# proper exit 
+* - MC_INVALID_VALUE 
+*   -# \p pContext is NULL
+*   -# Failure to allocate resources
+*   -# \p flags defines an invalid bitfield.
+*
+* @note MCUT does not create any helper threads if it was built without multi-threading (see MCUT_BUILD_WITH_THREADS).
+*/
+extern MCAPI_ATTR McResult MCAPI_CALL mcCreateContextWithHelpers(
+    McContext* pContext, McFlags flags, uint32_t helperThreadCount);
+
 /** @brief Set the numerical rounding mode.
 *
 * This function updates context state to use given rounding mode during dispatch calls. See ::McRoundingModeFlags.
@@ -573,6 +747,71 @@ extern MCAPI_ATTR McResult MCAPI_CALL mcDebugMessageCallback(
     pfn_mcDebugOutput_CALLBACK cb,
     const void* userParam);
 
+/** @brief Specify the functions that allocate the memory of connected component data.
+*
+* The arrays holding the data of connected components (vertices, faces, edges, data maps etc.) that are produced by 
+* subsequent dispatch calls are allocated with \p pfnAllocate and freed with \p pfnFree, which allows this data to be
+* placed directly into memory that is managed by the client application. The data is then accessed without copying 
+* with ::mcMapConnectedComponentData. The functions are called on the thread that first queries or maps the data of a 
+* connected component (for allocation) and on the thread that releases it (for deallocation). ::mcGetConnectedComponentsData 
+* may also call \p pfnAllocate on the helper threads of \p context.
+*
+* @param[in] context The context handle that was created by a previous call to mcCreateContext.
+* @param[in] pfnAllocate The function that allocates memory, or NULL to use the default allocator. 
+* @param[in] pfnFree The function that frees memory allocated by \p pfnAllocate, or NULL to use the default allocator. 
+* @param[in] userParam A user supplied pointer that will be passed on each invocation of \p pfnAllocate and \p pfnFree.
+*
+* @note When MCUT is built with arbitrary-precision numbers, the internal vertex array (of arbitrary-precision numbers)
+* is always allocated by MCUT.
+*
+* @return Error code.
+*
+* <b>Error codes</b> 
+* - MC_NO_ERROR  
+*   -# proper exit 
+* - MC_INVALID_VALUE 
+*   -# \p pContext is NULL or \p pContext is not an existing context.
+*   -# Only one of \p pfnAllocate and \p pfnFree is NULL.
+*
+*/
+extern MCAPI_ATTR McResult MCAPI_CALL mcSetConnectedComponentAllocator(
+    McContext context,
+    pfn_mcAllocate_CALLBACK pfnAllocate,
+    pfn_mcFree_CALLBACK pfnFree,
+    const void* userParam);
+
+/** @brief Specify a function that receives the intermediate states of sealed fragments.
+*
+* Subsequent dispatch calls seal the holes of fragments by stitching the polygons of cut-mesh patches into them one 
+* at a time. \p pfnCallback is called after each polygon is stitched with that polygon, which is the difference between 
+* the current state of the fragment and the previous one. Thus, starting from an unsealed fragment (i.e. 
+* ::MC_FRAGMENT_SEAL_TYPE_NONE), every partially sealed state up to the completely sealed fragment can be reconstructed 
+* from the stream of polygons without MCUT keeping a copy of each state. Polygons are only stitched for the sealed 
+* fragments that are requested with the dispatch flags (e.g. ::MC_DISPATCH_FILTER_FRAGMENT_SEALING_INSIDE). The partially 
+* sealed states are only available through the callback: the dispatch outputs only the completely sealed fragments as 
+* connected components.
+*
+* @param[in] context The context handle that was created by a previous call to mcCreateContext.
+* @param[in] pfnCallback The function that is called after each polygon is stitched, or NULL to disable the callback. 
+* @param[in] userParam A user supplied pointer that will be passed on each invocation of \p pfnCallback.
+*
+* @note The function waits for the dispatch calls that are enqueued on \p context to complete. The callback is not called 
+* concurrently, but ::mcDispatchBatch interleaves the polygons of different cut-meshes.
+*
+* @return Error code.
+*
+* <b>Error codes</b> 
+* - MC_NO_ERROR  
+*   -# proper exit 
+* - MC_INVALID_VALUE 
+*   -# \p pContext is NULL or \p pContext is not an existing context.
+*
+*/
+extern MCAPI_ATTR McResult MCAPI_CALL mcSetStitchingCallback(
+    McContext context,
+    pfn_mcStitching_CALLBACK pfnCallback,
+    const void* userParam);
+
 /**
 * Control the reporting of debug messages in a debug context.
 *
@@ -733,118 +972,639 @@ extern MCAPI_ATTR McResult MCAPI_CALL mcDispatch(
     uint32_t numCutMeshFaces);
 
 /**
-* @brief Return the value of a selected parameter.
-*
-* @param[in] context The context handle that was created by a previous call to ::mcCreateContext. 
-* @param[in] info Information object being queried. ::McQueryFlags
-* @param[in] bytes Size in bytes of memory pointed to by \p pMem. This size must be great than or equal to the return type size of data type queried.
-* @param[out] pMem Pointer to memory where the appropriate result being queried is returned. If \p pMem is NULL, it is ignored.
-* @param[out] pNumBytes returns the actual size in bytes of data being queried by info. If \p pNumBytes is NULL, it is ignored.
+* @brief Execute a cutting operation with one source mesh and multiple cut meshes.
 *
+* @param[in] context The context handle that was created by a previous call to ::mcCreateContext.
+* @param[in] flags The flags indicating how to interprete input data and configure the execution.
+* @param[in] pSrcMeshVertices The vertices (x,y,z) of the source mesh.
+* @param[in] pSrcMeshFaceIndices The indices of the faces (polygons) in the source mesh.
+* @param[in] pSrcMeshFaceSizes The sizes (in terms of vertex indices) of the faces in the source mesh.
+* @param[in] numSrcMeshVertices The number of vertices in the source mesh.
+* @param[in] numSrcMeshFaces The number of faces in the source mesh.
+* @param[in] numCutMeshes The number of cut meshes.
+* @param[in] ppCutMeshVertices The vertex arrays of the cut meshes (one pointer per cut mesh).
+* @param[in] ppCutMeshFaceIndices The face index arrays of the cut meshes (one pointer per cut mesh).
+* @param[in] ppCutMeshFaceSizes The face size arrays of the cut meshes (one pointer per cut mesh).
+* @param[in] pNumCutMeshVertices The number of vertices in each cut mesh.
+* @param[in] pNumCutMeshFaces The number of faces in each cut mesh.
+*
+* The result is the same as calling ::mcDispatch once for each cut mesh with the same source mesh, except that
+* the internal representation of the source mesh (and its bounding volume hierarchy) is built only once, and
+* the cut meshes are processed in parallel. The connected components of all the cuts are added to \p context, and
+* the cut mesh that produced a connected component is queried with MC_CONNECTED_COMPONENT_DATA_CUT_MESH_INDEX.
 *
  * An example of usage:
  * @code
- * uint64_t numBytes = 0;
- * McFlags contextFlags;
- * McResult err =  mcGetInfo(context, MC_CONTEXT_FLAGS, 0, nullptr, &numBytes);
- * if(err != MC_NO_ERROR)
- * {
- *  // deal with error
- * }
-*
- *   err = mcGetInfo(context, MC_CONTEXT_FLAGS, numBytes, &contextFlags, nullptr);
+ *  McResult err = mcDispatchBatch(
+ *       myContext,
+*        MC_DISPATCH_VERTEX_ARRAY_FLOAT,
+*        pSrcMeshVertices,
+*        pSrcMeshFaceIndices,
+*        pSrcMeshFaceSizes,
+*        numSrcMeshVertices,
+ *       numSrcMeshFaces,
+*        numCutMeshes,
+*        ppCutMeshVertices,
+*        ppCutMeshFaceIndices,
+*        ppCutMeshFaceSizes,
+*        pNumCutMeshVertices,
+*        pNumCutMeshFaces);
  * if(err != MC_NO_ERROR)
  * {
  *  // deal with error
  * }
  * @endcode
+* 
 * @return Error code.
 *
 * <b>Error codes</b> 
-* - MC_NO_ERROR  
+* - ::MC_NO_ERROR  
 *   -# proper exit 
-* - MC_INVALID_VALUE 
+* - ::MC_INVALID_VALUE 
 *   -# \p pContext is NULL or \p pContext is not an existing context.
-*   -# \p bytes is greater than the returned size of data type queried
+*   -# \p numCutMeshes is zero or one of the cut mesh arrays is NULL.
+* - Any other value
+*   -# An error code of ::mcDispatch, where the cut meshes are checked in order. The connected components of 
+*   the other cut meshes are still added to \p context.
+*/
+extern MCAPI_ATTR McResult MCAPI_CALL mcDispatchBatch(
+    McContext context,
+    McFlags flags,
+    const void* pSrcMeshVertices,
+    const uint32_t* pSrcMeshFaceIndices,
+    const uint32_t* pSrcMeshFaceSizes,
+    uint32_t numSrcMeshVertices,
+    uint32_t numSrcMeshFaces,
+    uint32_t numCutMeshes,
+    const void* const* ppCutMeshVertices,
+    const uint32_t* const* ppCutMeshFaceIndices,
+    const uint32_t* const* ppCutMeshFaceSizes,
+    const uint32_t* pNumCutMeshVertices,
+    const uint32_t* pNumCutMeshFaces);
+
+/**
+* @brief Find the pairs of faces (one from each mesh) that intersect, without cutting the meshes.
+*
+* @param[in] context The context handle that was created by a previous call to ::mcCreateContext.
+* @param[in] flags One of MC_DISPATCH_VERTEX_ARRAY_FLOAT or MC_DISPATCH_VERTEX_ARRAY_DOUBLE, which indicates how to interprete the vertex arrays.
+* @param[in] pSrcMeshVertices The vertices (x,y,z) of the source mesh.
+* @param[in] pSrcMeshFaceIndices The indices of the faces (polygons) in the source mesh.
+* @param[in] pSrcMeshFaceSizes The sizes (in terms of vertex indices) of the faces in the source mesh.
+* @param[in] numSrcMeshVertices The number of vertices in the source mesh.
+* @param[in] numSrcMeshFaces The number of faces in the source mesh.
+* @param[in] pCutMeshVertices The vertices (x,y,z) of the cut mesh.
+* @param[in] pCutMeshFaceIndices The indices of the faces (polygons) in the cut mesh.
+* @param[in] pCutMeshFaceSizes The sizes (in terms of vertex indices) of the faces in the cut mesh.
+* @param[in] numCutMeshVertices The number of vertices in the cut mesh.
+* @param[in] numCutMeshFaces The number of faces in the cut mesh.
+* @param[in] numFacePairs The number of intersecting face pairs after which the search stops, or zero to find all pairs.
+* @param[out] pFacePairs The intersecting face pairs (source mesh face, cut mesh face), which is an array of 2 x \p numFacePairs elements. May be NULL.
+* @param[out] pNumFacePairs The number of intersecting face pairs that were found. May be NULL.
+*
+* This function is much cheaper than ::mcDispatch when only the intersections are needed (e.g. to decide whether to 
+* cut at all): the faces that may intersect are found with the bounding volume hierarchies of the meshes, and are then 
+* tested exactly, where a pair of faces intersects if an edge of one face passes through (or touches) the other face. 
+* No polygons are clipped and no connected components are created. To test whether the meshes intersect at all, set 
+* \p numFacePairs to one, which stops the search at the first intersecting pair. The pairs are found in the same order 
+* on every call.
+*
+* @return Error code.
 *
-* @note Event synchronisation is not implemented.
+* <b>Error codes</b> 
+* - ::MC_NO_ERROR  
+*   -# proper exit 
+* - ::MC_INVALID_VALUE 
+*   -# \p pContext is NULL or \p pContext is not an existing context.
+*   -# \p flags does not specify exactly one floating-point type.
+*   -# \p pFacePairs is not NULL and \p numFacePairs is zero.
+*   -# \p pFacePairs and \p pNumFacePairs are NULL.
+*   -# A mesh is not valid (see ::mcDispatch).
 */
-extern MCAPI_ATTR McResult MCAPI_CALL mcGetInfo(
-    const McContext context,
-    McFlags info,
-    uint64_t bytes,
-    void* pMem,
-    uint64_t* pNumBytes);
+extern MCAPI_ATTR McResult MCAPI_CALL mcGetIntersectingFacePairs(
+    McContext context,
+    McFlags flags,
+    const void* pSrcMeshVertices,
+    const uint32_t* pSrcMeshFaceIndices,
+    const uint32_t* pSrcMeshFaceSizes,
+    uint32_t numSrcMeshVertices,
+    uint32_t numSrcMeshFaces,
+    const void* pCutMeshVertices,
+    const uint32_t* pCutMeshFaceIndices,
+    const uint32_t* pCutMeshFaceSizes,
+    uint32_t numCutMeshVertices,
+    uint32_t numCutMeshFaces,
+    uint32_t numFacePairs,
+    uint32_t* pFacePairs,
+    uint32_t* pNumFacePairs);
 
 /**
-* @brief Query the connected components available in a context.
-* 
-* This function will return an array of connected components matching the given description of flags.
-*  
-* @param[in] context The context handle
-* @param[in] connectedComponentType The type(s) of connected component sought. See also ::McConnectedComponentType.
-* @param[in] numEntries The number of ::McConnectedComponent entries that can be added to \p pConnComps. If \p pConnComps is not NULL, \p numEntries must be the number of elements in \p pConnComps.
-* @param[out] pConnComps Returns a list of connected components found. The ::McConnectedComponentType values returned in \p pConnComps can be used 
-* to identify a specific connected component. If \p pConnComps is NULL, this argument is ignored. The number of connected components returned 
-* is the minimum of the value specified by \p numEntries or the number of connected components whose type matches \p connectedComponentType.
-* @param[out] numConnComps Returns the number of connected components available that match \p connectedComponentType. If \p numConnComps is NULL, 
-* this argument is ignored.
+* @brief Create a mesh that can be used as the source mesh of many cutting operations.
 *
- * An example of usage:
- * @code
- * uint32_t numConnComps = 0;
- * McConnectedComponent* pConnComps;
- * McResult err =  err = mcGetConnectedComponents(myContext, MC_CONNECTED_COMPONENT_TYPE_ALL, 0, NULL, &numConnComps);
- * if(err != MC_NO_ERROR)
- * {
- *  // deal with error
- * }
- *
- * if (numConnComps == 0) {
- *    // ...
- * }
- *
- * pConnComps = (McConnectedComponent*)malloc(sizeof(McConnectedComponent) * numConnComps);
- *
- * err = mcGetConnectedComponents(myContext, MC_CONNECTED_COMPONENT_TYPE_ALL, numConnComps, pConnComps, NULL);
- * if(err != MC_NO_ERROR)
- * {
- *  // deal with error
- * }
- * @endcode
+* @param[in] context The context handle that was created by a previous call to ::mcCreateContext.
+* @param[in] flags One of MC_DISPATCH_VERTEX_ARRAY_FLOAT or MC_DISPATCH_VERTEX_ARRAY_DOUBLE, which indicates how to interprete \p pVertices.
+* @param[in] pVertices The vertices (x,y,z) of the mesh.
+* @param[in] pFaceIndices The indices of the faces (polygons) in the mesh.
+* @param[in] pFaceSizes The sizes (in terms of vertex indices) of the faces in the mesh.
+* @param[in] numVertices The number of vertices in the mesh.
+* @param[in] numFaces The number of faces in the mesh.
+* @param[out] pMesh Returns the handle of the mesh.
+*
+* The mesh is checked and converted into the internal representation of MCUT (with its bounding volume hierarchy) 
+* when it is created, which ::mcDispatch otherwise does with the source mesh on every call. The arrays are not 
+* referenced after this function returns. A mesh belongs to \p context and is released with ::mcReleaseMeshes or 
+* when \p context is released.
 *
 * @return Error code.
 *
 * <b>Error codes</b> 
-* - MC_NO_ERROR  
+* - ::MC_NO_ERROR  
 *   -# proper exit 
-* - MC_INVALID_VALUE 
+* - ::MC_INVALID_VALUE 
 *   -# \p pContext is NULL or \p pContext is not an existing context.
-*   -# \p connectedComponentType is not a value in ::McConnectedComponentType.
-*   -# \p numConnComps and \p pConnComps are both NULL.
-*   -# \p numConnComps is zero and \p pConnComps is not NULL.
+*   -# \p pMesh is NULL.
+*   -# \p flags does not specify exactly one floating-point type.
+*   -# The mesh is not valid (see ::mcDispatch).
 */
-extern MCAPI_ATTR McResult MCAPI_CALL mcGetConnectedComponents(
-    const McContext context,
-    const McConnectedComponentType connectedComponentType,
-    const uint32_t numEntries,
-    McConnectedComponent* pConnComps,
-    uint32_t* numConnComps);
+extern MCAPI_ATTR McResult MCAPI_CALL mcCreateMesh(
+    McContext context,
+    McFlags flags,
+    const void* pVertices,
+    const uint32_t* pFaceIndices,
+    const uint32_t* pFaceSizes,
+    uint32_t numVertices,
+    uint32_t numFaces,
+    McMesh* pMesh);
 
 /**
-* @brief Query specific information about a connected component.
+* @brief Replace the geometry of a mesh that was created with ::mcCreateMesh.
 *
-* @param[in] context The context handle that was created by a previous call to ::mcCreateContext. 
-* @param[in] connCompId A connected component returned by ::mcGetConnectedComponents whose data is to be read.
-* @param[in] flags An enumeration constant that identifies the connected component information being queried.
-* @param[in] bytes Specifies the size in bytes of memory pointed to by \p flags.
-* @param[out] pMem A pointer to memory location where appropriate values for a given \p flags will be returned. If \p pMem is NULL, it is ignored.
-* @param[out] pNumBytes Returns the actual size in bytes of data being queried by \p flags. If \p pNumBytes is NULL, it is ignored.
+* @param[in] context The context handle that was created by a previous call to ::mcCreateContext.
+* @param[in] mesh The mesh to update.
+* @param[in] flags One of MC_DISPATCH_VERTEX_ARRAY_FLOAT or MC_DISPATCH_VERTEX_ARRAY_DOUBLE, which indicates how to interprete \p pVertices.
+* @param[in] pVertices The new vertices (x,y,z) of the mesh.
+* @param[in] pFaceIndices The new indices of the faces (polygons) in the mesh.
+* @param[in] pFaceSizes The new sizes (in terms of vertex indices) of the faces in the mesh.
+* @param[in] numVertices The new number of vertices in the mesh.
+* @param[in] numFaces The new number of faces in the mesh.
 *
-* The connected component queries described in the ::McConnectedComponentInfo should return the same information for a connected component returned by ::mcGetConnectedComponents.
+* The handle remains the same, and the following cutting operations use the new geometry. The transform of the mesh 
+* (see ::mcSetMeshTransform) is reset to the identity. The mesh is unchanged if an error is returned.
 *
- * An example of usage:
- * @code
+* @return Error code.
+*
+* <b>Error codes</b> 
+* - ::MC_NO_ERROR  
+*   -# proper exit 
+* - ::MC_INVALID_VALUE 
+*   -# \p pContext is NULL or \p pContext is not an existing context.
+*   -# \p mesh is not a mesh of \p context.
+*   -# \p flags does not specify exactly one floating-point type.
+*   -# The mesh is not valid (see ::mcDispatch).
+*/
+extern MCAPI_ATTR McResult MCAPI_CALL mcUpdateMesh(
+    McContext context,
+    McMesh mesh,
+    McFlags flags,
+    const void* pVertices,
+    const uint32_t* pFaceIndices,
+    const uint32_t* pFaceSizes,
+    uint32_t numVertices,
+    uint32_t numFaces);
+
+/**
+* @brief Move the vertices of a mesh that was created with ::mcCreateMesh, without changing its faces.
+*
+* @param[in] context The context handle that was created by a previous call to ::mcCreateContext.
+* @param[in] mesh The mesh to update.
+* @param[in] flags One of MC_DISPATCH_VERTEX_ARRAY_FLOAT or MC_DISPATCH_VERTEX_ARRAY_DOUBLE, which indicates how to interprete \p pVertices.
+* @param[in] pVertices The new vertices (x,y,z) of the mesh, whose number and order are those of the vertices that the mesh was created (or last updated) with.
+*
+* This function is cheaper than ::mcUpdateMesh for a mesh that deforms or moves between cuts: the bounding boxes of 
+* the bounding volume hierarchy of the mesh are updated bottom-up (i.e. refitted) instead of being rebuilt. The 
+* hierarchy is rebuilt once refitting has made it too costly to traverse (for example after large deformations).
+* If the mesh has a transform (see ::mcSetMeshTransform), then it is applied to \p pVertices.
+*
+* @return Error code.
+*
+* <b>Error codes</b> 
+* - ::MC_NO_ERROR  
+*   -# proper exit 
+* - ::MC_INVALID_VALUE 
+*   -# \p pContext is NULL or \p pContext is not an existing context.
+*   -# \p mesh is not a mesh of \p context.
+*   -# \p flags does not specify exactly one floating-point type.
+*   -# \p pVertices is NULL.
+*/
+extern MCAPI_ATTR McResult MCAPI_CALL mcRefitMesh(
+    McContext context,
+    McMesh mesh,
+    McFlags flags,
+    const void* pVertices);
+
+/**
+* @brief Set the transform of a mesh that was created with ::mcCreateMesh (e.g. to move a rigid body between cuts).
+*
+* @param[in] context The context handle that was created by a previous call to ::mcCreateContext.
+* @param[in] mesh The mesh to transform.
+* @param[in] pTransform A 4x4 affine transformation matrix in row-major order, or NULL for the identity.
+*
+* The vertices of the mesh become the vertices that it was created with (or that were last passed to ::mcUpdateMesh 
+* or ::mcRefitMesh) transformed by \p pTransform. Transforms are not accumulated: each call replaces the previous 
+* transform. The transform is applied lazily: a mesh that is only used as the cut mesh of ::mcDispatchMeshes (e.g. a 
+* tool that is moved between cuts) keeps its bounding volume hierarchy, which is traversed with the transform, and its 
+* vertices are transformed only if the meshes may intersect. Once a mesh is cut as a source mesh, its vertices are 
+* moved and its bounding volume hierarchy is refitted as with ::mcRefitMesh.
+*
+* @return Error code.
+*
+* <b>Error codes</b> 
+* - ::MC_NO_ERROR  
+*   -# proper exit 
+* - ::MC_INVALID_VALUE 
+*   -# \p pContext is NULL or \p pContext is not an existing context.
+*   -# \p mesh is not a mesh of \p context.
+*   -# The last row of \p pTransform is not (0, 0, 0, 1).
+*/
+extern MCAPI_ATTR McResult MCAPI_CALL mcSetMeshTransform(
+    McContext context,
+    McMesh mesh,
+    const double* pTransform);
+
+/**
+* @brief Execute a cutting operation with a source mesh that was created with ::mcCreateMesh, and a cut mesh.
+*
+* @param[in] context The context handle that was created by a previous call to ::mcCreateContext.
+* @param[in] flags The flags indicating how to interprete the cut mesh data, and configure the execution.
+* @param[in] srcMesh The source mesh.
+* @param[in] pCutMeshVertices The vertices (x,y,z) of the cut mesh.
+* @param[in] pCutMeshFaceIndices The indices of the faces (polygons) in the cut mesh.
+* @param[in] pCutMeshFaceSizes The sizes (in terms of vertex indices) of the faces in the cut mesh.
+* @param[in] numCutMeshVertices The number of vertices in the cut mesh.
+* @param[in] numCutMeshFaces The number of faces in the cut mesh.
+*
+* The result is the same as calling ::mcDispatch with the arrays of \p srcMesh, except that the source mesh is not 
+* checked or converted again (and its bounding volume hierarchy is not rebuilt), which makes repeated cuts of the 
+* same source mesh cheaper. \p srcMesh is not modified by the cut.
+*
+* @return Error code.
+*
+* <b>Error codes</b> 
+* - ::MC_NO_ERROR  
+*   -# proper exit 
+* - ::MC_INVALID_VALUE 
+*   -# \p pContext is NULL or \p pContext is not an existing context.
+*   -# \p srcMesh is not a mesh of \p context.
+* - Any other value
+*   -# An error code of ::mcDispatch.
+*/
+extern MCAPI_ATTR McResult MCAPI_CALL mcDispatchMesh(
+    McContext context,
+    McFlags flags,
+    McMesh srcMesh,
+    const void* pCutMeshVertices,
+    const uint32_t* pCutMeshFaceIndices,
+    const uint32_t* pCutMeshFaceSizes,
+    uint32_t numCutMeshVertices,
+    uint32_t numCutMeshFaces);
+
+/**
+* @brief Execute a cutting operation with a source mesh and a cut mesh that were created with ::mcCreateMesh, where the cut mesh is placed by a transform.
+*
+* @param[in] context The context handle that was created by a previous call to ::mcCreateContext.
+* @param[in] flags The flags configuring the execution (the floating-point type flags are not required).
+* @param[in] srcMesh The source mesh.
+* @param[in] cutMesh The cut mesh.
+* @param[in] pCutMeshTransform A 4x4 affine transformation matrix in row-major order that is applied to the vertices of \p cutMesh, or NULL for the identity.
+*
+* This function is intended for cutting with the same (tool) mesh at many poses: neither mesh is checked, converted 
+* or has its bounding volume hierarchy rebuilt. The bounding volume hierarchy of \p cutMesh is traversed in its own 
+* frame with transformed bounding boxes, and its vertices are transformed only if the meshes may intersect. The result is 
+* the same as calling ::mcDispatch with the arrays of \p srcMesh and the transformed arrays of \p cutMesh. Neither mesh is 
+* modified (the transform of \p cutMesh that is set with ::mcSetMeshTransform is applied before \p pCutMeshTransform).
+*
+* @return Error code.
+*
+* <b>Error codes</b> 
+* - ::MC_NO_ERROR  
+*   -# proper exit 
+* - ::MC_INVALID_VALUE 
+*   -# \p pContext is NULL or \p pContext is not an existing context.
+*   -# \p srcMesh or \p cutMesh is not a mesh of \p context.
+*   -# The last row of \p pCutMeshTransform is not (0, 0, 0, 1).
+* - Any other value
+*   -# An error code of ::mcDispatch.
+*/
+extern MCAPI_ATTR McResult MCAPI_CALL mcDispatchMeshes(
+    McContext context,
+    McFlags flags,
+    McMesh srcMesh,
+    McMesh cutMesh,
+    const double* pCutMeshTransform);
+
+/**
+* @brief Enqueue a cutting operation with two meshes - the source mesh, and the cut mesh - and return without waiting for it to execute.
+*
+* @param[in] context The context handle that was created by a previous call to ::mcCreateContext.
+* @param[in] flags The flags indicating how to interprete input data and configure the execution.
+* @param[in] pSrcMeshVertices The vertices (x,y,z) of the source mesh.
+* @param[in] pSrcMeshFaceIndices The indices of the faces (polygons) in the source mesh.
+* @param[in] pSrcMeshFaceSizes The sizes (in terms of vertex indices) of the faces in the source mesh.
+* @param[in] numSrcMeshVertices The number of vertices in the source mesh.
+* @param[in] numSrcMeshFaces The number of faces in the source mesh.
+* @param[in] pCutMeshVertices The vertices (x,y,z) of the cut mesh.
+* @param[in] pCutMeshFaceIndices The indices of the faces (polygons) in the cut mesh.
+* @param[in] pCutMeshFaceSizes The sizes (in terms of vertex indices) of the faces in the cut mesh.
+* @param[in] numCutMeshVertices The number of vertices in the cut mesh.
+* @param[in] numCutMeshFaces The number of faces in the cut mesh.
+* @param[out] pEvent Returns an event that identifies the enqueued dispatch. If \p pEvent is NULL, it is ignored.
+*
+* This function is the asynchronous counterpart of ::mcDispatch. The dispatch is executed on a thread that is owned by 
+* \p context, and dispatches that are enqueued on the same context execute one after the other in the order that they were enqueued. 
+* A call to ::mcDispatch on the same context executes after all the previously enqueued dispatches have completed. Likewise, the 
+* functions that change the state of \p context (e.g. ::mcSetRoundingMode, ::mcDebugMessageCallback or ::mcReleaseConnectedComponents) 
+* wait for the enqueued dispatches to complete before returning. The functions that query connected components (e.g. 
+* ::mcGetConnectedComponents and ::mcGetConnectedComponentData) do not wait: they can be called while dispatches are enqueued, 
+* and see the connected components of the dispatches that have completed. The error code of the dispatch is queried with 
+* ::mcGetEventInfo once the dispatch is complete.
+*
+ * An example of usage:
+ * @code
+ *  McEvent dispatchEvent = MC_NULL_HANDLE;
+ *  McResult err = mcEnqueueDispatch(
+ *       myContext,
+*        MC_DISPATCH_VERTEX_ARRAY_FLOAT,
+*        pSrcMeshVertices,
+*        pSrcMeshFaceIndices,
+*        pSrcMeshFaceSizes,
+*        numSrcMeshVertices,
+ *       numSrcMeshFaces,
+*        pCutMeshVertices,
+*        pCutMeshFaceIndices,
+*        pCutMeshFaceSizes,
+*        numCutMeshVertices,
+*        numCutMeshFaces,
+*        &dispatchEvent);
+ * if(err != MC_NO_ERROR)
+ * {
+ *  // deal with error
+ * }
+ *
+ * // ... do other work
+ *
+ * err = mcWaitForEvents(1, &dispatchEvent);
+ * if(err != MC_NO_ERROR)
+ * {
+ *  // deal with error (e.g. failed dispatch)
+ * }
+ *
+ * mcReleaseEvents(1, &dispatchEvent);
+ * @endcode
+* 
+* @return Error code.
+*
+* <b>Error codes</b> 
+* - ::MC_NO_ERROR  
+*   -# proper exit 
+* - ::MC_INVALID_VALUE 
+*   -# \p pContext is NULL or \p pContext is not an existing context.
+*
+* @note The input arrays are read when the dispatch executes, so they must remain valid until the dispatch is complete. Likewise, the 
+* connected components of \p context must not be queried or released until the dispatch is complete.
+* @note Without multi-threading (see MCUT_BUILD_WITH_THREADS), the dispatch is executed before this function returns.
+*/
+extern MCAPI_ATTR McResult MCAPI_CALL mcEnqueueDispatch(
+    McContext context,
+    McFlags flags,
+    const void* pSrcMeshVertices,
+    const uint32_t* pSrcMeshFaceIndices,
+    const uint32_t* pSrcMeshFaceSizes,
+    uint32_t numSrcMeshVertices,
+    uint32_t numSrcMeshFaces,
+    const void* pCutMeshVertices,
+    const uint32_t* pCutMeshFaceIndices,
+    const uint32_t* pCutMeshFaceSizes,
+    uint32_t numCutMeshVertices,
+    uint32_t numCutMeshFaces,
+    McEvent* pEvent);
+
+/**
+* @brief Wait until the commands associated with a list of events are complete.
+*
+* This function returns after the callbacks of the events (see ::mcSetEventCallback) have been called.
+*
+* @param[in] numEvents The number of events in \p pEventList.
+* @param[in] pEventList The events to wait on.
+*
+ * An example of usage:
+ * @code
+ * McResult err = mcWaitForEvents(numEvents, pEvents);
+ * if(err != MC_NO_ERROR)
+ * {
+ *  // deal with error
+ * }
+ * @endcode
+*
+* @return Error code.
+*
+* <b>Error codes</b> 
+* - MC_NO_ERROR  
+*   -# proper exit 
+* - MC_INVALID_VALUE 
+*   -# \p pEventList is NULL or \p numEvents is zero.
+*   -# An event in \p pEventList is not an existing event.
+* - Any other value
+*   -# The error code of the first command in \p pEventList that failed (see MC_EVENT_RUNTIME_EXECUTION_STATUS).
+*/
+extern MCAPI_ATTR McResult MCAPI_CALL mcWaitForEvents(
+    uint32_t numEvents,
+    const McEvent* pEventList);
+
+/**
+* @brief Return information about an event.
+*
+* @param[in] event The event being queried.
+* @param[in] info Information being queried. ::McEventInfo
+* @param[in] bytes Size in bytes of memory pointed to by \p pMem. This size must be great than or equal to the return type size of data type queried.
+* @param[out] pMem Pointer to memory where the appropriate result being queried is returned. If \p pMem is NULL, it is ignored.
+* @param[out] pNumBytes returns the actual size in bytes of data being queried by info. If \p pNumBytes is NULL, it is ignored.
+*
+* Querying MC_EVENT_COMMAND_EXECUTION_STATUS does not block, so it can be used to poll for the completion of a command.
+*
+ * An example of usage:
+ * @code
+ * McEventCommandExecStatus status;
+ * McResult err = mcGetEventInfo(dispatchEvent, MC_EVENT_COMMAND_EXECUTION_STATUS, sizeof(McEventCommandExecStatus), &status, NULL);
+ * if(err != MC_NO_ERROR)
+ * {
+ *  // deal with error
+ * }
+ * @endcode
+* @return Error code.
+*
+* <b>Error codes</b> 
+* - MC_NO_ERROR  
+*   -# proper exit 
+* - MC_INVALID_VALUE 
+*   -# \p event is NULL or \p event is not an existing event.
+*   -# \p info is not a value in ::McEventInfo.
+*   -# \p bytes is greater than the returned size of data type queried
+*/
+extern MCAPI_ATTR McResult MCAPI_CALL mcGetEventInfo(
+    const McEvent event,
+    McFlags info,
+    uint64_t bytes,
+    void* pMem,
+    uint64_t* pNumBytes);
+
+/**
+* @brief Specify a callback to be called when the command associated with an event is complete.
+*
+* @param[in] event The event to which the callback is attached.
+* @param[in] eventCallback The callback function.
+* @param[in] data User data that is passed to \p eventCallback.
+*
+* Multiple callbacks can be attached to an event, and they are called in the order that they were attached. If the command is already complete, 
+* \p eventCallback is called before this function returns. Otherwise, it is called by the thread that executes the command, so it should 
+* return quickly and must not wait on events of (or release) the same context.
+*
+ * An example of usage:
+ * @code
+ * McResult err = mcSetEventCallback(dispatchEvent, myEventCallback, myData);
+ * if(err != MC_NO_ERROR)
+ * {
+ *  // deal with error
+ * }
+ * @endcode
+*
+* @return Error code.
+*
+* <b>Error codes</b> 
+* - MC_NO_ERROR  
+*   -# proper exit 
+* - MC_INVALID_VALUE 
+*   -# \p event is NULL or \p event is not an existing event.
+*   -# \p eventCallback is NULL.
+*/
+extern MCAPI_ATTR McResult MCAPI_CALL mcSetEventCallback(
+    McEvent event,
+    pfn_McEvent_CALLBACK eventCallback,
+    void* data);
+
+/**
+* @brief Return the value of a selected parameter.
+*
+* @param[in] context The context handle that was created by a previous call to ::mcCreateContext. 
+* @param[in] info Information object being queried. ::McQueryFlags
+* @param[in] bytes Size in bytes of memory pointed to by \p pMem. This size must be great than or equal to the return type size of data type queried.
+* @param[out] pMem Pointer to memory where the appropriate result being queried is returned. If \p pMem is NULL, it is ignored.
+* @param[out] pNumBytes returns the actual size in bytes of data being queried by info. If \p pNumBytes is NULL, it is ignored.
+*
+*
+ * An example of usage:
+ * @code
+ * uint64_t numBytes = 0;
+ * McFlags contextFlags;
+ * McResult err =  mcGetInfo(context, MC_CONTEXT_FLAGS, 0, nullptr, &numBytes);
+ * if(err != MC_NO_ERROR)
+ * {
+ *  // deal with error
+ * }
+*
+ *   err = mcGetInfo(context, MC_CONTEXT_FLAGS, numBytes, &contextFlags, nullptr);
+ * if(err != MC_NO_ERROR)
+ * {
+ *  // deal with error
+ * }
+ * @endcode
+* @return Error code.
+*
+* <b>Error codes</b> 
+* - MC_NO_ERROR  
+*   -# proper exit 
+* - MC_INVALID_VALUE 
+*   -# \p pContext is NULL or \p pContext is not an existing context.
+*   -# \p bytes is greater than the returned size of data type queried
+*
+*/
+extern MCAPI_ATTR McResult MCAPI_CALL mcGetInfo(
+    const McContext context,
+    McFlags info,
+    uint64_t bytes,
+    void* pMem,
+    uint64_t* pNumBytes);
+
+/**
+* @brief Query the connected components available in a context.
+* 
+* This function will return an array of connected components matching the given description of flags.
+*  
+* @param[in] context The context handle
+* @param[in] connectedComponentType The type(s) of connected component sought. See also ::McConnectedComponentType.
+* @param[in] numEntries The number of ::McConnectedComponent entries that can be added to \p pConnComps. If \p pConnComps is not NULL, \p numEntries must be the number of elements in \p pConnComps.
+* @param[out] pConnComps Returns a list of connected components found. The ::McConnectedComponentType values returned in \p pConnComps can be used 
+* to identify a specific connected component. If \p pConnComps is NULL, this argument is ignored. The number of connected components returned 
+* is the minimum of the value specified by \p numEntries or the number of connected components whose type matches \p connectedComponentType.
+* @param[out] numConnComps Returns the number of connected components available that match \p connectedComponentType. If \p numConnComps is NULL, 
+* this argument is ignored.
+*
+ * An example of usage:
+ * @code
+ * uint32_t numConnComps = 0;
+ * McConnectedComponent* pConnComps;
+ * McResult err =  err = mcGetConnectedComponents(myContext, MC_CONNECTED_COMPONENT_TYPE_ALL, 0, NULL, &numConnComps);
+ * if(err != MC_NO_ERROR)
+ * {
+ *  // deal with error
+ * }
+ *
+ * if (numConnComps == 0) {
+ *    // ...
+ * }
+ *
+ * pConnComps = (McConnectedComponent*)malloc(sizeof(McConnectedComponent) * numConnComps);
+ *
+ * err = mcGetConnectedComponents(myContext, MC_CONNECTED_COMPONENT_TYPE_ALL, numConnComps, pConnComps, NULL);
+ * if(err != MC_NO_ERROR)
+ * {
+ *  // deal with error
+ * }
+ * @endcode
+*
+* @return Error code.
+*
+* <b>Error codes</b> 
+* - MC_NO_ERROR  
+*   -# proper exit 
+* - MC_INVALID_VALUE 
+*   -# \p pContext is NULL or \p pContext is not an existing context.
+*   -# \p connectedComponentType is not a value in ::McConnectedComponentType.
+*   -# \p numConnComps and \p pConnComps are both NULL.
+*   -# \p numConnComps is zero and \p pConnComps is not NULL.
+*/
+extern MCAPI_ATTR McResult MCAPI_CALL mcGetConnectedComponents(
+    const McContext context,
+    const McConnectedComponentType connectedComponentType,
+    const uint32_t numEntries,
+    McConnectedComponent* pConnComps,
+    uint32_t* numConnComps);
+
+/**
+* @brief Query specific information about a connected component.
+*
+* @param[in] context The context handle that was created by a previous call to ::mcCreateContext. 
+* @param[in] connCompId A connected component returned by ::mcGetConnectedComponents whose data is to be read.
+* @param[in] flags An enumeration constant that identifies the connected component information being queried.
+* @param[in] bytes Specifies the size in bytes of memory pointed to by \p flags.
+* @param[out] pMem A pointer to memory location where appropriate values for a given \p flags will be returned. If \p pMem is NULL, it is ignored.
+* @param[out] pNumBytes Returns the actual size in bytes of data being queried by \p flags. If \p pNumBytes is NULL, it is ignored.
+*
+* The connected component queries described in the ::McConnectedComponentInfo should return the same information for a connected component returned by ::mcGetConnectedComponents.
+*
+* The data of a connected component is prepared when the connected component is first queried, so the first 
+* call may take longer than the following ones. Connected components that are never queried do not incur this cost.
+*
+ * An example of usage:
+ * @code
  * uint64_t numBytes = 0;
  * McResult err = mcGetConnectedComponentData(myContext,  connCompId, MC_CONNECTED_COMPONENT_DATA_VERTEX_DOUBLE, 0, NULL, &numBytes);
  * if(err != MC_NO_ERROR)
@@ -873,6 +1633,7 @@ extern MCAPI_ATTR McResult MCAPI_CALL mcGetConnectedComponents(
 *   -# \p bytes is zero and \p pMem is not NULL.
 *   -# \p flag is MC_CONNECTED_COMPONENT_DATA_VERTEX_MAP when \p context dispatch flags did not include flag MC_DISPATCH_INCLUDE_VERTEX_MAP
 *   -# \p flag is MC_CONNECTED_COMPONENT_DATA_FACE_MAP when \p context dispatch flags did not include flag MC_DISPATCH_INCLUDE_FACE_MAP
+*   -# \p flag is MC_CONNECTED_COMPONENT_DATA_FACE_TRIANGULATION_MAP when \p context dispatch flags did not include flag MC_DISPATCH_INCLUDE_FACE_MAP
 */
 extern MCAPI_ATTR McResult MCAPI_CALL mcGetConnectedComponentData(
     const McContext context,
@@ -882,6 +1643,136 @@ extern MCAPI_ATTR McResult MCAPI_CALL mcGetConnectedComponentData(
     void* pMem,
     uint64_t* pNumBytes);
 
+/**
+* @brief Access the data of a connected component without copying it.
+*
+* @param[in] context The context handle that was created by a previous call to ::mcCreateContext. 
+* @param[in] connCompId A connected component returned by ::mcGetConnectedComponents whose data is to be read.
+* @param[in] flags An enumeration constant that identifies the connected component data being mapped.
+* @param[out] ppMem Returns a read-only pointer to the data, which is NULL if the data is empty.
+* @param[out] pNumBytes Returns the size in bytes of the data. If \p pNumBytes is NULL, it is ignored.
+*
+* The pointer that is returned in \p ppMem refers to memory that is owned by MCUT (see also ::mcSetConnectedComponentAllocator),
+* and remains valid until the data is unmapped with ::mcUnmapConnectedComponentData or the connected component is released. 
+* The data has the same layout as that returned by ::mcGetConnectedComponentData for the same \p flags, which must be one of 
+* MC_CONNECTED_COMPONENT_DATA_VERTEX_FLOAT, MC_CONNECTED_COMPONENT_DATA_VERTEX_DOUBLE, MC_CONNECTED_COMPONENT_DATA_FACE, 
+* MC_CONNECTED_COMPONENT_DATA_FACE_SIZE, MC_CONNECTED_COMPONENT_DATA_EDGE, MC_CONNECTED_COMPONENT_DATA_SEAM_VERTEX, 
+* MC_CONNECTED_COMPONENT_DATA_VERTEX_MAP, MC_CONNECTED_COMPONENT_DATA_FACE_MAP, MC_CONNECTED_COMPONENT_DATA_FACE_TRIANGULATION
+* or MC_CONNECTED_COMPONENT_DATA_FACE_TRIANGULATION_MAP.
+*
+* @note MC_CONNECTED_COMPONENT_DATA_VERTEX_FLOAT (and MC_CONNECTED_COMPONENT_DATA_VERTEX_DOUBLE when MCUT is built with 
+* arbitrary-precision numbers) is converted from the internal vertex array when it is first mapped. Likewise, the faces are 
+* triangulated when MC_CONNECTED_COMPONENT_DATA_FACE_TRIANGULATION (or MC_CONNECTED_COMPONENT_DATA_FACE_TRIANGULATION_MAP) 
+* is first queried or mapped.
+*
+ * An example of usage:
+ * @code
+ * const void* pMem = NULL;
+ * uint64_t numBytes = 0;
+ * McResult err = mcMapConnectedComponentData(myContext, connCompId, MC_CONNECTED_COMPONENT_DATA_FACE, &pMem, &numBytes);
+ * if(err != MC_NO_ERROR)
+ * {
+ *  // deal with error
+ * }
+ *
+ * const uint32_t* pFaceIndices = (const uint32_t*)pMem;
+ * 
+ * // ... 
+ *
+ * err = mcUnmapConnectedComponentData(myContext, connCompId, MC_CONNECTED_COMPONENT_DATA_FACE);
+ * @endcode
+ * 
+* @return Error code.
+*
+* <b>Error codes</b> 
+* - MC_NO_ERROR  
+*   -# proper exit 
+* - MC_INVALID_VALUE 
+*   -# \p pContext is NULL or \p pContext is not an existing context.
+*   -# \p connCompId is not a valid connected component handle.
+*   -# \p flags is not a valid flag for mapping.
+*   -# \p ppMem is NULL.
+* - MC_OUT_OF_MEMORY
+*   -# The data of the connected component could not be allocated.
+*/
+extern MCAPI_ATTR McResult MCAPI_CALL mcMapConnectedComponentData(
+    McContext context,
+    McConnectedComponent connCompId,
+    McFlags flags,
+    const void** ppMem,
+    uint64_t* pNumBytes);
+
+/**
+* @brief Finish accessing the data of a connected component that was mapped with ::mcMapConnectedComponentData.
+*
+* @param[in] context The context handle that was created by a previous call to ::mcCreateContext. 
+* @param[in] connCompId A connected component returned by ::mcGetConnectedComponents.
+* @param[in] flags The flags that were used to map the data.
+*
+* Any pointer that was returned by ::mcMapConnectedComponentData for \p connCompId and \p flags is invalid after this
+* function returns. Memory that was allocated only for mapping (i.e. converted vertex arrays) is freed.
+*
+* @return Error code.
+*
+* <b>Error codes</b> 
+* - MC_NO_ERROR  
+*   -# proper exit 
+* - MC_INVALID_VALUE 
+*   -# \p pContext is NULL or \p pContext is not an existing context.
+*   -# \p connCompId is not a valid connected component handle.
+*   -# \p flags is not a valid flag for mapping.
+*/
+extern MCAPI_ATTR McResult MCAPI_CALL mcUnmapConnectedComponentData(
+    McContext context,
+    McConnectedComponent connCompId,
+    McFlags flags);
+
+/**
+* @brief Query the data of multiple connected components at once.
+*
+* @param[in] context The context handle that was created by a previous call to ::mcCreateContext. 
+* @param[in] numConnComps The number of connected components in \p pConnComps.
+* @param[in] pConnComps Connected components returned by ::mcGetConnectedComponents whose data is to be read.
+* @param[in] flags Bitwise OR of the ::McConnectedComponentData arrays to return (see ::mcMapConnectedComponentData for the 
+* valid flags). The count flags are also accepted, but the counts are always returned.
+* @param[out] pDescs An array of \p numConnComps descriptors, which returns the data of the connected component with the same index in \p pConnComps.
+*
+* This function is equivalent to calling ::mcMapConnectedComponentData with each flag in \p flags for each connected component, 
+* and the returned arrays are valid until they are unmapped with ::mcUnmapConnectedComponentData or the connected components are released.
+* Connected components whose data has not yet been prepared (see ::mcGetConnectedComponentData) are prepared in parallel.
+* MC_CONNECTED_COMPONENT_DATA_SEAM_VERTEX is ignored for input connected components.
+*
+ * An example of usage:
+ * @code
+ * std::vector<McConnectedComponentDataDesc> descs(numConnComps);
+ * McResult err = mcGetConnectedComponentsData(myContext, numConnComps, pConnComps, 
+ *     MC_CONNECTED_COMPONENT_DATA_VERTEX_DOUBLE | MC_CONNECTED_COMPONENT_DATA_FACE | MC_CONNECTED_COMPONENT_DATA_FACE_SIZE, &descs[0]);
+ * if(err != MC_NO_ERROR)
+ * {
+ *  // deal with error
+ * }
+ * @endcode
+ * 
+* @return Error code.
+*
+* <b>Error codes</b> 
+* - MC_NO_ERROR  
+*   -# proper exit 
+* - MC_INVALID_VALUE 
+*   -# \p pContext is NULL or \p pContext is not an existing context.
+*   -# \p pConnComps or \p pDescs is NULL and \p numConnComps is not zero.
+*   -# \p pConnComps contains an invalid connected component handle.
+*   -# \p flags contains a flag that is not valid for mapping.
+* - MC_OUT_OF_MEMORY
+*   -# The data of a connected component could not be allocated.
+*/
+extern MCAPI_ATTR McResult MCAPI_CALL mcGetConnectedComponentsData(
+    McContext context,
+    uint32_t numConnComps,
+    const McConnectedComponent* pConnComps,
+    McFlags flags,
+    McConnectedComponentDataDesc* pDescs);
+
 /**
 * @brief To release the memory of a connected component, call this function.
 *
@@ -917,10 +1808,65 @@ extern MCAPI_ATTR McResult MCAPI_CALL mcReleaseConnectedComponents(
     uint32_t numConnComps,
     const McConnectedComponent* pConnComps);
 
+/**
+* @brief To release the memory of meshes that were created with ::mcCreateMesh, call this function.
+*
+* If \p numMeshes is zero and \p pMeshes is NULL, all meshes of the context are released.
+*
+* @param[in] context The context handle that was created by a previous call to ::mcCreateContext.
+* @param[in] numMeshes Number of meshes in \p pMeshes.
+* @param[in] pMeshes The meshes to release.
+*
+* @return Error code.
+*
+* <b>Error codes</b> 
+* - MC_NO_ERROR  
+*   -# proper exit 
+* - MC_INVALID_VALUE 
+*   -# \p pContext is NULL or \p pContext is not an existing context.
+*   -# \p numMeshes is zero and \p pMeshes is not NULL (and vice versa).
+*   -# An element of \p pMeshes is not a mesh of \p context.
+*/
+extern MCAPI_ATTR McResult MCAPI_CALL mcReleaseMeshes(
+    const McContext context,
+    uint32_t numMeshes,
+    const McMesh* pMeshes);
+
+/**
+* @brief To release the memory of a list of events, call this function.
+*
+* An event can be released before its command is complete, in which case the command still executes (and its callbacks are called).
+*
+* @param[in] numEvents Number of events in \p pEvents.
+* @param[in] pEvents The events to release.
+*
+ * An example of usage:
+ * @code
+ * McResult err = mcReleaseEvents(numEvents, pEvents);
+ * if(err != MC_NO_ERROR)
+ * {
+ *  // deal with error
+ * }
+ * @endcode
+*
+* @return Error code.
+*
+* <b>Error codes</b> 
+* - MC_NO_ERROR  
+*   -# proper exit 
+* - MC_INVALID_VALUE 
+*   -# \p pEvents is NULL or \p numEvents is zero.
+*   -# An event in \p pEvents is not an existing event.
+*/
+extern MCAPI_ATTR McResult MCAPI_CALL mcReleaseEvents(
+    uint32_t numEvents,
+    const McEvent* pEvents);
+
 /**
 * @brief To release the memory of a context, call this function.
 *
 * This function ensures that all the state attached to context (such as unreleased connected components) are released, and the memory is deleted.
+* Dispatches that are still enqueued on the context are executed before the context is released.
 *
 * @param[in] context The context handle that was created by a previous call to ::mcCreateContext. 
 *
@@ -418,6 +418,137 @@ namespace geom {
         }
     }
 
+    void triangulate_polygon(
+        std::vector<int>& triangle_indices,
+        const math::vec3* polygon_vertices,
+        const int polygon_vertex_count)
+    {
+        MCUT_ASSERT(polygon_vertex_count >= 3);
+
+        if (polygon_vertex_count == 3) {
+            triangle_indices.push_back(0);
+            triangle_indices.push_back(1);
+            triangle_indices.push_back(2);
+            return;
+        }
+
+        math::vec3 normal;
+        math::real_number_t d_coeff;
+        const int largest_component = compute_polygon_plane_coefficients(normal, d_coeff, polygon_vertices, polygon_vertex_count);
+
+        std::vector<math::vec2> vertices2d;
+        project2D(vertices2d, polygon_vertices, polygon_vertex_count, largest_component);
+
+        // the projection may mirror the polygon, so the winding order is determined from the turn at the
+        // lowest-leftmost vertex, which is convex (its neighbours are skipped while they are collinear with it)
+        int lowest = 0;
+        for (int i = 1; i < polygon_vertex_count; ++i) {
+            const math::vec2& p = vertices2d[i];
+            const math::vec2& q = vertices2d[lowest];
+            if (p[0] < q[0] || (p[0] == q[0] && p[1] < q[1])) {
+                lowest = i;
+            }
+        }
+
+        math::real_number_t lowest_turn(0.0);
+        for (int i = 1; i < polygon_vertex_count && lowest_turn == math::real_number_t(0.0); ++i) {
+            const int a = (lowest + polygon_vertex_count - i) % polygon_vertex_count;
+            const int c = (lowest + i) % polygon_vertex_count;
+            lowest_turn = orient2d(vertices2d[a], vertices2d[lowest], vertices2d[c]);
+        }
+        const bool is_ccw = lowest_turn > math::real_number_t(0.0);
+
+        // "o" is the result of the orient2d predicate
+        auto is_left_turn = [&](const math::real_number_t& o) { return is_ccw ? (o > math::real_number_t(0.0)) : (o < math::real_number_t(0.0)); };
+        auto is_right_turn = [&](const math::real_number_t& o) { return is_ccw ? (o < math::real_number_t(0.0)) : (o > math::real_number_t(0.0)); };
+
+        // the remaining polygon is a circular doubly-linked list of vertices
+        std::vector<int> prev(polygon_vertex_count);
+        std::vector<int> next(polygon_vertex_count);
+
+        for (int i = 0; i < polygon_vertex_count; ++i) {
+            prev[i] = (i + polygon_vertex_count - 1) % polygon_vertex_count;
+            next[i] = (i + 1) % polygon_vertex_count;
+        }
+
+        auto turn = [&](const int v) { return orient2d(vertices2d[prev[v]], vertices2d[v], vertices2d[next[v]]); };
+        auto is_convex = [&](const int v) { return is_left_turn(turn(v)); };
+
+        int remaining = polygon_vertex_count;
+
+        // add the triangle of vertex "b" and remove "b" from the remaining polygon
+        auto clip = [&](const int b) {
+            const int a = prev[b];
+            const int c = next[b];
+
+            triangle_indices.push_back(a);
+            triangle_indices.push_back(b);
+            triangle_indices.push_back(c);
+
+            next[a] = c;
+            prev[c] = a;
+            remaining--;
+        };
+
+        int v = 0;
+        int attempts = 0; // number of consecutive vertices that are not ear tips
+
+        while (remaining > 3) {
+            const int a = prev[v];
+            const int b = v;
+            const int c = next[v];
+
+            bool is_ear = is_convex(b);
+
+            // an ear contains no other vertex (only non-convex vertices can be inside)
+            for (int k = next[c]; is_ear && k != a; k = next[k]) {
+                if (!is_convex(k)) {
+                    const math::vec2& p = vertices2d[k];
+                    const bool is_inside = !is_right_turn(orient2d(vertices2d[a], vertices2d[b], p)) && //
+                        !is_right_turn(orient2d(vertices2d[b], vertices2d[c], p)) && //
+                        !is_right_turn(orient2d(vertices2d[c], vertices2d[a], p));
+                    is_ear = !is_inside;
+                }
+            }
+
+            if (is_ear) {
+                clip(b);
+                attempts = 0;
+            } else if (++attempts > remaining) { // i.e. the polygon has no ear
+                // clip a collinear vertex (its triangle is degenerate but overlaps no other triangle), or
+                // else a convex vertex, and only clip the current vertex if there is neither
+                int w = -1;
+
+                for (int i = 0, k = b; w == -1 && i < remaining; ++i, k = next[k]) {
+                    if (turn(k) == math::real_number_t(0.0)) {
+                        w = k;
+                    }
+                }
+
+                for (int i = 0, k = b; w == -1 && i < remaining; ++i, k = next[k]) {
+                    if (is_convex(k)) {
+                        w = k;
+                    }
+                }
+
+                if (w == -1) {
+                    w = b;
+                }
+
+                clip(w);
+                attempts = 0;
+
+                v = prev[w];
+            }
+
+            v = next[v];
+        }
+
+        triangle_indices.push_back(prev[v]);
+        triangle_indices.push_back(v);
+        triangle_indices.push_back(next[v]);
+    }
+
     // TODO: update this function to use "project2D" for projection step
     char compute_point_in_polygon_test(
         const math::vec3& p,
@@ -453,6 +584,57 @@ namespace geom {
         return compute_point_in_polygon_test(pp, polygon_vertices2d.data(), (int)polygon_vertices2d.size());
     }
 
+    // whether an edge of polygon "a" passes through (or touches) the area of polygon "b"
+    bool compute_polygon_edges_intersection_test(
+        const math::vec3* polygon_a_vertices,
+        const int polygon_a_vertex_count,
+        const math::vec3* polygon_b_vertices,
+        const int polygon_b_vertex_count)
+    {
+        math::vec3 b_normal;
+        math::real_number_t b_d_coeff;
+        const int b_normal_max_comp = compute_polygon_plane_coefficients(b_normal, b_d_coeff, polygon_b_vertices, polygon_b_vertex_count);
+
+        for (int i = 0; i < polygon_a_vertex_count; ++i) {
+            const math::vec3& q = polygon_a_vertices[i];
+            const math::vec3& r = polygon_a_vertices[(i + 1) % polygon_a_vertex_count];
+
+            const char type = compute_segment_plane_intersection_type(q, r, polygon_b_vertices, polygon_b_vertex_count, b_normal_max_comp); // exact
+
+            if (type == '0') {
+                continue; // the edge is strictly on one side of the plane
+            }
+
+            if (type == '1') {
+                math::vec3 p;
+                compute_segment_plane_intersection(p, b_normal, b_d_coeff, q, r);
+
+                if (compute_point_in_polygon_test(p, polygon_b_vertices, polygon_b_vertex_count, b_normal_max_comp) != 'o') {
+                    return true;
+                }
+            } else { // an endpoint ('q' or 'r'), or the whole edge ('p'), is on the plane
+                const bool q_touches = (type != 'r') && compute_point_in_polygon_test(q, polygon_b_vertices, polygon_b_vertex_count, b_normal_max_comp) != 'o';
+                const bool r_touches = (type != 'q') && compute_point_in_polygon_test(r, polygon_b_vertices, polygon_b_vertex_count, b_normal_max_comp) != 'o';
+
+                if (q_touches || r_touches) {
+                    return true;
+                }
+            }
+        }
+
+        return false;
+    }
+
+    bool compute_polygon_intersection_test(
+        const math::vec3* polygon_a_vertices,
+        const int polygon_a_vertex_count,
+        const math::vec3* polygon_b_vertices,
+        const int polygon_b_vertex_count)
+    {
+        return compute_polygon_edges_intersection_test(polygon_a_vertices, polygon_a_vertex_count, polygon_b_vertices, polygon_b_vertex_count) || //
+            compute_polygon_edges_intersection_test(polygon_b_vertices, polygon_b_vertex_count, polygon_a_vertices, polygon_a_vertex_count);
+    }
+
     bool Between(math::vec2 a, math::vec2 b, math::vec2 c)
     {
         math::vec2 ba, ca;
@@ -79,51 +79,47 @@ int mesh_t::number_of_faces() const
 vertex_descriptor_t mesh_t::source(const halfedge_descriptor_t& h) const
 {
     MCUT_ASSERT(h != null_halfedge());
-    const halfedge_data_t& hd = m_halfedges.at(h);
+    MCUT_ASSERT((int)h < number_of_internal_halfedges());
+    const halfedge_data_t& hd = m_halfedges[h];
     MCUT_ASSERT(hd.o != null_halfedge());
-    const halfedge_data_t& ohd = m_halfedges.at(hd.o); // opposite
+    const halfedge_data_t& ohd = m_halfedges[hd.o]; // opposite
     return ohd.t;
 }
 
 vertex_descriptor_t mesh_t::target(const halfedge_descriptor_t& h) const
 {
     MCUT_ASSERT(h != null_halfedge());
-    MCUT_ASSERT(m_halfedges.count(h) == 1);
-    const halfedge_data_t& hd = m_halfedges.at(h);
-    return hd.t;
+    MCUT_ASSERT((int)h < number_of_internal_halfedges());
+    return m_halfedges[h].t;
 }
 
 halfedge_descriptor_t mesh_t::opposite(const halfedge_descriptor_t& h) const
 {
     MCUT_ASSERT(h != null_halfedge());
-    MCUT_ASSERT(m_halfedges.count(h) == 1);
-    const halfedge_data_t& hd = m_halfedges.at(h);
-    return hd.o;
+    MCUT_ASSERT((int)h < number_of_internal_halfedges());
+    return m_halfedges[h].o;
 }
 
 halfedge_descriptor_t mesh_t::prev(const halfedge_descriptor_t& h) const
 {
     MCUT_ASSERT(h != null_halfedge());
-    MCUT_ASSERT(m_halfedges.count(h) == 1);
-    const halfedge_data_t& hd = m_halfedges.at(h);
-    return hd.p;
+    MCUT_ASSERT((int)h < number_of_internal_halfedges());
+    return m_halfedges[h].p;
 }
 
 halfedge_descriptor_t mesh_t::next(const halfedge_descriptor_t& h) const
 {
     MCUT_ASSERT(h != null_halfedge());
-    MCUT_ASSERT(m_halfedges.count(h) == 1);
-    const halfedge_data_t& hd = m_halfedges.at(h);
-    return hd.n;
+    MCUT_ASSERT((int)h < number_of_internal_halfedges());
+    return m_halfedges[h].n;
 }
 
 void mesh_t::set_next(const halfedge_descriptor_t& h, const halfedge_descriptor_t& nxt)
 {
     MCUT_ASSERT(h != null_halfedge());
     MCUT_ASSERT(nxt != null_halfedge());
-    MCUT_ASSERT(m_halfedges.count(h) == 1);
-    halfedge_data_t& hd = m_halfedges.at(h);
-    hd.n = nxt;
+    MCUT_ASSERT((int)h < number_of_internal_halfedges());
+    m_halfedges[h].n = nxt;
     set_previous(nxt, h);
 }
 
@@ -131,43 +127,38 @@ void mesh_t::set_previous(const halfedge_descriptor_t& h, const halfedge_descrip
 {
     MCUT_ASSERT(h != null_halfedge());
     MCUT_ASSERT(prev != null_halfedge());
-    MCUT_ASSERT(m_halfedges.count(h) == 1);
-    halfedge_data_t& hd = m_halfedges.at(h);
-    hd.p = prev;
+    MCUT_ASSERT((int)h < number_of_internal_halfedges());
+    m_halfedges[h].p = prev;
 }
 
 edge_descriptor_t mesh_t::edge(const halfedge_descriptor_t& h) const
 {
     MCUT_ASSERT(h != null_halfedge());
-    MCUT_ASSERT(m_halfedges.count(h) == 1);
-    const halfedge_data_t& hd = m_halfedges.at(h);
-    return hd.e;
+    MCUT_ASSERT((int)h < number_of_internal_halfedges());
+    return m_halfedges[h].e;
 }
 
 face_descriptor_t mesh_t::face(const halfedge_descriptor_t& h) const
 {
     MCUT_ASSERT(h != null_halfedge());
-    MCUT_ASSERT(m_halfedges.count(h) == 1);
-    const halfedge_data_t& hd = m_halfedges.at(h);
-    return hd.f;
+    MCUT_ASSERT((int)h < number_of_internal_halfedges());
+    return m_halfedges[h].f;
 }
 
 vertex_descriptor_t mesh_t::vertex(const edge_descriptor_t e, const int v) const
 {
     MCUT_ASSERT(e != null_edge());
     MCUT_ASSERT(v == 0 || v == 1);
-    MCUT_ASSERT(m_edges.count(e) == 1);
-    const edge_data_t& ed = m_edges.at(e);
-    const halfedge_descriptor_t h = ed.h;
-    MCUT_ASSERT(m_halfedges.count(h) == 1);
-    const halfedge_data_t& hd = m_halfedges.at(h);
+    MCUT_ASSERT((int)e < number_of_internal_edges());
+    const halfedge_descriptor_t h = m_edges[e].h;
+    MCUT_ASSERT((int)h < number_of_internal_halfedges());
+    const halfedge_data_t& hd = m_halfedges[h];
     vertex_descriptor_t v_out = hd.t; // assuming v ==0
 
     if (v == 1) {
         const halfedge_descriptor_t opp = hd.o;
-        MCUT_ASSERT(m_halfedges.count(opp) == 1);
-        const halfedge_data_t& ohd = m_halfedges.at(opp);
-        v_out = ohd.t;
+        MCUT_ASSERT((int)opp < number_of_internal_halfedges());
+        v_out = m_halfedges[opp].t;
     }
 
     return v_out;
@@ -194,17 +185,15 @@ halfedge_descriptor_t mesh_t::halfedge(const edge_descriptor_t e, const int i) c
 {
     MCUT_ASSERT(i == 0 || i == 1);
     MCUT_ASSERT(e != null_edge());
-    MCUT_ASSERT(m_edges.count(e) == 1);
-    const edge_data_t& ed = m_edges.at(e);
-    halfedge_descriptor_t h = ed.h; // assuming i ==0
+    MCUT_ASSERT((int)e < number_of_internal_edges());
+    halfedge_descriptor_t h = m_edges[e].h; // assuming i ==0
 
     MCUT_ASSERT(h != null_halfedge());
 
     if (i == 1) {
-        MCUT_ASSERT(m_halfedges.count(h) == 1);
+        MCUT_ASSERT((int)h < number_of_internal_halfedges());
 
-        const halfedge_data_t& hd = m_halfedges.at(h);
-        h = hd.o;
+        h = m_halfedges[h].o;
 
         MCUT_ASSERT(h != null_halfedge());
     }
@@ -214,11 +203,11 @@ halfedge_descriptor_t mesh_t::halfedge(const edge_descriptor_t e, const int i) c
 
 halfedge_descriptor_t mesh_t::halfedge(const vertex_descriptor_t s, const vertex_descriptor_t t, bool strict_check) const
 {
-    MCUT_ASSERT(m_vertices.count(s) == 1);
-    const vertex_data_t& svd = m_vertices.at(s);
+    MCUT_ASSERT((int)s < number_of_internal_vertices());
+    const vertex_data_t& svd = m_vertices[s];
     const std::vector<halfedge_descriptor_t>& s_halfedges = svd.m_halfedges;
-    MCUT_ASSERT(m_vertices.count(t) == 1);
-    const vertex_data_t& tvd = m_vertices.at(t);
+    MCUT_ASSERT((int)t < number_of_internal_vertices());
+    const vertex_data_t& tvd = m_vertices[t];
     const std::vector<halfedge_descriptor_t>& t_halfedges = tvd.m_halfedges;
     std::vector<edge_descriptor_t> t_edges;
     t_edges.reserve(t_halfedges.size());
@@ -273,8 +262,10 @@ vertex_descriptor_t mesh_t::add_vertex(const math::fast_vec3& point)
 
 vertex_descriptor_t mesh_t::add_vertex(const math::real_number_t& x, const math::real_number_t& y, const math::real_number_t& z)
 {
+    // NOTE: the coordinates are copied before the vertex arrays grow because the
+    // arguments may refer to an existing vertex of this mesh (e.g. "m.add_vertex(m.vertex(v))")
+    const math::vec3 point(x, y, z);
     vertex_descriptor_t vd = mesh_t::null_vertex();
-    vertex_data_t* data_ptr = nullptr;
     bool reusing_removed_descr = (!m_vertices_removed.empty());
 
     if (reusing_removed_descr) // can we re-use a slot?
@@ -282,19 +273,19 @@ vertex_descriptor_t mesh_t::add_vertex(const math::real_number_t& x, const math:
         std::vector<vertex_descriptor_t>::const_iterator it = m_vertices_removed.cbegin(); // take the oldest unused slot (NOTE: important for user data mapping)
         vd = *it;
         m_vertices_removed.erase(it);
-        MCUT_ASSERT(m_vertices.find(vd) != m_vertices.cend());
-        data_ptr = &m_vertices.at(vd);
+        MCUT_ASSERT((int)vd < number_of_internal_vertices());
+        m_vertices_removed_flags[vd] = false;
+        m_vertex_positions[vd] = point;
     } else {
         vd = static_cast<vertex_descriptor_t>(number_of_vertices());
-        std::pair<typename std::map<vertex_descriptor_t, vertex_data_t>::iterator, bool> ret = m_vertices.insert(std::make_pair(vd, vertex_data_t()));
-        MCUT_ASSERT(ret.second == true);
-        data_ptr = &ret.first->second;
+        MCUT_ASSERT((int)vd == number_of_internal_vertices());
+        m_vertices.emplace_back();
+        m_vertex_positions.push_back(point);
+        m_vertices_removed_flags.push_back(false);
     }
 
     MCUT_ASSERT(vd != mesh_t::null_vertex());
 
-    data_ptr->p = math::vec3(x, y, z);
-
     return vd;
 }
 
@@ -324,17 +315,13 @@ halfedge_descriptor_t mesh_t::add_edge(const vertex_descriptor_t v0, const verte
         std::vector<halfedge_descriptor_t>::const_iterator hIter = m_halfedges_removed.cbegin(); // take the oldest unused slot (NOTE: important for user data mapping)
         h0_idx = *hIter;
         m_halfedges_removed.erase(hIter);
-        MCUT_ASSERT(m_halfedges.find(h0_idx) != m_halfedges.cend());
-    }
-
-    halfedge_data_t* halfedge0_data_ptr = nullptr;
-    if (reusing_removed_h0_descr) {
-        halfedge0_data_ptr = &m_halfedges.at(h0_idx);
+        MCUT_ASSERT((int)h0_idx < number_of_internal_halfedges());
+        m_halfedges_removed_flags[h0_idx] = false;
     } else {
         // create new halfedge --> h0
-        std::pair<typename std::map<halfedge_descriptor_t, halfedge_data_t>::iterator, bool> h0_ret = m_halfedges.insert(std::make_pair(h0_idx, halfedge_data_t()));
-        MCUT_ASSERT(h0_ret.second == true);
-        halfedge0_data_ptr = &h0_ret.first->second;
+        MCUT_ASSERT((int)h0_idx == number_of_internal_halfedges());
+        m_halfedges.emplace_back();
+        m_halfedges_removed_flags.push_back(false);
     }
 
     // second halfedge(1) of edge
@@ -346,17 +333,13 @@ halfedge_descriptor_t mesh_t::add_edge(const vertex_descriptor_t v0, const verte
         std::vector<halfedge_descriptor_t>::const_iterator hIter = m_halfedges_removed.cbegin() + (m_halfedges_removed.size() - 1); // take the most recently removed
         h1_idx = *hIter;
         m_halfedges_removed.erase(hIter);
-        MCUT_ASSERT(m_halfedges.find(h1_idx) != m_halfedges.cend());
-    }
-
-    halfedge_data_t* halfedge1_data_ptr = nullptr;
-    if (reusing_removed_h1_descr) {
-        halfedge1_data_ptr = &m_halfedges.at(h1_idx);
+        MCUT_ASSERT((int)h1_idx < number_of_internal_halfedges());
+        m_halfedges_removed_flags[h1_idx] = false;
     } else {
         // create new halfedge --> h1
-        std::pair<typename std::map<halfedge_descriptor_t, halfedge_data_t>::iterator, bool> h1_ret = m_halfedges.insert(std::make_pair(h1_idx, halfedge_data_t()));
-        MCUT_ASSERT(h1_ret.second == true);
-        halfedge1_data_ptr = &h1_ret.first->second;
+        MCUT_ASSERT((int)h1_idx == number_of_internal_halfedges());
+        m_halfedges.emplace_back();
+        m_halfedges_removed_flags.push_back(false);
     }
 
     // edge
@@ -369,49 +352,41 @@ halfedge_descriptor_t mesh_t::add_edge(const vertex_descriptor_t v0, const verte
         std::vector<edge_descriptor_t>::const_iterator eIter = m_edges_removed.cbegin(); // take the oldest unused slot (NOTE: important for user data mapping)
         e_idx = *eIter;
         m_edges_removed.erase(eIter);
-        MCUT_ASSERT(m_edges.find(e_idx) != m_edges.cend());
-    }
-
-    edge_data_t* edge_data_ptr = nullptr;
-    if (reusing_removed_edge_descr) {
-        edge_data_ptr = &m_edges.at(e_idx);
+        MCUT_ASSERT((int)e_idx < number_of_internal_edges());
+        m_edges_removed_flags[e_idx] = false;
     } else {
-        std::pair<typename std::map<edge_descriptor_t, edge_data_t>::iterator, bool> eret = m_edges.insert(std::make_pair(e_idx, edge_data_t())); // create a new edge
-        MCUT_ASSERT(eret.second == true);
-        edge_data_ptr = &eret.first->second;
+        MCUT_ASSERT((int)e_idx == number_of_internal_edges());
+        m_edges.emplace_back(); // create a new edge
+        m_edges_removed_flags.push_back(false);
     }
 
     // update incidence information
+    // NOTE: the element arrays do not grow beyond this point, so references are stable
 
-    //edge_data_t& edge_data = eret.first->second;
-    edge_data_ptr->h = h0_idx; // even/primary halfedge
-    //eret.first->h = h0_idx; // even/primary halfedge
-
-    //halfedge_data_t& halfedge0_data = h0_ret.first->second;
-    halfedge0_data_ptr->t = v1; // target vertex of h0
-    halfedge0_data_ptr->o = h1_idx; // ... because opp has idx differing by 1
-    halfedge0_data_ptr->e = e_idx;
+    edge_data_t& edge_data = m_edges[e_idx];
+    edge_data.h = h0_idx; // even/primary halfedge
 
-    //halfedge_data_t& halfedge1_data = h1_ret.first->second;
-    halfedge1_data_ptr->t = v0; // target vertex of h1
-    halfedge1_data_ptr->o = h0_idx; // ... because opp has idx differing by 1
-    halfedge1_data_ptr->e = e_idx;
+    halfedge_data_t& halfedge0_data = m_halfedges[h0_idx];
+    halfedge0_data.t = v1; // target vertex of h0
+    halfedge0_data.o = h1_idx; // ... because opp has idx differing by 1
+    halfedge0_data.e = e_idx;
 
-    //MCUT_ASSERT(h1_ret.first->first == halfedge0_data_ptr->o); // h1 comes just afterward (its index)
+    halfedge_data_t& halfedge1_data = m_halfedges[h1_idx];
+    halfedge1_data.t = v0; // target vertex of h1
+    halfedge1_data.o = h0_idx; // ... because opp has idx differing by 1
+    halfedge1_data.e = e_idx;
 
     // update vertex incidence
 
     // v0
-    MCUT_ASSERT(m_vertices.count(v0) == 1);
-    vertex_data_t& v0_data = m_vertices.at(v0);
-    //MCUT_ASSERT();
+    MCUT_ASSERT((int)v0 < number_of_internal_vertices());
+    vertex_data_t& v0_data = m_vertices[v0];
     if (std::find(v0_data.m_halfedges.cbegin(), v0_data.m_halfedges.cend(), h1_idx) == v0_data.m_halfedges.cend()) {
         v0_data.m_halfedges.push_back(h1_idx); // halfedge whose target is v0
     }
     // v1
-    MCUT_ASSERT(m_vertices.count(v1) == 1);
-    vertex_data_t& v1_data = m_vertices.at(v1);
-    //MCUT_ASSERT();
+    MCUT_ASSERT((int)v1 < number_of_internal_vertices());
+    vertex_data_t& v1_data = m_vertices[v1];
     if (std::find(v1_data.m_halfedges.cbegin(), v1_data.m_halfedges.cend(), h0_idx) == v1_data.m_halfedges.cend()) {
         v1_data.m_halfedges.push_back(h0_idx); // halfedge whose target is v1
     }
@@ -435,11 +410,13 @@ face_descriptor_t mesh_t::add_face(const std::vector<vertex_descriptor_t>& vi)
         new_face_idx = *fIter;
         m_faces_removed.erase(fIter); // slot is going to be used again
 
-        MCUT_ASSERT(m_faces.find(new_face_idx) != m_faces.cend());
+        MCUT_ASSERT((int)new_face_idx < number_of_internal_faces());
     }
 
-    face_data_t* face_data_ptr = reusing_removed_face_descr ? &m_faces.at(new_face_idx) : &new_face_data;
-    face_data_ptr->m_halfedges.clear();
+    // NOTE: a (reused) face slot is not touched until the face's halfedges are known, since
+    // "add_edge" below may grow the halfedge array but never the face array.
+    std::vector<halfedge_descriptor_t>& face_halfedges = new_face_data.m_halfedges;
+    face_halfedges.reserve(face_vertex_count);
 
     for (int i = 0; i < face_vertex_count; ++i) {
         const vertex_descriptor_t v0 = vi.at(i); // i.e. src
@@ -453,20 +430,20 @@ face_descriptor_t mesh_t::add_face(const std::vector<vertex_descriptor_t>& vi)
         // check if edge exists between v0 and v1 (using halfedges incident to either v0 or v1)
         // TODO: use the halfedge(..., true) function
 
-        vertex_data_t& v0_data = m_vertices.at(v0);
-        vertex_data_t& v1_data = m_vertices.at(v1);
+        const vertex_data_t& v0_data = m_vertices[v0];
+        const vertex_data_t& v1_data = m_vertices[v1];
 
         bool connecting_edge_exists = false;
         halfedge_descriptor_t v0_h = null_halfedge();
         halfedge_descriptor_t v1_h = null_halfedge();
 
         for (int v0_h_iter = 0; v0_h_iter < static_cast<int>(v0_data.m_halfedges.size()); ++v0_h_iter) {
-            v0_h = v0_data.m_halfedges.at(v0_h_iter);
+            v0_h = v0_data.m_halfedges[v0_h_iter];
             const edge_descriptor_t v0_e = edge(v0_h);
 
             for (int v1_h_iter = 0; v1_h_iter < static_cast<int>(v1_data.m_halfedges.size()); ++v1_h_iter) {
 
-                v1_h = v1_data.m_halfedges.at(v1_h_iter);
+                v1_h = v1_data.m_halfedges[v1_h_iter];
                 const edge_descriptor_t v1_e = edge(v1_h);
                 const bool same_edge = (v0_e == v1_e);
 
@@ -483,66 +460,340 @@ face_descriptor_t mesh_t::add_face(const std::vector<vertex_descriptor_t>& vi)
 
         // we use v1 in the following since v1 is the target (vertices are associated with halfedges which point to them)
 
-        halfedge_data_t* v1_hd_ptr = nullptr; // refer to halfedge whose tgt is v1
+        halfedge_descriptor_t h = v1_h; // refer to halfedge whose tgt is v1
 
-        if (connecting_edge_exists) // edge connecting v0 and v1
-        {
-            MCUT_ASSERT(m_halfedges.count(v1_h) == 1);
-            v1_hd_ptr = &m_halfedges.at(v1_h);
-
-            face_data_ptr->m_halfedges.push_back(v1_h);
+        if (!connecting_edge_exists) { // there exists no edge between v0 and v1, so we create it
+            h = add_edge(v0, v1);
+        }
 
-        } else { // there exists no edge between v0 and v1, so we create it
-            const halfedge_descriptor_t h = add_edge(v0, v1);
-            MCUT_ASSERT(m_halfedges.count(h) == 1);
-            v1_hd_ptr = &m_halfedges.at(h);
+        MCUT_ASSERT((int)h < number_of_internal_halfedges());
+        halfedge_data_t& v1_hd = m_halfedges[h];
 
-            face_data_ptr->m_halfedges.push_back(h);
-        }
+        face_halfedges.push_back(h);
 
-        MCUT_ASSERT(v1_hd_ptr->f == null_face());
+        MCUT_ASSERT(v1_hd.f == null_face());
 
-        v1_hd_ptr->f = new_face_idx; // associate halfedge with face
+        v1_hd.f = new_face_idx; // associate halfedge with face
     }
 
-    if (!reusing_removed_face_descr) {
-        MCUT_ASSERT(m_faces.count(new_face_idx) == 0);
-        m_faces.insert(std::make_pair(new_face_idx, *face_data_ptr));
+    if (reusing_removed_face_descr) {
+        m_faces[new_face_idx].m_halfedges.swap(face_halfedges);
+        m_faces_removed_flags[new_face_idx] = false;
+    } else {
+        MCUT_ASSERT((int)new_face_idx == number_of_internal_faces());
+        m_faces.push_back(std::move(new_face_data));
+        m_faces_removed_flags.push_back(false);
     }
 
     // update halfedges (next halfedge)
-    //const std::vector<halfedge_descriptor_t>& halfedges_around_new_face = get_halfedges_around_face(new_face_idx);
-    const int num_halfedges = static_cast<int>(face_data_ptr->m_halfedges.size());
+    const std::vector<halfedge_descriptor_t>& halfedges_around_new_face = m_faces[new_face_idx].m_halfedges;
+    const int num_halfedges = static_cast<int>(halfedges_around_new_face.size());
 
     for (int i = 0; i < num_halfedges; ++i) {
-        const halfedge_descriptor_t h = face_data_ptr->m_halfedges.at(i);
-        const halfedge_descriptor_t nh = face_data_ptr->m_halfedges.at((i + 1) % num_halfedges);
+        const halfedge_descriptor_t h = halfedges_around_new_face[i];
+        const halfedge_descriptor_t nh = halfedges_around_new_face[(i + 1) % num_halfedges];
         set_next(h, nh);
     }
 
     return new_face_idx;
 }
 
+bool mesh_t::build_from_arrays(
+    const std::vector<math::vec3>& vertices,
+    const uint32_t* face_indices,
+    const uint32_t* face_sizes,
+    const uint32_t num_faces,
+    std::vector<std::pair<vertex_descriptor_t, vertex_descriptor_t>>* non_manifold_edges)
+{
+    MCUT_ASSERT(number_of_internal_vertices() == 0);
+    MCUT_ASSERT(number_of_internal_edges() == 0);
+    MCUT_ASSERT(number_of_internal_halfedges() == 0);
+    MCUT_ASSERT(number_of_internal_faces() == 0);
+
+    const uint32_t num_vertices = static_cast<uint32_t>(vertices.size());
+    const uint32_t no_face_edge = (std::numeric_limits<uint32_t>::max)();
+
+    // offset of the first vertex index of each face in "face_indices".
+    // NOTE: a "face-edge" is a pair of consecutive vertices in a face, and is identified
+    // by the offset of its first vertex (i.e. face-edges are numbered in face order).
+    std::vector<uint32_t> face_offsets(num_faces + 1);
+    face_offsets[0] = 0;
+    for (uint32_t f = 0; f < num_faces; ++f) {
+        MCUT_ASSERT(face_sizes[f] >= 3);
+        face_offsets[f + 1] = face_offsets[f] + face_sizes[f];
+    }
+
+    const uint32_t num_face_edges = face_offsets[num_faces];
+
+    // sort the face-edges by their (undirected) vertex pair so that the face-edges
+    // which lie on the same edge are next to each other
+    std::vector<std::pair<uint64_t, uint32_t>> sorted_face_edges(num_face_edges); // <(min,max) key, face-edge>
+
+    for (uint32_t f = 0; f < num_faces; ++f) {
+        const uint32_t offset = face_offsets[f];
+        const uint32_t size = face_sizes[f];
+
+        for (uint32_t i = 0; i < size; ++i) {
+            const uint64_t a = face_indices[offset + i];
+            const uint64_t b = face_indices[offset + ((i + 1) % size)];
+            MCUT_ASSERT(a < num_vertices && b < num_vertices && a != b);
+            sorted_face_edges[offset + i] = std::make_pair(a < b ? ((a << 32) | b) : ((b << 32) | a), offset + i);
+        }
+    }
+
+    std::sort(sorted_face_edges.begin(), sorted_face_edges.end());
+
+    // the face-edge which is opposite to each face-edge (i.e. shares its edge), if any
+    std::vector<uint32_t> opposite_face_edges(num_face_edges, no_face_edge);
+    bool is_manifold = true;
+
+    for (uint32_t i = 0; i < num_face_edges;) {
+        uint32_t j = i + 1; // one past the last face-edge with the same key
+        while (j < num_face_edges && sorted_face_edges[j].first == sorted_face_edges[i].first) {
+            ++j;
+        }
+
+        const uint32_t count = j - i;
+        bool edge_is_manifold = (count <= 2);
+
+        if (count == 2) {
+            const uint32_t fe0 = sorted_face_edges[i].second;
+            const uint32_t fe1 = sorted_face_edges[i + 1].second;
+
+            // the face-edges of two correctly oriented neighbouring faces have opposite directions
+            edge_is_manifold = (face_indices[fe0] != face_indices[fe1]);
+
+            if (edge_is_manifold) {
+                opposite_face_edges[fe0] = fe1;
+                opposite_face_edges[fe1] = fe0;
+            }
+        }
+
+        if (!edge_is_manifold) {
+            is_manifold = false;
+
+            if (non_manifold_edges != nullptr) {
+                const uint64_t key = sorted_face_edges[i].first;
+                non_manifold_edges->emplace_back(
+                    vertex_descriptor_t(static_cast<vertex_descriptor_t::index_type>(key >> 32)),
+                    vertex_descriptor_t(static_cast<vertex_descriptor_t::index_type>(key & 0xFFFFFFFF)));
+            }
+        }
+
+        i = j;
+    }
+
+    if (!is_manifold) {
+        return false;
+    }
+
+    // vertices
+
+    m_vertex_positions = vertices;
+    m_vertices.resize(num_vertices);
+    m_vertices_removed_flags.assign(num_vertices, false);
+
+    // edges and halfedges
+    // NOTE: an edge is created when we first visit one of its face-edges (just like "add_face")
+
+    std::vector<uint32_t> vertex_valences(num_vertices, 0);
+    uint32_t num_edges = 0;
+
+    for (uint32_t f = 0; f < num_faces; ++f) {
+        const uint32_t offset = face_offsets[f];
+        const uint32_t size = face_sizes[f];
+
+        for (uint32_t i = 0; i < size; ++i) {
+            if (opposite_face_edges[offset + i] == no_face_edge || opposite_face_edges[offset + i] > offset + i) {
+                vertex_valences[face_indices[offset + i]]++;
+                vertex_valences[face_indices[offset + ((i + 1) % size)]]++;
+                num_edges++;
+            }
+        }
+    }
+
+    for (uint32_t v = 0; v < num_vertices; ++v) {
+        m_vertices[v].m_halfedges.reserve(vertex_valences[v]);
+    }
+
+    m_edges.resize(num_edges);
+    m_edges_removed_flags.assign(num_edges, false);
+    m_halfedges.resize(num_edges * 2);
+    m_halfedges_removed_flags.assign(num_edges * 2, false);
+
+    // faces
+
+    m_faces.resize(num_faces);
+    m_faces_removed_flags.assign(num_faces, false);
+
+    std::vector<halfedge_descriptor_t> face_edge_halfedges(num_face_edges); // halfedge of each face-edge
+    edge_descriptor_t e(0);
+
+    for (uint32_t f = 0; f < num_faces; ++f) {
+        const face_descriptor_t fd(f);
+        const uint32_t offset = face_offsets[f];
+        const uint32_t size = face_sizes[f];
+        std::vector<halfedge_descriptor_t>& halfedges_around_face = m_faces[f].m_halfedges;
+        halfedges_around_face.resize(size);
+
+        for (uint32_t i = 0; i < size; ++i) {
+            const uint32_t face_edge = offset + i;
+            const uint32_t opposite_face_edge = opposite_face_edges[face_edge];
+            halfedge_descriptor_t h;
+
+            if (opposite_face_edge == no_face_edge || opposite_face_edge > face_edge) { // new edge
+                const vertex_descriptor_t v0(face_indices[face_edge]);
+                const vertex_descriptor_t v1(face_indices[offset + ((i + 1) % size)]);
+                const halfedge_descriptor_t h0(static_cast<halfedge_descriptor_t::index_type>(e) * 2);
+                const halfedge_descriptor_t h1(static_cast<halfedge_descriptor_t::index_type>(e) * 2 + 1);
+
+                m_edges[e].h = h0;
+
+                halfedge_data_t& h0_data = m_halfedges[h0];
+                h0_data.t = v1;
+                h0_data.o = h1;
+                h0_data.e = e;
+
+                halfedge_data_t& h1_data = m_halfedges[h1];
+                h1_data.t = v0;
+                h1_data.o = h0;
+                h1_data.e = e;
+
+                m_vertices[v0].m_halfedges.push_back(h1);
+                m_vertices[v1].m_halfedges.push_back(h0);
+
+                h = h0;
+                ++e;
+            } else { // edge was created by the opposite face-edge
+                h = m_halfedges[face_edge_halfedges[opposite_face_edge]].o;
+            }
+
+            face_edge_halfedges[face_edge] = h;
+            m_halfedges[h].f = fd;
+            halfedges_around_face[i] = h;
+        }
+
+        for (uint32_t i = 0; i < size; ++i) {
+            set_next(halfedges_around_face[i], halfedges_around_face[(i + 1) % size]);
+        }
+    }
+
+    MCUT_ASSERT(e == edge_descriptor_t(num_edges));
+
+    return true;
+}
+
+// offset the descriptor of an appended mesh element (null descriptors, which are
+// referenced by disassociated elements, are kept as they are)
+template <typename D>
+static D offset_descriptor(const D& d, const typename D::index_type offset)
+{
+    return (d == D()) ? d : D(static_cast<typename D::index_type>(d + offset));
+}
+
+template <typename D>
+static void append_offset_descriptors(std::vector<D>& dst, const std::vector<D>& src, const typename D::index_type offset)
+{
+    dst.reserve(dst.size() + src.size());
+    for (typename std::vector<D>::const_iterator it = src.cbegin(); it != src.cend(); ++it) {
+        dst.push_back(offset_descriptor(*it, offset));
+    }
+}
+
+void mesh_t::append(const mesh_t& other)
+{
+    MCUT_ASSERT(this != &other);
+
+    const vertex_descriptor_t::index_type vertex_offset = number_of_internal_vertices();
+    const edge_descriptor_t::index_type edge_offset = number_of_internal_edges();
+    const halfedge_descriptor_t::index_type halfedge_offset = number_of_internal_halfedges();
+    const face_descriptor_t::index_type face_offset = number_of_internal_faces();
+
+    // vertices
+
+    m_vertex_positions.insert(m_vertex_positions.end(), other.m_vertex_positions.cbegin(), other.m_vertex_positions.cend());
+    m_vertices.reserve(m_vertices.size() + other.m_vertices.size());
+
+    for (std::vector<vertex_data_t>::const_iterator it = other.m_vertices.cbegin(); it != other.m_vertices.cend(); ++it) {
+        m_vertices.emplace_back();
+        vertex_data_t& vd = m_vertices.back();
+
+        append_offset_descriptors(vd.m_faces, it->m_faces, face_offset);
+        append_offset_descriptors(vd.m_halfedges, it->m_halfedges, halfedge_offset);
+    }
+
+    // edges
+
+    m_edges.reserve(m_edges.size() + other.m_edges.size());
+
+    for (std::vector<edge_data_t>::const_iterator it = other.m_edges.cbegin(); it != other.m_edges.cend(); ++it) {
+        m_edges.emplace_back();
+        m_edges.back().h = offset_descriptor(it->h, halfedge_offset);
+    }
+
+    // halfedges
+
+    m_halfedges.reserve(m_halfedges.size() + other.m_halfedges.size());
+
+    for (std::vector<halfedge_data_t>::const_iterator it = other.m_halfedges.cbegin(); it != other.m_halfedges.cend(); ++it) {
+        m_halfedges.emplace_back();
+        halfedge_data_t& hd = m_halfedges.back();
+        hd.o = offset_descriptor(it->o, halfedge_offset);
+        hd.n = offset_descriptor(it->n, halfedge_offset);
+        hd.p = offset_descriptor(it->p, halfedge_offset);
+        hd.t = offset_descriptor(it->t, vertex_offset);
+        hd.e = offset_descriptor(it->e, edge_offset);
+        hd.f = offset_descriptor(it->f, face_offset);
+    }
+
+    // faces
+
+    m_faces.reserve(m_faces.size() + other.m_faces.size());
+
+    for (std::vector<face_data_t>::const_iterator it = other.m_faces.cbegin(); it != other.m_faces.cend(); ++it) {
+        m_faces.emplace_back();
+        append_offset_descriptors(m_faces.back().m_halfedges, it->m_halfedges, halfedge_offset);
+    }
+
+    // removed slots
+
+    append_offset_descriptors(m_vertices_removed, other.m_vertices_removed, vertex_offset);
+    append_offset_descriptors(m_edges_removed, other.m_edges_removed, edge_offset);
+    append_offset_descriptors(m_halfedges_removed, other.m_halfedges_removed, halfedge_offset);
+    append_offset_descriptors(m_faces_removed, other.m_faces_removed, face_offset);
+
+    m_vertices_removed_flags.insert(m_vertices_removed_flags.end(), other.m_vertices_removed_flags.cbegin(), other.m_vertices_removed_flags.cend());
+    m_edges_removed_flags.insert(m_edges_removed_flags.end(), other.m_edges_removed_flags.cbegin(), other.m_edges_removed_flags.cend());
+    m_halfedges_removed_flags.insert(m_halfedges_removed_flags.end(), other.m_halfedges_removed_flags.cbegin(), other.m_halfedges_removed_flags.cend());
+    m_faces_removed_flags.insert(m_faces_removed_flags.end(), other.m_faces_removed_flags.cbegin(), other.m_faces_removed_flags.cend());
+}
+
 const math::vec3& mesh_t::vertex(const vertex_descriptor_t& vd) const
 {
     MCUT_ASSERT(vd != null_vertex());
-    MCUT_ASSERT(m_vertices.count(vd) == 1);
-    const vertex_data_t& vdata = m_vertices.at(vd);
-    return vdata.p;
+    MCUT_ASSERT((int)vd < number_of_internal_vertices());
+    return m_vertex_positions[vd];
+}
+
+void mesh_t::set_vertex(const vertex_descriptor_t& vd, const math::vec3& point)
+{
+    MCUT_ASSERT(vd != null_vertex());
+    MCUT_ASSERT((int)vd < number_of_internal_vertices());
+    m_vertex_positions[vd] = point;
 }
 
 std::vector<vertex_descriptor_t> mesh_t::get_vertices_around_face(const face_descriptor_t f) const
 {
     MCUT_ASSERT(f != null_face());
-    std::vector<vertex_descriptor_t> vertex_descriptors;
 
     const std::vector<halfedge_descriptor_t>& halfedges_on_face = get_halfedges_around_face(f);
+    std::vector<vertex_descriptor_t> vertex_descriptors;
+    vertex_descriptors.reserve(halfedges_on_face.size());
 
     for (int i = 0; i < (int)halfedges_on_face.size(); ++i) {
-        const halfedge_descriptor_t h = halfedges_on_face.at(i);
-        MCUT_ASSERT(m_halfedges.count(h) == 1);
-        const halfedge_data_t& hd = m_halfedges.at(h);
-        vertex_descriptors.push_back(hd.t);
+        const halfedge_descriptor_t h = halfedges_on_face[i];
+        MCUT_ASSERT((int)h < number_of_internal_halfedges());
+        vertex_descriptors.push_back(m_halfedges[h].t);
     }
     return vertex_descriptors;
 }
@@ -550,8 +801,8 @@ std::vector<vertex_descriptor_t> mesh_t::get_vertices_around_face(const face_des
 const std::vector<halfedge_descriptor_t>& mesh_t::get_halfedges_around_face(const face_descriptor_t f) const
 {
     MCUT_ASSERT(f != null_face());
-    MCUT_ASSERT(m_faces.count(f) == 1);
-    return m_faces.at(f).m_halfedges;
+    MCUT_ASSERT((int)f < number_of_internal_faces());
+    return m_faces[f].m_halfedges;
 }
 
 const std::vector<face_descriptor_t> mesh_t::get_faces_around_face(const face_descriptor_t f) const
@@ -563,13 +814,13 @@ const std::vector<face_descriptor_t> mesh_t::get_faces_around_face(const face_de
 
     for (int i = 0; i < (int)halfedges_on_face.size(); ++i) {
 
-        const halfedge_descriptor_t h = halfedges_on_face.at(i);
-        MCUT_ASSERT(m_halfedges.count(h) == 1);
-        const halfedge_data_t& hd = m_halfedges.at(h);
+        const halfedge_descriptor_t h = halfedges_on_face[i];
+        MCUT_ASSERT((int)h < number_of_internal_halfedges());
+        const halfedge_data_t& hd = m_halfedges[h];
 
         if (hd.o != null_halfedge()) {
-            MCUT_ASSERT(m_halfedges.count(hd.o) == 1);
-            const halfedge_data_t& ohd = m_halfedges.at(hd.o);
+            MCUT_ASSERT((int)hd.o < number_of_internal_halfedges());
+            const halfedge_data_t& ohd = m_halfedges[hd.o];
 
             if (ohd.f != null_face()) {
                 faces_around_face.push_back(ohd.f);
@@ -582,66 +833,58 @@ const std::vector<face_descriptor_t> mesh_t::get_faces_around_face(const face_de
 const std::vector<halfedge_descriptor_t>& mesh_t::get_halfedges_around_vertex(const vertex_descriptor_t v) const
 {
     MCUT_ASSERT(v != mesh_t::null_vertex());
-    MCUT_ASSERT(m_vertices.count(v) == 1);
-    const vertex_data_t& vd = m_vertices.at(v);
-    const std::vector<halfedge_descriptor_t>& incoming_halfedges = vd.m_halfedges;
-    return incoming_halfedges;
+    MCUT_ASSERT((int)v < number_of_internal_vertices());
+    return m_vertices[v].m_halfedges;
 }
 
-mesh_t::vertex_iterator_t mesh_t::vertices_begin() const
+// returns descriptor of the first slot (at or after "i") which is not marked as removed
+template <typename D>
+static D first_valid_descriptor(const std::vector<bool>& removed_flags, typename D::index_type i)
 {
-    vertex_map_t::const_iterator it = m_vertices.cbegin();
-    while (it != m_vertices.cend() && is_removed(it->first)) {
-        ++it; // shift the pointer to the first valid mesh element
+    while (i < (typename D::index_type)removed_flags.size() && removed_flags[i]) {
+        ++i; // shift the pointer to the first valid mesh element
     }
-    return vertex_iterator_t(it, this);
+    return D(i);
+}
+
+mesh_t::vertex_iterator_t mesh_t::vertices_begin() const
+{
+    return vertex_iterator_t(first_valid_descriptor<vertex_descriptor_t>(m_vertices_removed_flags, 0), this);
 }
 
 mesh_t::vertex_iterator_t mesh_t::vertices_end() const
 {
-    return vertex_iterator_t(m_vertices.cend(), this);
+    return vertex_iterator_t(vertex_descriptor_t(number_of_internal_vertices()), this);
 }
 
 mesh_t::edge_iterator_t mesh_t::edges_begin() const
 {
-    edge_map_t::const_iterator it = m_edges.cbegin();
-    while (it != m_edges.cend() && is_removed(it->first)) {
-        ++it; // shift the pointer to the first valid mesh element
-    }
-    return edge_iterator_t(it, this);
+    return edge_iterator_t(first_valid_descriptor<edge_descriptor_t>(m_edges_removed_flags, 0), this);
 }
 
 mesh_t::edge_iterator_t mesh_t::edges_end() const
 {
-    return edge_iterator_t(m_edges.cend(), this);
+    return edge_iterator_t(edge_descriptor_t(number_of_internal_edges()), this);
 }
 
 mesh_t::halfedge_iterator_t mesh_t::halfedges_begin() const
 {
-    halfedge_map_t::const_iterator it = m_halfedges.cbegin();
-    while (it != m_halfedges.cend() && is_removed(it->first)) {
-        ++it; // shift the pointer to the first valid mesh element
-    }
-    return halfedge_iterator_t(it, this);
+    return halfedge_iterator_t(first_valid_descriptor<halfedge_descriptor_t>(m_halfedges_removed_flags, 0), this);
 }
 
 mesh_t::halfedge_iterator_t mesh_t::halfedges_end() const
 {
-    return halfedge_iterator_t(m_halfedges.cend(), this);
+    return halfedge_iterator_t(halfedge_descriptor_t(number_of_internal_halfedges()), this);
 }
 
 mesh_t::face_iterator_t mesh_t::faces_begin() const
 {
-    face_map_t::const_iterator it = m_faces.cbegin();
-    while (it != m_faces.cend() && is_removed(it->first)) {
-        ++it; // shift the pointer to the first valid mesh element
-    }
-    return face_iterator_t(it, this);
+    return face_iterator_t(first_valid_descriptor<face_descriptor_t>(m_faces_removed_flags, 0), this);
 }
 
 mesh_t::face_iterator_t mesh_t::faces_end() const
 {
-    return face_iterator_t(m_faces.cend(), this);
+    return face_iterator_t(face_descriptor_t(number_of_internal_faces()), this);
 }
 
 void write_off(const char* fpath, const mcut::mesh_t& mesh)
@@ -25,8 +25,10 @@
 #include "mcut/internal/geom.h"
 #include "mcut/internal/halfedge_mesh.h"
 #include "mcut/internal/math.h"
+#include "mcut/internal/parallel.h"
 #include "mcut/internal/utils.h"
 #include <algorithm>
+#include <atomic>
 //#include <fstream>
 #include <functional>
 #include <queue>
@@ -34,15 +36,6 @@
 #include <string>
 #include <tuple>
 
-//#define MCUT_MULTI_THREADED_IMPL
-
-#if defined(MCUT_MULTI_THREADED_IMPL)
-
-#include <mutex>
-#include <thread>
-
-#endif // #if defined(MCUT_MULTI_THREADED_IMPL)
-
 // keep around the intermediate meshes created during patch stitching (good for showing how code works)
 #define MCUT_KEEP_TEMP_CCs_DURING_PATCH_STITCHING 1
 
@@ -55,8 +48,8 @@
 
 #if defined(DUMP_ELAPSED_TIME_INFO)
 #include <ctime>
-std::map<std::string, clock_t> ptimes;
-std::string ptimeName;
+thread_local std::map<std::string, clock_t> ptimes;
+thread_local std::string ptimeName;
 #define TIME_PROFILE_START(name) \
     ptimes[name] = clock();      \
     ptimeName = name;
@@ -74,10 +67,41 @@ std::string ptimeName;
 namespace mcut
 {
 
-    logger_t *logger_ptr = nullptr;
+    // logger of the dispatch call that is running on this thread (dispatch calls on
+    // different contexts can run concurrently)
+    thread_local logger_t *logger_ptr = nullptr;
+
+    // sets "logger_ptr" for the lifetime of a dispatch call, and then restores the previous value.
+    // NOTE: a thread that waits for its helpers may execute (part of) another dispatch call in the meantime
+    struct logger_ptr_scope_t
+    {
+        logger_t *previous;
+
+        explicit logger_ptr_scope_t(logger_t *current) : previous(logger_ptr)
+        {
+            logger_ptr = current;
+        }
+
+        ~logger_ptr_scope_t()
+        {
+            logger_ptr = previous;
+        }
+    };
+
+    // The following functions return the strings which describe mesh elements in the log.
+    // They return an empty string if the log is disabled, since building the strings for
+    // every element visited by the kernel costs more than the visit itself.
+    bool element_strings_are_logged()
+    {
+        return logger_ptr != nullptr && logger_ptr->verbose();
+    }
 
     std::string vstr(const vd_t &v, const std::string &pre = "", const std::string &post = "")
     {
+        if (!element_strings_are_logged())
+        {
+            return std::string();
+        }
         std::stringstream ss;
         ss << pre << "v" << v << post;
         return ss.str();
@@ -85,6 +109,10 @@ namespace mcut
 
     std::string fstr(const fd_t &f, const std::string &pre = "", const std::string &post = "")
     {
+        if (!element_strings_are_logged())
+        {
+            return std::string();
+        }
         std::stringstream ss;
         ss << pre << "f";
         if (f != mesh_t::null_face())
@@ -104,6 +132,10 @@ namespace mcut
 
     std::string hstr(const mesh_t &m, const hd_t &h)
     {
+        if (!element_strings_are_logged())
+        {
+            return std::string();
+        }
         std::stringstream ss;
         ss << "h" << h << " ";
         return ss.str() + hstr_(m.source(h), m.target(h));
@@ -111,6 +143,10 @@ namespace mcut
 
     std::string estr(const mesh_t &m, const ed_t &e, const std::string &pre = "(", const std::string &post = ")", const std::string &delim = " ")
     {
+        if (!element_strings_are_logged())
+        {
+            return std::string();
+        }
         std::stringstream ss;
         ss << "e" << e << " ";
         return ss.str() + hstr_(m.vertex(e, 0), m.vertex(e, 1), pre, post, delim);
@@ -118,6 +154,10 @@ namespace mcut
 
     std::string estr(const vd_t &s, const vd_t &t, const std::string &pre = "(", const std::string &post = ")", const std::string &delim = " ")
     {
+        if (!element_strings_are_logged())
+        {
+            return std::string();
+        }
         std::stringstream ss;
         return ss.str() + hstr_(s, t, pre, post, delim);
     }
@@ -232,6 +272,20 @@ namespace mcut
         return ((int)ps_fd) >= sm_face_count;
     }
 
+    // returns the cut-mesh descriptor of a polygon-soup vertex that belongs to the cut mesh
+    vd_t ps_to_cm_vertex(const vd_t &ps_vd, const int sm_vtx_cnt)
+    {
+        MCUT_ASSERT(ps_is_cutmesh_vertex(ps_vd, sm_vtx_cnt));
+        return static_cast<vd_t>(ps_vd - sm_vtx_cnt);
+    }
+
+    // returns the cut-mesh descriptor of a polygon-soup face that belongs to the cut mesh
+    fd_t ps_to_cm_face(const fd_t &ps_fd, const int sm_face_count)
+    {
+        MCUT_ASSERT(ps_is_cutmesh_face(ps_fd, sm_face_count));
+        return static_cast<fd_t>(ps_fd - sm_face_count);
+    }
+
     void dump_mesh(const mesh_t &mesh, const char *fbasename)
     {
         const std::string name = std::string(fbasename) + ".off";
@@ -307,6 +361,17 @@ namespace mcut
         write_off(name.c_str(), mesh);
     }
 
+    // returns the representative of the vertex set containing the vertex at "position" (see "find_connected_components")
+    int find_vertex_set_index(std::vector<int> &vertex_set_parent, int position)
+    {
+        while (vertex_set_parent[position] != position)
+        {
+            vertex_set_parent[position] = vertex_set_parent[vertex_set_parent[position]]; // path halving
+            position = vertex_set_parent[position];
+        }
+        return position;
+    }
+
     int find_connected_components(std::map<face_descriptor_t, int> &fccmap, const mesh_t &mesh)
     {
         MCUT_ASSERT(mesh.number_of_vertices() >= 3);
@@ -315,103 +380,73 @@ namespace mcut
 
         fccmap.clear();
 
-        std::vector<std::vector<mcut::vertex_descriptor_t>> vertex_sets;
-        std::map<mcut::vertex_descriptor_t, int> vertex_to_set_index;
+        // Each vertex starts in a set of its own, whose index is the position of the vertex in
+        // the vertex list. The sets are stored as a disjoint-set forest, where the index of a set
+        // is the position of its root. When two sets are joined, the index of the set containing
+        // the first vertex of the edge is kept.
+        std::vector<int> vertex_to_position(mesh.number_of_internal_vertices(), -1);
+        std::vector<int> vertex_set_parent; // per vertex position
+        vertex_set_parent.reserve(mesh.number_of_vertices());
 
         for (mcut::mesh_t::vertex_iterator_t v = mesh.vertices_begin(); v != mesh.vertices_end(); ++v)
         {
-            vertex_to_set_index[*v] = (int)mcut::mesh_t::vertex_iterator_t::distance(mesh.vertices_begin(), v); // std::distance(mesh.vertices_begin(), v);
-            vertex_sets.push_back({*v});                                                                        // make set of one
+            const int position = (int)vertex_set_parent.size();
+            vertex_to_position[*v] = position;
+            vertex_set_parent.push_back(position); // make set of one
         }
 
         for (mcut::mesh_t::edge_iterator_t e = mesh.edges_begin(); e != mesh.edges_end(); ++e)
         {
-
-            mcut::vertex_descriptor_t v0 = mesh.vertex(*e, 0);
-            mcut::vertex_descriptor_t v1 = mesh.vertex(*e, 1);
-
-            int v0_set_index = vertex_to_set_index[v0];
-            int v1_set_index = vertex_to_set_index[v1];
+            const int v0_set_index = find_vertex_set_index(vertex_set_parent, vertex_to_position[mesh.vertex(*e, 0)]);
+            const int v1_set_index = find_vertex_set_index(vertex_set_parent, vertex_to_position[mesh.vertex(*e, 1)]);
 
             if (v0_set_index != v1_set_index)
             { // are they in different sets...?
-
-                std::vector<std::vector<mcut::vertex_descriptor_t>>::iterator v0_set = vertex_sets.begin() + v0_set_index;
-                std::vector<std::vector<mcut::vertex_descriptor_t>>::iterator v1_set = vertex_sets.begin() + v1_set_index;
-                ;
-
-                v0_set->insert(v0_set->cend(), v1_set->cbegin(), v1_set->cend()); // union/join sets
-
-                // update the set index of all vertices in set of v1
-
-                for (std::vector<mcut::vertex_descriptor_t>::const_iterator it = v1_set->cbegin();
-                     it != v1_set->cend();
-                     ++it)
-                {
-                    vertex_to_set_index[*it] = v0_set_index; // update set index
-                }
-
-                v1_set->clear(); // wipe elements (no longer needed) but keep empty set
+                vertex_set_parent[v1_set_index] = v0_set_index; // union/join sets
             }
         }
 
         // the sets which contain vertices that belong to separate connected components i.e. each set is a conn comp.
         // size of set is the number of connected components
-        std::set<int> final_set_indices;
-        std::map<int, int> final_set_index_to_vertex_count;
+        const int num_vertex_positions = (int)vertex_set_parent.size();
+        std::vector<int> vertex_set_size(num_vertex_positions, 0);
 
-        for (mcut::mesh_t::vertex_iterator_t v = mesh.vertices_begin(); v != mesh.vertices_end(); ++v)
+        for (int i = 0; i < num_vertex_positions; ++i)
         {
-
-            const int vertex_set_index = vertex_to_set_index[*v];
-            final_set_indices.insert(vertex_set_index); // NOTE: unique elements only
-
-            if (final_set_index_to_vertex_count.count(vertex_set_index) == 0)
-            {
-                final_set_index_to_vertex_count[vertex_set_index] = 0; // init
-            }
-
-            final_set_index_to_vertex_count[vertex_set_index] += 1;
+            vertex_set_size[find_vertex_set_index(vertex_set_parent, i)] += 1;
         }
 
         // map set index to a renormalized index (0 ,..., N-1)
-        std::map<int, int> final_set_index_to_linear_index;
+        std::vector<int> final_set_index_to_linear_index(num_vertex_positions, 0);
+        int num_connected_components = 0;
 
-        for (std::set<int>::const_iterator set_index_iter = final_set_indices.cbegin(); set_index_iter != final_set_indices.cend(); set_index_iter++)
+        for (int i = 0; i < num_vertex_positions; ++i)
         {
-            if (final_set_index_to_vertex_count[*set_index_iter] < 3) // 3 is min number of vertices which make up a "connected component" (triangle)
+            if (vertex_set_size[i] < 3) // 3 is min number of vertices which make up a "connected component" (triangle)
             {
-                continue;
+                continue; // NOTE: also skips the indices of the joined sets (which are empty)
             }
-            final_set_index_to_linear_index[*set_index_iter] = (int)final_set_index_to_linear_index.size();
+            final_set_index_to_linear_index[i] = num_connected_components++;
         }
 
         // map each face to a connected component
         for (mesh_t::face_iterator_t f = mesh.faces_begin(); f != mesh.faces_end(); ++f)
         {
             const std::vector<vertex_descriptor_t> vertices = mesh.get_vertices_around_face(*f);
+            const int set_idx = find_vertex_set_index(vertex_set_parent, vertex_to_position[vertices.front()]); // all vertices belong to the same conn comp
 
 #ifndef NDEBUG
-
             // assert
             for (int i = 0; i < (int)vertices.size(); ++i)
             {
-                for (int j = 0; j < (int)vertices.size(); ++j)
-                {
-                    if (i != j)
-                    {
-                        MCUT_ASSERT(vertex_to_set_index[vertices[i]] == vertex_to_set_index[vertices[j]]);
-                    }
-                }
+                MCUT_ASSERT(find_vertex_set_index(vertex_set_parent, vertex_to_position[vertices[i]]) == set_idx);
             }
+#endif // !NDEBUG
 
-#endif                                                           // !NDEBUG
-            int set_idx = vertex_to_set_index[vertices.front()]; // all vertices belong to the same conn comp
-            int descr = final_set_index_to_linear_index[set_idx];
-            fccmap[*f] = descr;
+            fccmap[*f] = final_set_index_to_linear_index[set_idx];
         }
 
-        return (int)final_set_index_to_linear_index.size();
+        return num_connected_components;
     }
 
     struct connected_component_info_t
@@ -440,10 +475,22 @@ namespace mcut
         }
     }
 
+    // a connected component that is built by one task of "extract_connected_components"
+    struct extracted_connected_component_t
+    {
+        std::size_t cc_id = 0;
+        // whether the connected component is added into the output of "extract_connected_components"
+        bool save = false;
+        mesh_t mesh;
+        connected_component_info_t info;
+    };
+
     // returns the unseparated/merged connected components
     mesh_t extract_connected_components(
         // key = cc-id; value = list of cc copies each differing by one newly stitched polygon
         std::map<std::size_t, std::vector<std::pair<mesh_t, connected_component_info_t>>> &connected_components,
+        // the threads that build the connected components
+        thread_pool &scheduler,
         const mesh_t &in,
         const int traced_polygons_base_offset,
         const std::vector<std::vector<hd_t>> &mX_traced_polygons, // "m0" or "m1" (dependent on function-call location)
@@ -456,10 +503,6 @@ namespace mcut
         const std::map<int /*"m0" face idx*/, int /*"m1" face idx*/> &m1_to_m0_face_colored,
         const std::map<vd_t /*"m0" ovtx*/, vd_t /*"ps" ovtx*/> &m0_to_ps_vtx,
         const std::map<int /*"m0" face idx*/, fd_t /*"ps" face*/> &m0_to_ps_face,
-        const std::map<vd_t /*"sm" vtx*/, vd_t /*"ps" vtx*/> &ps_to_sm_vtx,
-        const std::map<fd_t /*"sm" face*/, fd_t /*"ps" face*/> &ps_to_sm_face,
-        const std::map<vd_t /*"cm" vtx*/, vd_t /*"ps" vtx*/> &ps_to_cm_vtx,
-        const std::map<fd_t /*"cs" face*/, fd_t /*"ps" face*/> &ps_to_cm_face,
         const int sm_vtx_cnt,
         const int sm_face_count,
         bool popuplate_vertex_maps,
@@ -518,21 +561,6 @@ namespace mcut
         ///////////////////////////////////////////////////////////////////////////
         (*logger_ptr) << "search connected components" << std::endl;
 
-        // connected components
-        std::map<std::size_t, mesh_t> ccID_to_mesh;
-        // location of each connected component w.r.t cut-mesh (above | below | undefined)
-        std::map<std::size_t, connected_component_location_t> ccID_to_cs_descriptor;
-        // for each component, we have a map which relates the vertex descriptors (indices) in the
-        // auxilliary halfedge data structure "mesh" to the (local) vertex descriptors in
-        // the connected-component.
-        //
-        // the "X" in "...mX_..." stands for "0" or "1" depending on where the current function is called from!
-        // Before "m1" is created in "dispatch", X = "0". Afterwards, X == "1" to signify the fact that the
-        // input paramater called "in" (in this function) represents "m0" or "m1"
-        std::map<std::size_t, std::map<vd_t, vd_t>> ccID_to_mX_to_cc_vertex;
-        std::map<std::size_t, std::map<vd_t, vd_t>> ccID_to_cc_to_mX_vertex;
-        // the vertex descriptors [in the cc] which are seam vertices!
-        std::map<std::size_t, std::vector<vd_t>> cc_to_seam_vertices;
         // here we create a map to tag each polygon in "mesh" with the connected component it belongs to.
         std::map<face_descriptor_t, int> fccmap;
 
@@ -540,395 +568,363 @@ namespace mcut
 
         (*logger_ptr) << "connected components = " << num << std::endl;
 
-        ///////////////////////////////////////////////////////////////////////////
-        // Map vertex descriptors to each connected component
-        ///////////////////////////////////////////////////////////////////////////
-
-        // NOTE: even if the number of connected components is one, we proceed anyway
-        // because each connected connected excludes unused vertices in "mesh"
+        // the faces of each connected component (in the order of "mesh")
+        std::vector<std::vector<fd_t>> ccID_to_faces(num);
 
-        // for each face in the auxilliary mesh (i.e. traced polygon)
         for (mesh_t::face_iterator_t face_iter = mesh.faces_begin(); face_iter != mesh.faces_end(); ++face_iter)
         {
+            const int face_cc_id = fccmap.at(*face_iter);
+            MCUT_ASSERT(face_cc_id >= 0 && face_cc_id < (int)num);
+            ccID_to_faces[face_cc_id].push_back(*face_iter);
+        }
 
-            face_descriptor_t fd = *face_iter;
-            const int face_cc_id = fccmap[fd]; // get connected component of face
+        fccmap.clear(); // free
 
-            if (ccID_to_mesh.find(face_cc_id) == ccID_to_mesh.end())
-            {
-                // create new mesh to store connected component
-                ccID_to_mesh.insert(std::make_pair(face_cc_id, mesh_t()));
-            }
+        // sorted for binary search
+        std::vector<int> sorted_sm_polygons_below_cs(sm_polygons_below_cs);
+        std::sort(sorted_sm_polygons_below_cs.begin(), sorted_sm_polygons_below_cs.end());
+        std::vector<int> sorted_sm_polygons_above_cs(sm_polygons_above_cs);
+        std::sort(sorted_sm_polygons_above_cs.begin(), sorted_sm_polygons_above_cs.end());
 
-            if (ccID_to_mX_to_cc_vertex.find(face_cc_id) == ccID_to_mX_to_cc_vertex.end())
-            {
-                // create new component descriptor map
-                ccID_to_mX_to_cc_vertex.insert(std::make_pair(face_cc_id, std::map<vd_t, vd_t>()));
-                ccID_to_cc_to_mX_vertex[face_cc_id] = std::map<vd_t, vd_t>();
-            }
+        ///////////////////////////////////////////////////////////////////////////
+        // Build the connected components
+        ///////////////////////////////////////////////////////////////////////////
 
-            //
-            // Determine the location of the connected component w.r.t the cut-mesh (above/below/undefined)
-            //
+        // NOTE: The connected components are built concurrently (one task per connected component) since they
+        // share no data except the (read-only) auxilliary mesh. The tasks do not log because the logger is not
+        // thread-safe.
 
-            // check if the current face is already marked as "below" (w.r.t the cut-mesh).
-            const bool cc_is_below_cs = std::find(sm_polygons_below_cs.cbegin(), sm_polygons_below_cs.cend(), static_cast<int>(fd)) != sm_polygons_below_cs.cend();
+        std::vector<extracted_connected_component_t> extracted_ccs(num);
 
-            if (cc_is_below_cs)
-            {
-                // try to save the fact that the current connected component is "below"
-                std::pair<std::map<std::size_t, connected_component_location_t>::iterator, bool> p = ccID_to_cs_descriptor.insert(std::make_pair(face_cc_id, connected_component_location_t::BELOW));
-                // if 1) insertion did not take place (connected component already registered), and
-                // 2) the existing connected component at that entry is marked as "above":
-                //  --> partial cut: thus, the notion "above"/"below" is undefined
-                if (p.second == false && p.first->second == connected_component_location_t::ABOVE)
-                {
-                    // polygon classed as both above and below cs
-                    // this is because the connected component contains polygons which are both "above"
-                    // and "below" the cutting surface (we have a partial cut)
-                    p.first->second = connected_component_location_t::UNDEFINED;
-                }
-            }
+        auto build_connected_component = [&](const std::size_t cc_id) {
+            extracted_connected_component_t &extracted_cc = extracted_ccs[cc_id];
+            extracted_cc.cc_id = cc_id;
 
-            // check if connected component is marked as "above"
-            const bool cc_is_above_cs = std::find(sm_polygons_above_cs.cbegin(), sm_polygons_above_cs.cend(), static_cast<int>(fd)) != sm_polygons_above_cs.cend();
+            const std::vector<fd_t> &cc_faces = ccID_to_faces[cc_id];
 
-            if (cc_is_above_cs)
+            if (cc_faces.empty())
             {
-                // try to save the fact that the current connected component is tagged "above"
-                std::pair<std::map<std::size_t, connected_component_location_t>::iterator, bool> p = ccID_to_cs_descriptor.insert(std::make_pair(face_cc_id, connected_component_location_t::ABOVE));
-                // if 1) insertion did not take place (connected component is already registered), and
-                // 2) the existing connected component at that entry is marked as "below":
-                //--> partial cut: connected component has polygon whch are both "above" and "below"
-                if (p.second == false && p.first->second == connected_component_location_t::BELOW)
-                {
-                    p.first->second = connected_component_location_t::UNDEFINED; // polygon classed as both above and below cs
-                }
+                return; // i.e. the vertices and edges of "in" that are not used by the traced polygons
             }
 
+            mesh_t &cc_mesh = extracted_cc.mesh;
+            connected_component_info_t &ccinfo = extracted_cc.info;
+
             //
-            // We now map the vertices of the current face from the auxilliary data
-            // structure "mesh" to the (local) connected-component
+            // Determine the location of the connected component w.r.t the cut-mesh (above/below/undefined)
             //
 
-            // for each vertex around the current face
-            const std::vector<vertex_descriptor_t> vertices_around_face = mesh.get_vertices_around_face(fd);
-            for (std::vector<vertex_descriptor_t>::const_iterator face_vertex_iter = vertices_around_face.cbegin();
-                 face_vertex_iter != vertices_around_face.cend();
-                 ++face_vertex_iter)
+            bool cc_has_location = false; // seams have no notion of "location"
+            connected_component_location_t cc_location = connected_component_location_t::UNDEFINED;
+
+            for (std::vector<fd_t>::const_iterator face_iter = cc_faces.cbegin(); face_iter != cc_faces.cend(); ++face_iter)
             {
+                const int fd = static_cast<int>(*face_iter);
 
-                MCUT_ASSERT(ccID_to_mX_to_cc_vertex.find(face_cc_id) != ccID_to_mX_to_cc_vertex.cend());
+                // check if the current face is already marked as "below" (w.r.t the cut-mesh).
+                const bool face_is_below_cs = std::binary_search(sorted_sm_polygons_below_cs.cbegin(), sorted_sm_polygons_below_cs.cend(), fd);
 
-                // if vertex is not already mapped from "mesh" to connected component
-                if (ccID_to_mX_to_cc_vertex.at(face_cc_id).find(*face_vertex_iter) == ccID_to_mX_to_cc_vertex.at(face_cc_id).end())
+                if (face_is_below_cs)
                 {
+                    if (!cc_has_location)
+                    {
+                        cc_has_location = true;
+                        cc_location = connected_component_location_t::BELOW;
+                    }
+                    else if (cc_location == connected_component_location_t::ABOVE)
+                    {
+                        // polygon classed as both above and below cs
+                        // this is because the connected component contains polygons which are both "above"
+                        // and "below" the cutting surface (we have a partial cut)
+                        cc_location = connected_component_location_t::UNDEFINED;
+                    }
+                }
 
-                    MCUT_ASSERT(ccID_to_mesh.find(face_cc_id) != ccID_to_mesh.cend());
-
-                    // copy vertex from auxilliary data structure "mesh", add it into connected component mesh,
-                    // and save the vertex's descriptor in the conected component mesh.
-                    const vd_t cc_descriptor = ccID_to_mesh.at(face_cc_id).add_vertex(mesh.vertex(*face_vertex_iter));
+                // check if connected component is marked as "above"
+                const bool face_is_above_cs = std::binary_search(sorted_sm_polygons_above_cs.cbegin(), sorted_sm_polygons_above_cs.cend(), fd);
 
-                    // map vertex
-                    ccID_to_mX_to_cc_vertex.at(face_cc_id).insert(std::make_pair(*face_vertex_iter, cc_descriptor));
-                    if (popuplate_vertex_maps)
+                if (face_is_above_cs)
+                {
+                    if (!cc_has_location)
                     {
-                        ccID_to_cc_to_mX_vertex.at(face_cc_id).insert(std::make_pair(cc_descriptor, *face_vertex_iter));
+                        cc_has_location = true;
+                        cc_location = connected_component_location_t::ABOVE;
                     }
-                    // check if we need to save vertex as being a seam vertex
-                    std::map<vd_t, bool>::const_iterator fiter = mesh_vertex_to_seam_flag.find(*face_vertex_iter);
-                    bool is_seam_vertex = fiter != mesh_vertex_to_seam_flag.cend() && fiter->second == true;
-                    if (is_seam_vertex)
+                    else if (cc_location == connected_component_location_t::BELOW)
                     {
-                        cc_to_seam_vertices[face_cc_id].push_back(cc_descriptor);
+                        cc_location = connected_component_location_t::UNDEFINED; // polygon classed as both above and below cs
                     }
                 }
             }
-        }
-
-        //bool extractingSeams = (m1_num_vertices_after_srcmesh_partitioning == -1);
-
-        // stores a flag per connected component indicating whether we should
-        // keep this CC or throw it away, as per user flags.
-        std::map<size_t, bool> ccID_to_keepFlag;
-        for (std::map<size_t, mesh_t>::const_iterator it = ccID_to_mesh.cbegin(); it != ccID_to_mesh.cend(); ++it)
-        {
-            int ccID = (int)it->first;
-            std::map<std::size_t, connected_component_location_t>::iterator fiter = ccID_to_cs_descriptor.find(ccID);
-            const bool isSeam = (fiter == ccID_to_cs_descriptor.cend());                                                                    // Seams have no notion of "location"
-            ccID_to_keepFlag[ccID] = isSeam || ((keep_fragments_above_cutmesh && fiter->second == connected_component_location_t::ABOVE) || //
-                                                (keep_fragments_below_cutmesh && fiter->second == connected_component_location_t::BELOW) || //
-                                                (keep_fragments_partially_cut && fiter->second == connected_component_location_t::UNDEFINED));
-        }
-
-        ///////////////////////////////////////////////////////////////////////////
-        // TODO: shift the logic to add vertices into CC to here (like for face below)
-        ///////////////////////////////////////////////////////////////////////////
-
-        ///////////////////////////////////////////////////////////////////////////
-        // Insert faces into connected components using mapped vertex descriptors
-        ///////////////////////////////////////////////////////////////////////////
 
-        std::map<size_t, std::map<fd_t, fd_t>> ccID_to_cc_to_mX_face;
-
-        // for each face in the auxilliary data structure "mesh" (traced polygon)
-        for (mesh_t::face_iterator_t face_iter = mesh.faces_begin(); face_iter != mesh.faces_end(); ++face_iter)
-        {
-            face_descriptor_t fd = *face_iter;
-            const size_t cc_id = fccmap[fd]; // the connected component which contains the current face
-
-            bool userWantsCC = ccID_to_keepFlag.at(cc_id);
+            // keep this CC or throw it away, as per user flags.
+            const bool userWantsCC = !cc_has_location || ((keep_fragments_above_cutmesh && cc_location == connected_component_location_t::ABOVE) || //
+                                                          (keep_fragments_below_cutmesh && cc_location == connected_component_location_t::BELOW) || //
+                                                          (keep_fragments_partially_cut && cc_location == connected_component_location_t::UNDEFINED));
 
             if (!userWantsCC)
             {
-                continue;
+                return;
             }
 
-            std::vector<vd_t> remapped_face; // using remapped cc descriptors
-            std::map<size_t, std::map<fd_t, fd_t>>::iterator ccID_to_cc_to_mX_face_fiter = ccID_to_cc_to_mX_face.find(cc_id);
+            // The boolean is needed to prevent saving duplicate connected components into the vector "connected_components[cc_id]".
+            // This can happen because the current function is called for each new cut-mesh polygon that is stitched, during the
+            // polygon stitching phases. In the other times when the current function is called, we are guarranteed that
+            // "connected_components[cc_id]" is empty.
+            //
+            // The above has the implication that the newly stitched polygon (during the stitching phase) is added to just [one] of the
+            // discovered connected components (which are of a particular color tag), thus leaving the other connected components to be
+            // discovered as having exactly the same number of polygons as before since no new polygon has been added to them.
+            // So to prevent this connected component dupliction issue, a connected component is only added into "connected_components[cc_id]"
+            // if the following hold:
+            // 1) "connected_components[cc_id]" is empty (making the added connected component new and unique)
+            // 2) the most-recent connected component instance at "connected_components[cc_id].back()" has less faces (in which case, always differing by one)
+            //    than the new connected component we wish to add i.e. "cc"
+            std::map<std::size_t, std::vector<std::pair<mesh_t, connected_component_info_t>>>::const_iterator saved_instances = connected_components.find(cc_id);
 
-            if (ccID_to_cc_to_mX_face_fiter == ccID_to_cc_to_mX_face.cend())
+            if (saved_instances != connected_components.cend() && !saved_instances->second.empty() && //
+                saved_instances->second.back().first.number_of_faces() == (int)cc_faces.size())
             {
-                std::pair<std::map<size_t, std::map<fd_t, fd_t>>::iterator, bool> r = ccID_to_cc_to_mX_face.insert(std::make_pair(cc_id, std::map<fd_t, fd_t>()));
-                ccID_to_cc_to_mX_face_fiter = r.first;
+                return;
             }
 
-            MCUT_ASSERT(ccID_to_cc_to_mX_face_fiter != ccID_to_cc_to_mX_face.cend());
-            std::map<fd_t, fd_t> &cc_to_mX_face = ccID_to_cc_to_mX_face_fiter->second;
+            extracted_cc.save = true;
 
-            // for each vertex around face
-            const std::vector<vertex_descriptor_t> vertices_around_face = mesh.get_vertices_around_face(fd);
+            //
+            // We now map the vertices of the faces from the auxilliary data
+            // structure "mesh" to the (local) connected-component
+            //
 
-            for (std::vector<vertex_descriptor_t>::const_iterator face_vertex_iter = vertices_around_face.cbegin();
-                 face_vertex_iter != vertices_around_face.cend();
-                 ++face_vertex_iter)
-            {
-                MCUT_ASSERT(ccID_to_mX_to_cc_vertex.find(cc_id) != ccID_to_mX_to_cc_vertex.cend());
+            // the "X" in "...mX_..." stands for "0" or "1" depending on where the current function is called from!
+            // Before "m1" is created in "dispatch", X = "0". Afterwards, X == "1" to signify the fact that the
+            // input paramater called "in" (in this function) represents "m0" or "m1"
+            std::map<vd_t, vd_t> mX_to_cc_vertex;
+            std::map<vd_t, vd_t> cc_to_mX_vertex;
+            std::map<fd_t, fd_t> cc_to_mX_face;
 
-                const std::map<vd_t, vd_t> &vertex_map = ccID_to_mX_to_cc_vertex.at(cc_id);
-                const vd_t m1_sm_descr = *face_vertex_iter;
+            // for each face in the auxilliary mesh (i.e. traced polygon) of the connected component
+            for (std::vector<fd_t>::const_iterator face_iter = cc_faces.cbegin(); face_iter != cc_faces.cend(); ++face_iter)
+            {
+                const fd_t fd = *face_iter;
+                std::vector<vd_t> remapped_face; // using remapped cc descriptors
+
+                // for each vertex around the current face
+                const std::vector<vertex_descriptor_t> vertices_around_face = mesh.get_vertices_around_face(fd);
+                for (std::vector<vertex_descriptor_t>::const_iterator face_vertex_iter = vertices_around_face.cbegin();
+                     face_vertex_iter != vertices_around_face.cend();
+                     ++face_vertex_iter)
+                {
+                    std::map<vd_t, vd_t>::const_iterator fiter = mX_to_cc_vertex.find(*face_vertex_iter);
 
-                MCUT_ASSERT(vertex_map.find(m1_sm_descr) != vertex_map.cend());
+                    // if vertex is not already mapped from "mesh" to connected component
+                    if (fiter == mX_to_cc_vertex.cend())
+                    {
+                        // copy vertex from auxilliary data structure "mesh", add it into connected component mesh,
+                        // and save the vertex's descriptor in the conected component mesh.
+                        const vd_t cc_descriptor = cc_mesh.add_vertex(mesh.vertex(*face_vertex_iter));
 
-                const vd_t cc_descr = vertex_map.at(m1_sm_descr);
-                remapped_face.push_back(cc_descr);
-            }
+                        // map vertex
+                        fiter = mX_to_cc_vertex.insert(std::make_pair(*face_vertex_iter, cc_descriptor)).first;
+                        if (popuplate_vertex_maps)
+                        {
+                            cc_to_mX_vertex.insert(std::make_pair(cc_descriptor, *face_vertex_iter));
+                        }
+                        // check if we need to save vertex as being a seam vertex
+                        std::map<vd_t, bool>::const_iterator seam_fiter = mesh_vertex_to_seam_flag.find(*face_vertex_iter);
+                        bool is_seam_vertex = seam_fiter != mesh_vertex_to_seam_flag.cend() && seam_fiter->second == true;
+                        if (is_seam_vertex)
+                        {
+                            ccinfo.seam_vertices.push_back(cc_descriptor);
+                        }
+                    }
 
-            MCUT_ASSERT(ccID_to_mesh.find(cc_id) != ccID_to_mesh.cend());
+                    remapped_face.push_back(fiter->second);
+                }
 
-            mesh_t &cc_mesh = ccID_to_mesh.at(cc_id);
-            fd_t f = cc_mesh.add_face(remapped_face); // insert the face
+                fd_t f = cc_mesh.add_face(remapped_face); // insert the face
 
-            MCUT_ASSERT(f != mesh_t::null_face());
+                MCUT_ASSERT(f != mesh_t::null_face());
 
-            if (popuplate_face_maps)
-            {
-                MCUT_ASSERT(cc_to_mX_face.count(f) == 0);
-                cc_to_mX_face[f] = fd;
+                if (popuplate_face_maps)
+                {
+                    MCUT_ASSERT(cc_to_mX_face.count(f) == 0);
+                    cc_to_mX_face[f] = fd;
+                }
             }
-        }
 
-        // Note: at this stage we have our connected components (meshes) with their
-        // vertices and faces defined
-
-        ///////////////////////////////////////////////////////////////////////////
-        // Save the output connected components marked with location
-        ///////////////////////////////////////////////////////////////////////////
-
-        // for each connected component
-        for (std::map<std::size_t, mesh_t>::const_iterator cc_iter = ccID_to_mesh.cbegin();
-             cc_iter != ccID_to_mesh.cend();
-             ++cc_iter)
-        {
-
-            const std::size_t &cc_id = cc_iter->first;
-            bool userWantsCC = ccID_to_keepFlag.at(cc_id);
-
-            if (!userWantsCC)
+            if (!sm_polygons_below_cs.empty() && !sm_polygons_above_cs.empty())
             {
-                continue;
+                MCUT_ASSERT(cc_has_location);
+                ccinfo.location = cc_location;
             }
 
-            const mesh_t &cc = cc_iter->second;
-
-            // The boolean is needed to prevent saving duplicate connected components into the vector "connected_components[cc_id]".
-            // This can happen because the current function is called for each new cut-mesh polygon that is stitched, during the
-            // polygon stitching phases. In the other times when the current function is called, we are guarranteed that
-            // "connected_components[cc_id]" is empty.
             //
-            // The above has the implication that the newly stitched polygon (during the stitching phase) is added to just [one] of the
-            // discovered connected components (which are of a particular color tag), thus leaving the other connected components to be
-            // discovered as having exactly the same number of polygons as before since no new polygon has been added to them.
-            // So to prevent this connected component dupliction issue, a connected component is only added into "connected_components[cc_id]"
-            // if the following hold:
-            // 1) "connected_components[cc_id]" is empty (making the added connected component new and unique)
-            // 2) the most-recent connected component instance at "connected_components[cc_id].back()" has less faces (in which case, always differing by one)
-            //    than the new connected component we wish to add i.e. "cc"
-            bool proceed_to_save_mesh = connected_components[cc_id].empty() || connected_components[cc_id].back().first.number_of_faces() != cc.number_of_faces();
+            // Map vertex and face descriptors to original values in the input source- and cut-mesh
+            // For vertices it is only non-intersection points that have defined mapping otherwise
+            // the mapped-to value is undefined (mesh_t::null_vertex())
+            //
 
-            if (proceed_to_save_mesh)
-            {
-                (*logger_ptr) << "connected component id = " << cc_id << std::endl;
+            const mesh_t &cc = cc_mesh;
 
-                (*logger_ptr).indent();
-                connected_component_location_t location = connected_component_location_t::UNDEFINED;
+            if (popuplate_vertex_maps)
+            {
+                // map cc vertices to original input mesh
+                // -----------------------------------
 
-                if (!sm_polygons_below_cs.empty() && !sm_polygons_above_cs.empty())
+                for (mesh_t::vertex_iterator_t i = cc.vertices_begin(); i != cc.vertices_end(); ++i)
                 {
-                    MCUT_ASSERT(ccID_to_cs_descriptor.find(cc_id) != ccID_to_cs_descriptor.cend());
-                    location = ccID_to_cs_descriptor.at(cc_id);
-                }
+                    const vd_t cc_descr = *i;
+                    MCUT_ASSERT(cc_to_mX_vertex.count(cc_descr) == 1);
+                    const vd_t mX_descr = cc_to_mX_vertex.at(cc_descr);
 
-                connected_component_info_t ccinfo;
-                ccinfo.location = location;
-                ccinfo.seam_vertices = std::move(cc_to_seam_vertices[cc_id]);
+                    // NOTE: "m1_to_m0_sm_ovtx_colored" contains only non-intersection points from the source mesh
+                    std::map<vd_t, vd_t>::const_iterator m1_to_m0_sm_ovtx_colored_fiter = m1_to_m0_sm_ovtx_colored.find(mX_descr);
 
-                //
-                // Map vertex and face descriptors to original values in the input source- and cut-mesh
-                // For vertices it is only non-intersection points that have defined mapping otherwise
-                // the mapped-to value is undefined (mesh_t::null_vertex())
-                //
+                    bool is_m1_sm_overtex = m1_to_m0_sm_ovtx_colored_fiter != m1_to_m0_sm_ovtx_colored.cend();
+                    vd_t m0_descr = mesh_t::null_vertex(); // NOTE: two cut-mesh "m1" original vertices may map to one "m0" vertex (due to winding order duplication)
 
-                const std::map<vd_t, vd_t> &cc_to_mX_vertex = ccID_to_cc_to_mX_vertex.at(cc_id);
-
-                if (popuplate_vertex_maps)
-                {
-                    // map cc vertices to original input mesh
-                    // -----------------------------------
-
-                    for (mesh_t::vertex_iterator_t i = cc.vertices_begin(); i != cc.vertices_end(); ++i)
+                    if (is_m1_sm_overtex)
                     {
-                        const vd_t cc_descr = *i;
-                        MCUT_ASSERT(cc_to_mX_vertex.count(cc_descr) == 1);
-                        const vd_t mX_descr = cc_to_mX_vertex.at(cc_descr);
+                        m0_descr = m1_to_m0_sm_ovtx_colored_fiter->second;
+                    }
+                    else if (!m1_to_m0_cm_ovtx_colored.empty())
+                    { // are we in the stitching stage..? (calling with "m1")
+                        // Lets search through the map "m1_to_m0_cm_ovtx_colored"
 
-                        // NOTE: "m1_to_m0_sm_ovtx_colored" contains only non-intersection points from the source mesh
-                        std::map<vd_t, vd_t>::const_iterator m1_to_m0_sm_ovtx_colored_fiter = m1_to_m0_sm_ovtx_colored.find(mX_descr);
+                        // NOTE: "m1_to_m0_cm_ovtx_colored" contains only non-intersection points from the cut mesh
+                        std::map<vd_t, vd_t>::const_iterator m1_to_m0_cm_ovtx_colored_fiter = m1_to_m0_cm_ovtx_colored.find(mX_descr);
 
-                        bool is_m1_sm_overtex = m1_to_m0_sm_ovtx_colored_fiter != m1_to_m0_sm_ovtx_colored.cend();
-                        vd_t m0_descr = mesh_t::null_vertex(); // NOTE: two cut-mesh "m1" original vertices may map to one "m0" vertex (due to winding order duplication)
+                        bool is_m1_cm_overtex = m1_to_m0_cm_ovtx_colored_fiter != m1_to_m0_cm_ovtx_colored.cend();
 
-                        if (is_m1_sm_overtex)
+                        if (is_m1_cm_overtex)
                         {
-                            m0_descr = m1_to_m0_sm_ovtx_colored_fiter->second;
+                            m0_descr = m1_to_m0_cm_ovtx_colored_fiter->second;
                         }
-                        else if (!m1_to_m0_cm_ovtx_colored.empty())
-                        { // are we in the stitching stage..? (calling with "m1")
-                            // Lets search through the map "m1_to_m0_cm_ovtx_colored"
-
-                            // NOTE: "m1_to_m0_cm_ovtx_colored" contains only non-intersection points from the cut mesh
-                            std::map<vd_t, vd_t>::const_iterator m1_to_m0_cm_ovtx_colored_fiter = m1_to_m0_cm_ovtx_colored.find(mX_descr);
-
-                            bool is_m1_cm_overtex = m1_to_m0_cm_ovtx_colored_fiter != m1_to_m0_cm_ovtx_colored.cend();
+                    }
 
-                            if (is_m1_cm_overtex)
-                            {
-                                m0_descr = m1_to_m0_cm_ovtx_colored_fiter->second;
-                            }
-                        }
+                    if (m0_descr == mesh_t::null_vertex())
+                    { // if still not found, then we are strictly "mX" polygons is "m0" polygons
+                        m0_descr = mX_descr;
+                    }
 
-                        if (m0_descr == mesh_t::null_vertex())
-                        { // if still not found, then we are strictly "mX" polygons is "m0" polygons
-                            m0_descr = mX_descr;
-                        }
+                    const bool vertex_is_in_input_mesh_or_is_intersection_point = (m0_descr != mesh_t::null_vertex()); // i.e. is it an original vertex (its not an intersection point/along cut-path)
 
-                        const bool vertex_is_in_input_mesh_or_is_intersection_point = (m0_descr != mesh_t::null_vertex()); // i.e. is it an original vertex (its not an intersection point/along cut-path)
+                    if (vertex_is_in_input_mesh_or_is_intersection_point)
+                    {
+                        std::map<vd_t, vd_t>::const_iterator m0_to_ps_vtx_fiter = m0_to_ps_vtx.find(m0_descr);
+                        bool vertex_is_in_input_mesh = m0_to_ps_vtx_fiter != m0_to_ps_vtx.cend();
+                        vd_t input_mesh_descr = mesh_t::null_vertex(); // i.e. source-mesh or cut-mesh
 
-                        if (vertex_is_in_input_mesh_or_is_intersection_point)
+                        if (vertex_is_in_input_mesh)
                         {
-                            std::map<vd_t, vd_t>::const_iterator m0_to_ps_vtx_fiter = m0_to_ps_vtx.find(m0_descr);
-                            bool vertex_is_in_input_mesh = m0_to_ps_vtx_fiter != m0_to_ps_vtx.cend();
-                            vd_t input_mesh_descr = mesh_t::null_vertex(); // i.e. source-mesh or cut-mesh
-
-                            if (vertex_is_in_input_mesh)
+                            //MCUT_ASSERT(m0_to_ps_vtx.count(m0_descr) == 1);
+                            const vd_t ps_descr = m0_to_ps_vtx_fiter->second; // m0_to_ps_vtx.at(m0_descr);
+                            // we don't know whether it belongs to cut-mesh patch or source-mesh, so check
+                            const bool is_cutmesh_vtx = ps_is_cutmesh_vertex(ps_descr, sm_vtx_cnt);
+                            if (is_cutmesh_vtx)
                             {
-                                //MCUT_ASSERT(m0_to_ps_vtx.count(m0_descr) == 1);
-                                const vd_t ps_descr = m0_to_ps_vtx_fiter->second; // m0_to_ps_vtx.at(m0_descr);
-                                // we don't know whether it belongs to cut-mesh patch or source-mesh, so check
-                                const bool is_cutmesh_vtx = ps_is_cutmesh_vertex(ps_descr, sm_vtx_cnt);
-                                if (is_cutmesh_vtx)
-                                {
-                                    input_mesh_descr = ps_to_cm_vtx.at(ps_descr);
-                                    // add an offset which allows users to deduce which birth/origin mesh (source or cut mesh) a vertex (map value) belongs to.
-                                    input_mesh_descr = static_cast<vd_t>(input_mesh_descr + sm_vtx_cnt);
-                                }
-                                else
-                                { // source-mesh vertex
-                                    input_mesh_descr = ps_to_sm_vtx.at(ps_descr);
-                                }
+                                input_mesh_descr = ps_to_cm_vertex(ps_descr, sm_vtx_cnt);
+                                // add an offset which allows users to deduce which birth/origin mesh (source or cut mesh) a vertex (map value) belongs to.
+                                input_mesh_descr = static_cast<vd_t>(input_mesh_descr + sm_vtx_cnt);
+                            }
+                            else
+                            { // source-mesh vertex
+                                input_mesh_descr = ps_descr; // source-mesh descriptors are the same in "ps"
                             }
-
-                            MCUT_ASSERT(ccinfo.data_maps.vertex_map.count(cc_descr) == 0);
-                            ccinfo.data_maps.vertex_map[cc_descr] = input_mesh_descr;
                         }
+
+                        MCUT_ASSERT(ccinfo.data_maps.vertex_map.count(cc_descr) == 0);
+                        ccinfo.data_maps.vertex_map[cc_descr] = input_mesh_descr;
                     }
-                } // if (popuplate_vertex_maps) {
+                }
+            } // if (popuplate_vertex_maps) {
 
-                if (popuplate_face_maps)
+            if (popuplate_face_maps)
+            {
+                // map face to original input mesh
+                // -----------------------------------
+
+                for (mesh_t::face_iterator_t f = cc.faces_begin(); f != cc.faces_end(); ++f)
                 {
-                    // map face to original input mesh
-                    // -----------------------------------
-                    MCUT_ASSERT(ccID_to_cc_to_mX_face.count(cc_id) == 1);
+                    const fd_t cc_descr = *f;
+                    // account for the fact that the parameter "mX_traced_polygons" may contain only a subset of traced polygons
+                    // need this to compute correct polygon index to access std::maps
+                    //const fd_t cc_descr_offsetted(traced_polygons_base_offset + static_cast<int>(cc_descr));
+                    MCUT_ASSERT(cc_to_mX_face.count(cc_descr) == 1);
+                    const fd_t mX_descr = cc_to_mX_face.at(cc_descr);
+                    const fd_t offsetted_mX_descr(traced_polygons_base_offset + static_cast<int>(mX_descr)); // global traced polygon index
+                    int m0_descr = -1;
+
+                    if (m1_to_m0_face_colored.size() > 0)
+                    { // are we calling from during the patch stitching phase..?
+                        const fd_t m1_descr = offsetted_mX_descr;
+                        MCUT_ASSERT(m1_to_m0_face_colored.count(mX_descr) == 1);
+                        m0_descr = m1_to_m0_face_colored.at(m1_descr);
+                    }
+                    else
+                    {
+                        m0_descr = static_cast<int>(offsetted_mX_descr);
+                    }
 
-                    std::map<fd_t, fd_t> &cc_to_mX_face = ccID_to_cc_to_mX_face.at(cc_id);
+                    MCUT_ASSERT(m0_to_ps_face.count(m0_descr) == 1);
+                    const fd_t ps_descr = m0_to_ps_face.at(m0_descr); // every traced polygon can be mapped back to an input mesh polygon
+                    fd_t input_mesh_descr = mesh_t::null_face();
 
-                    for (mesh_t::face_iterator_t f = cc.faces_begin(); f != cc.faces_end(); ++f)
+                    const bool from_cutmesh_face = ps_is_cutmesh_face(ps_descr, sm_face_count);
+                    if (from_cutmesh_face)
                     {
-                        const fd_t cc_descr = *f;
-                        // account for the fact that the parameter "mX_traced_polygons" may contain only a subset of traced polygons
-                        // need this to compute correct polygon index to access std::maps
-                        //const fd_t cc_descr_offsetted(traced_polygons_base_offset + static_cast<int>(cc_descr));
-                        MCUT_ASSERT(cc_to_mX_face.count(cc_descr) == 1);
-                        const fd_t mX_descr = cc_to_mX_face.at(cc_descr);
-                        const fd_t offsetted_mX_descr(traced_polygons_base_offset + static_cast<int>(mX_descr)); // global traced polygon index
-                        int m0_descr = -1;
-
-                        if (m1_to_m0_face_colored.size() > 0)
-                        { // are we calling from during the patch stitching phase..?
-                            const fd_t m1_descr = offsetted_mX_descr;
-                            MCUT_ASSERT(m1_to_m0_face_colored.count(mX_descr) == 1);
-                            m0_descr = m1_to_m0_face_colored.at(m1_descr);
-                        }
-                        else
-                        {
-                            m0_descr = static_cast<int>(offsetted_mX_descr);
-                        }
-
-                        MCUT_ASSERT(m0_to_ps_face.count(m0_descr) == 1);
-                        const fd_t ps_descr = m0_to_ps_face.at(m0_descr); // every traced polygon can be mapped back to an input mesh polygon
-                        fd_t input_mesh_descr = mesh_t::null_face();
+                        input_mesh_descr = ps_to_cm_face(ps_descr, sm_face_count);
+                        // add an offset which allows users to deduce which birth/origin mesh (source or cut mesh) a face (map value) belongs to.
+                        input_mesh_descr = static_cast<fd_t>(input_mesh_descr + sm_face_count);
+                    }
+                    else
+                    {
+                        input_mesh_descr = ps_descr; // source-mesh descriptors are the same in "ps"
+                    }
 
-                        const bool from_cutmesh_face = ps_is_cutmesh_face(ps_descr, sm_face_count);
-                        if (from_cutmesh_face)
-                        {
-                            MCUT_ASSERT(ps_to_cm_face.count(ps_descr) == 1);
-                            input_mesh_descr = ps_to_cm_face.at(ps_descr);
-                            // add an offset which allows users to deduce which birth/origin mesh (source or cut mesh) a face (map value) belongs to.
-                            input_mesh_descr = static_cast<fd_t>(input_mesh_descr + sm_face_count);
-                        }
-                        else
-                        {
-                            MCUT_ASSERT(ps_to_sm_face.count(ps_descr) == 1);
-                            input_mesh_descr = ps_to_sm_face.at(ps_descr);
-                        }
+                    // map to input mesh face
+                    MCUT_ASSERT(ccinfo.data_maps.face_map.count(cc_descr) == 0);
+                    ccinfo.data_maps.face_map[cc_descr] = input_mesh_descr;
+                }
+            } // if (popuplate_face_maps) {
+        };
 
-                        // map to input mesh face
-                        MCUT_ASSERT(ccinfo.data_maps.face_map.count(cc_descr) == 0);
-                        ccinfo.data_maps.face_map[cc_descr] = input_mesh_descr;
-                    }
-                } // if (popuplate_face_maps) {
+        // the next connected component to build (the components differ greatly in size, so each thread takes the next one)
+        std::atomic<std::size_t> next_cc_id(0);
 
-                connected_components[cc_id].emplace_back(cc, std::move(ccinfo));
+        parallel_invoke(scheduler, get_parallel_block_count(scheduler, (uint32_t)num, 1), [&](uint32_t /*thread*/) {
+            for (std::size_t cc_id = next_cc_id++; cc_id < num; cc_id = next_cc_id++)
+            {
+                build_connected_component(cc_id);
+            }
+        });
 
-                (*logger_ptr) << "location = " << to_string(location) << std::endl;
-                (*logger_ptr) << "vertices = " << cc.number_of_vertices() << std::endl;
-                (*logger_ptr) << "edges = " << cc.number_of_edges() << std::endl;
-                (*logger_ptr) << "halfedges = " << cc.number_of_halfedges() << std::endl;
-                (*logger_ptr) << "faces = " << cc.number_of_faces() << std::endl;
+        ///////////////////////////////////////////////////////////////////////////
+        // Save the output connected components marked with location
+        ///////////////////////////////////////////////////////////////////////////
 
-                (*logger_ptr).unindent();
+        // for each connected component (in order)
+        for (std::vector<extracted_connected_component_t>::iterator cc_iter = extracted_ccs.begin();
+             cc_iter != extracted_ccs.end();
+             ++cc_iter)
+        {
+            if (!cc_iter->save)
+            {
+                continue;
             }
+
+            const mesh_t &cc = cc_iter->mesh;
+
+            (*logger_ptr) << "connected component id = " << cc_iter->cc_id << std::endl;
+            (*logger_ptr).indent();
+            (*logger_ptr) << "location = " << to_string(cc_iter->info.location) << std::endl;
+            (*logger_ptr) << "vertices = " << cc.number_of_vertices() << std::endl;
+            (*logger_ptr) << "edges = " << cc.number_of_edges() << std::endl;
+            (*logger_ptr) << "halfedges = " << cc.number_of_halfedges() << std::endl;
+            (*logger_ptr) << "faces = " << cc.number_of_faces() << std::endl;
+            (*logger_ptr).unindent();
+
+            connected_components[cc_iter->cc_id].emplace_back(std::move(cc_iter->mesh), std::move(cc_iter->info));
         }
         (*logger_ptr).unindent();
 
@@ -1659,81 +1655,249 @@ inline bool interior_edge_exists(const mesh_t& m, const vd_t& src, const vd_t& t
         return sorted_descriptors;
     }
 
-#if defined(MCUT_MULTI_THREADED_IMPL)
+    // intersection points found by the edge-to-face intersection tests of a range of "ps" edges
+    struct edge_face_intersections_t
+    {
+        // the intersection points (in the order in which they were found)
+        std::vector<math::vec3> points;
+        // the edge and face that were tested to find each point (i.e. the registry entry)
+        std::vector<std::pair<ed_t, fd_t>> registry_entries;
+        // set if a test found that the inputs are not in general position, in which case
+        // the tests of the remaining edges in the range were not performed
+        bool violated_general_position = false;
+        std::string reason_for_failure;
+    };
+
+    // the geometry of the faces against which the edges of "ps" are tested for intersection
+    struct tested_faces_info_t
+    {
+        std::map<fd_t, math::vec3> plane_normal;
+        std::map<fd_t, math::real_number_t> plane_normal_d_param;
+        std::map<fd_t, int> plane_normal_max_comp;
+        std::map<fd_t, std::vector<math::vec3>> vertices;
+    };
+
+    // compute the intersection points of the edges in the range [first, last) with the
+    // faces that they are paired with. This function only reads shared state and so it
+    // may be called concurrently on different ranges.
+    void edge_face_intersection_test_func(
+        std::map<ed_t, std::vector<fd_t>>::const_iterator first,
+        std::map<ed_t, std::vector<fd_t>>::const_iterator last,
+        const mesh_t &ps,
+        const tested_faces_info_t &ps_tested_faces_info,
+        // output
+        edge_face_intersections_t &intersections)
+    {
+        for (std::map<ed_t, std::vector<fd_t>>::const_iterator ps_edge_face_intersection_pairs_iter = first;
+             ps_edge_face_intersection_pairs_iter != last;
+             ps_edge_face_intersection_pairs_iter++)
+        {
+            // our edge that we test for intersection with other faces
+            const ed_t tested_edge = ps_edge_face_intersection_pairs_iter->first;
+            // the faces against which the edge is tested for intersection
+            const std::vector<fd_t> &tested_faces = ps_edge_face_intersection_pairs_iter->second;
+
+            const hd_t tested_edge_h0 = ps.halfedge(tested_edge, 0);
+            // source vertex
+            const math::vec3 &tested_edge_h0_source_vertex = ps.vertex(ps.source(tested_edge_h0));
+            // target vertex
+            const math::vec3 &tested_edge_h0_target_vertex = ps.vertex(ps.target(tested_edge_h0));
+
+            // for each face that is to be intersected with the tested-edge
+            for (std::vector<fd_t>::const_iterator tested_faces_iter = tested_faces.cbegin();
+                 tested_faces_iter != tested_faces.cend();
+                 ++tested_faces_iter)
+            {
+                const fd_t tested_face = *tested_faces_iter;
+
+                // We are now finding the intersection points determined by calculating the location
+                // where each halfedge of face A intersects the area defined by face B (if it exists).
+
+                MCUT_ASSERT(ps_tested_faces_info.vertices.find(tested_face) != ps_tested_faces_info.vertices.end());
+                const std::vector<math::vec3> &tested_face_vertices = ps_tested_faces_info.vertices.at(tested_face);
+
+                // plane of tested_face
+                // --------------------
+
+                MCUT_ASSERT(ps_tested_faces_info.plane_normal.find(tested_face) != ps_tested_faces_info.plane_normal.end());
+                const math::vec3 &tested_face_plane_normal = ps_tested_faces_info.plane_normal.at(tested_face);
+                MCUT_ASSERT(ps_tested_faces_info.plane_normal_d_param.find(tested_face) != ps_tested_faces_info.plane_normal_d_param.end());
+                const math::real_number_t &tested_face_plane_param_d = ps_tested_faces_info.plane_normal_d_param.at(tested_face);
+                MCUT_ASSERT(ps_tested_faces_info.plane_normal_max_comp.find(tested_face) != ps_tested_faces_info.plane_normal_max_comp.end());
+                const int &tested_face_plane_normal_max_comp = ps_tested_faces_info.plane_normal_max_comp.at(tested_face);
+
+                math::vec3 intersection_point(0., 0., 0.); // the intersection point to be computed
+
+                // TODO: replace this with shewchuck predicate (nasty failure on test 42)
+                // at least orient3d will be able to give use the corrent result!
+#if 0
+            char lp_intersection_result = geom::compute_line_plane_intersection(
+                intersection_point,
+                tested_edge_h0_source_vertex,
+                tested_edge_h0_target_vertex,
+                tested_face_vertices.data(),
+                tested_face_vertices.size(),
+                tested_face_plane_normal_max_comp,
+                tested_face_plane_normal,
+                tested_face_plane_param_d);
+#else
+                char segment_intersection_type = geom::compute_segment_plane_intersection_type( // exact**
+                    tested_edge_h0_source_vertex,
+                    tested_edge_h0_target_vertex,
+                    tested_face_vertices.data(),
+                    (int)tested_face_vertices.size(),
+                    tested_face_plane_normal_max_comp);
+#endif
+                bool have_plane_intersection = (segment_intersection_type != '0'); // any intersection !
+
+                if (!have_plane_intersection)
+                {
+                    continue;
+                }
+
+                if (segment_intersection_type != '1')
+                { // the segment only touches the the plane (the line reprsented by segment still intersects the plane)
+
+                    // before jumping-the-gun and assuming that we have indeed violated GP,
+                    // we should check whether the point found to be on the plane (touching point) is
+                    // actually [inside] the tested_face. That would imply cutting through a vertex or edge (undefined).
+                    // If this is true then we have indeed violated GP. Otherwise, we just treat this as a non-intersection because
+                    // the what-would-have-been intersection point actually lies outside the tested_face.
+                    bool violatedGP = false;
+                    std::vector<const math::vec3 *> points_touching_plane;
+
+                    if (segment_intersection_type == 'q' /*segment start*/ || segment_intersection_type == 'r' /*segment end*/)
+                    { // only one segment end is touching plane
+                        points_touching_plane.push_back((segment_intersection_type == 'q') ? &tested_edge_h0_source_vertex : &tested_edge_h0_target_vertex);
+                    }
+                    else
+                    { // both point are in the plane, so we will need to confirm whether BOTH are outside our tested face.
+                        points_touching_plane.push_back(&tested_edge_h0_source_vertex);
+                        points_touching_plane.push_back(&tested_edge_h0_target_vertex);
+                    }
+
+                    // if any point in "points_touching_plane" is inside the tested_face then we have violated GP
+                    for (std::vector<const math::vec3 *>::const_iterator i = points_touching_plane.cbegin(); i != points_touching_plane.cend(); ++i)
+                    {
+                        const math::vec3 &point = (*(*i));
+                        char result = geom::compute_point_in_polygon_test(
+                            point,
+                            tested_face_vertices.data(),
+                            (int)tested_face_vertices.size());
+                        if (
+                            // the touching point is inside, which implies cutting through a vertex (of "tested_edge")
+                            result == 'i' ||
+                            // The following condition means that we will have an edge-edge intersection anyway!
+                            // i.e. 'v' means that two edges (from sm and cm) touch at their tips/points since point is an end point of "tested_edge"
+                            // ... and 'e' means that an end point of "tested_edge" touches an edge of "tested_face"
+                            (result == 'v' || result == 'e'))
+                        {
+                            violatedGP = true;
+                            break;
+                        }
+                    }
+
+                    if (violatedGP)
+                    {
+                        // Note: our intersection registry formulation requires that edges completely penetrate/intersect through polygon's area.
+                        intersections.violated_general_position = true;
+                        intersections.reason_for_failure = "invalid compute_segment_plane_intersection_type result ('" + std::to_string(segment_intersection_type) + "')";
+                        return; // bail
+                    }
+                    else
+                    {
+                        // same as the case where "have_plane_intersection" is false.
+                        // so we just move onto the next edge-face test.
+                        continue;
+                    }
+                }
+
+                // at this point, we have established that the segment actually intersects the plane [properly]
+
+                // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+                // Now we compute the [actual] intersection point (coordinates)
+                // and check whether it lies inside our polygon, or that GP has been violated,
+                // which happens if e.g. the intersection point lies on an edge/vertex of "tested_face")
+
+                // NOTE: if using fixed precision floats (i.e. double), then here we just care about getting the intersection point
+                // irrespective of whether "segment_intersection_result" is consistent with "segment_intersection_type" from above.
+                // The inconsistency can happen during edge cases. see e.g. test 42.
+                geom::compute_segment_plane_intersection(
+                    intersection_point,
+                    tested_face_plane_normal,
+                    tested_face_plane_param_d,
+                    tested_edge_h0_source_vertex,
+                    tested_edge_h0_target_vertex);
+
+                // is our intersection point in the polygon?
+                char in_poly_test_intersection_type = geom::compute_point_in_polygon_test(
+                    intersection_point,
+                    tested_face_vertices.data(),
+                    (int)tested_face_vertices.size(),
+                    tested_face_plane_normal_max_comp);
+
+                if (
+                    // illegal on-edge and on-vertex intersections
+                    (in_poly_test_intersection_type == 'v' || in_poly_test_intersection_type == 'e'))
+                {
+                    intersections.violated_general_position = true;
+                    intersections.reason_for_failure = "invalid point-in-polygon test result ('" + std::to_string(in_poly_test_intersection_type) + "')";
+                    return; // bail
+                }
 
-    std::mutex ps_edge_face_intersection_pairs_mutex_;
+                bool have_point_in_polygon = in_poly_test_intersection_type == 'i';
 
-    void edge_face_intersection_test_func(
-        std::map<mcut::ed_t, std::vector<mcut::fd_t>>::const_iterator first,
-        std::map<mcut::ed_t, std::vector<mcut::fd_t>>::const_iterator last,
-        const mesh_t &ps,
-        // output
-        // any vertex descriptors (e.g. keys to std::maps) are local the array "intersection_points"
-        std::map<vd_t, std::vector<fd_t>> &m0_ivtx_to_ps_faces,
-        std::map<vd_t, ed_t> &m0_ivtx_to_ps_edge,
-        std::vector<vd_t> &cm_border_reentrant_ivtx_list,
-        std::map<vd_t, math::vec3> &m0_ivtx_to_tested_polygon_normal,
-        std::map<ed_t, std::vector<fd_t>> &ps_intersecting_edges, // guarded by mutex-lock
-        std::map<std::pair<fd_t, fd_t>, std::vector<vd_t>> &cutpath_edge_creation_info,
-        std::map<ed_t, std::vector<fd_t>> &ps_edge_face_intersection_pairs,
-        std::vector<math::vec3> &intersection_points)
-    {
+                if (have_point_in_polygon)
+                { // NOTE: point must be [inside] the polygon for us to consider it further
+                    intersections.points.push_back(intersection_point);
+                    intersections.registry_entries.emplace_back(tested_edge, tested_face);
+                }
+            } // for (std::vector<fd_t>::const_iterator tested_faces_iter = tested_faces.cbegin(); tested_faces_iter != tested_faces.cend(); ++tested_faces_iter) {
+        }     // for (std::map<ed_t, std::vector<fd_t>>::const_iterator ps_edge_face_intersection_pairs_iter = first; ps_edge_face_intersection_pairs_iter != last; ps_edge_face_intersection_pairs_iter++) {
     }
 
+    // perform the edge-to-face intersection tests of all pairs in "ps_edge_face_intersection_pairs"
+    // in parallel. The tests are split into contiguous blocks of edges, and a block's results are
+    // stored at its index in "block_intersections" so that they can be merged in the serial order.
     void parallel_polygon_intersection_tests(
         // inputs
-        std::map<mcut::ed_t, std::vector<mcut::fd_t>>::const_iterator first,
-        std::map<mcut::ed_t, std::vector<mcut::fd_t>>::const_iterator last,
+        thread_pool &scheduler,
+        const std::map<ed_t, std::vector<fd_t>> &ps_edge_face_intersection_pairs,
         const mesh_t &ps,
+        const tested_faces_info_t &ps_tested_faces_info,
         // outputs
-        std::map<vd_t, std::vector<fd_t>> &m0_ivtx_to_ps_faces,
-        std::map<vd_t, ed_t> &m0_ivtx_to_ps_edge,
-        std::vector<vd_t> &cm_border_reentrant_ivtx_list,
-        std::map<vd_t, math::vec3> &m0_ivtx_to_tested_polygon_normal,
-        std::map<ed_t, std::vector<fd_t>> &ps_intersecting_edges, // guarded by mutex-lock
-        std::map<std::pair<fd_t, fd_t>, std::vector<vd_t>> &cutpath_edge_creation_info,
-        std::map<ed_t, std::vector<fd_t>> &ps_edge_face_intersection_pairs)
+        std::vector<edge_face_intersections_t> &block_intersections)
     {
-        unsigned long const length = std::distance(first, last);
-        MCUT_ASSERT(length > 0);
-        unsigned long const min_per_thread = 8;
-        unsigned long const max_threads = (length + min_per_thread - 1) / min_per_thread;
-        unsigned long const hardware_threads = std::thread::hardware_concurrency();
-        unsigned long const num_threads = std::min(hardware_threads != 0 ? hardware_threads : 2, max_threads);
-        unsigned long const block_size = length / num_threads;
-        std::vector<int> results(num_threads);
-
-        std::vector<math::vec3> intersection_points(num_threads);
+        const uint32_t length = (uint32_t)ps_edge_face_intersection_pairs.size();
+        const uint32_t min_per_thread = 512;
+        const uint32_t num_blocks = get_parallel_block_count(scheduler, length, min_per_thread);
 
-        std::vector<std::thread> threads(num_threads - 1);
+        // the iterator to the first element of each block (where the last is the end iterator)
+        std::vector<std::map<ed_t, std::vector<fd_t>>::const_iterator> block_starts;
+        block_starts.reserve(num_blocks + 1);
 
-        std::map<ed_t, std::vector<fd_t>>::const_iterator block_start = first;
+        std::map<ed_t, std::vector<fd_t>>::const_iterator block_start = ps_edge_face_intersection_pairs.cbegin();
 
-        for (unsigned long i = 0; i < (num_threads - 1); ++i)
+        for (uint32_t i = 0; i < num_blocks; ++i)
         {
-
-            std::map<ed_t, std::vector<fd_t>>::const_iterator block_end = block_start;
-
-            std::advance(block_end, block_size);
-
-            threads[i] = std::thread(
-                edge_face_intersection_test_func,
-                block_start,
-                block_end,
-                std::ref(results[i]));
-
-            block_start = block_end;
+            block_starts.push_back(block_start);
+            std::advance(block_start, (i == (num_blocks - 1)) ? (length - (i * (length / num_blocks))) : (length / num_blocks));
         }
 
-        edge_face_intersection_test_func(
-            block_start,
-            block_end,
-            std::ref(results[num_threads - 1]));
+        MCUT_ASSERT(block_start == ps_edge_face_intersection_pairs.cend());
+        block_starts.push_back(block_start);
 
-        std::for_each(threads.begin(), threads.end(),
-                      std::mem_fn(&std::thread::join));
+        block_intersections.resize(num_blocks);
+
+        parallel_for_blocks(scheduler, length, num_blocks, [&](uint32_t block_index, uint32_t /*block_begin*/, uint32_t /*block_end*/) {
+            edge_face_intersection_test_func(
+                block_starts[block_index],
+                block_starts[block_index + 1],
+                ps,
+                ps_tested_faces_info,
+                block_intersections[block_index]);
+        });
     }
-#endif
 
     //
     // entry point
@@ -1741,10 +1905,12 @@ inline bool interior_edge_exists(const mesh_t& m, const vd_t& src, const vd_t& t
     void dispatch(output_t &output, const input_t &input)
     {
         logger_t &lg = output.logger;
-        logger_ptr = &output.logger;
+        const logger_ptr_scope_t logger_scope(&output.logger);
         lg.reset();
         lg.set_verbose(input.verbose);
 
+        MCUT_ASSERT(input.scheduler != nullptr);
+
         const mesh_t &sm = (*input.src_mesh);
         const mesh_t &cs = (*input.cut_mesh);
 
@@ -1791,61 +1957,79 @@ inline bool interior_edge_exists(const mesh_t& m, const vd_t& src, const vd_t& t
 
         lg << "create polygon soup (ps)" << std::endl;
 
-        mesh_t ps = sm; // copy
-
-        std::map<vd_t, vd_t> ps_to_sm_vtx;
-        for (mesh_t::vertex_iterator_t v = sm.vertices_begin(); v != sm.vertices_end(); ++v)
-        {
-            ps_to_sm_vtx[*v] = *v; // one to one mapping since ps is initially a copy of sm!
-        }
+        // NOTE: "ps" is the disjoint union of "sm" and "cs". The descriptors of source-mesh
+        // elements are the same in "ps", and those of cut-mesh elements are offset by the
+        // number of source-mesh elements of the same type (see e.g. "ps_to_cm_vertex").
+        MCUT_ASSERT(sm.number_of_internal_vertices() == sm_vtx_cnt);
+        MCUT_ASSERT(sm.number_of_internal_faces() == sm_face_count);
+        MCUT_ASSERT(cs.number_of_internal_vertices() == cs.number_of_vertices());
 
-        std::map<fd_t, fd_t> ps_to_sm_face;
-        for (mesh_t::face_iterator_t f = sm.faces_begin(); f != sm.faces_end(); ++f)
-        {
-            ps_to_sm_face[*f] = *f; // one to one mapping since ps is initially a copy of sm!
-        }
+        mesh_t ps = sm; // copy
 
-        std::map<vd_t, vd_t> cs_to_ps_vtx;
-        std::map<vd_t, vd_t> ps_to_cm_vtx;
+        const bool sm_has_removed_elements = sm.number_of_edges_removed() > 0 || sm.number_of_halfedges_removed() > 0;
 
-        // merge cm vertices
-        for (auto i = cs.vertices_begin(); i != cs.vertices_end(); ++i)
+        // merge cm vertices and faces
+        // NOTE: a face of "cs" is added starting from the target vertex of its first halfedge,
+        // which defines the order of the cut-mesh halfedges in "ps"
+        if (!sm_has_removed_elements)
         {
-            const vd_t v = ps.add_vertex(cs.vertex(*i));
+            std::vector<math::vec3> cs_vertices;
+            cs_vertices.reserve(cs.number_of_vertices());
 
-            MCUT_ASSERT(v != mesh_t::null_vertex());
+            for (mesh_t::vertex_iterator_t i = cs.vertices_begin(); i != cs.vertices_end(); ++i)
+            {
+                cs_vertices.push_back(cs.vertex(*i));
+            }
 
-            cs_to_ps_vtx.insert(std::make_pair(*i, v));
-            ps_to_cm_vtx[v] = *i;
-        }
+            std::vector<uint32_t> cs_face_indices;
+            std::vector<uint32_t> cs_face_sizes;
+            cs_face_sizes.reserve(cs_face_count);
 
-        std::map<fd_t, fd_t> ps_to_cm_face;
+            for (mesh_t::face_iterator_t i = cs.faces_begin(); i != cs.faces_end(); ++i)
+            {
+                const std::vector<vd_t> fv = cs.get_vertices_around_face(*i);
+                cs_face_indices.insert(cs_face_indices.end(), fv.cbegin(), fv.cend());
+                cs_face_sizes.push_back((uint32_t)fv.size());
+            }
 
-        // merge cm faces
-        for (mesh_t::face_iterator_t i = cs.faces_begin(); i != cs.faces_end(); ++i)
-        {
+            // built in one pass and then appended, which gives the same descriptors as adding
+            // each element to "ps" in order since "ps" has no free slots
+            mesh_t cs_soup;
+            const bool built = cs_soup.build_from_arrays(cs_vertices, cs_face_indices.data(), cs_face_sizes.data(), (uint32_t)cs_face_sizes.size());
+            MCUT_ASSERT(built);
+            (void)built;
 
-            //std::vector<vd_t> fv = get_vertices_on_face(cs, *i);
-            std::vector<vd_t> fv = cs.get_vertices_around_face(*i);
-            std::vector<vd_t> remapped_face_vertices;
+            ps.append(cs_soup);
+        }
+        else
+        { // the new cut-mesh edges take the free slots of "ps"
 
-            for (std::vector<vd_t>::const_iterator j = fv.cbegin(); j != fv.cend(); ++j)
+            for (mesh_t::vertex_iterator_t i = cs.vertices_begin(); i != cs.vertices_end(); ++i)
             {
-                remapped_face_vertices.push_back(cs_to_ps_vtx.at(*j));
+                const vd_t v = ps.add_vertex(cs.vertex(*i));
+                MCUT_ASSERT(v == static_cast<vd_t>(*i + sm_vtx_cnt));
+                (void)v;
             }
 
-            const fd_t f = ps.add_face(remapped_face_vertices);
+            for (mesh_t::face_iterator_t i = cs.faces_begin(); i != cs.faces_end(); ++i)
+            {
+                std::vector<vd_t> fv = cs.get_vertices_around_face(*i);
 
-            MCUT_ASSERT(f != mesh_t::null_face());
+                for (std::vector<vd_t>::iterator j = fv.begin(); j != fv.end(); ++j)
+                {
+                    *j = static_cast<vd_t>(*j + sm_vtx_cnt);
+                }
 
-            ps_to_cm_face[f] = *i;
+                const fd_t f = ps.add_face(fv);
+                MCUT_ASSERT(f == static_cast<fd_t>(*i + sm_face_count));
+                (void)f;
+            }
         }
 
-        cs_to_ps_vtx.clear();
-
-        //if (input.verbose) {
-        dump_mesh(ps, "polygon-soup");
-        //}
+        if (input.verbose)
+        {
+            dump_mesh(ps, "polygon-soup");
+        }
 
         const int ps_vtx_cnt = ps.number_of_vertices();
         const int ps_face_cnt = ps.number_of_faces();
@@ -2017,10 +2201,11 @@ inline bool interior_edge_exists(const mesh_t& m, const vd_t& src, const vd_t& t
 
         // compute/extract geometry properties of each tested face
         //--------------------------------------------------------
-        std::map<fd_t, math::vec3> ps_tested_face_to_plane_normal;
-        std::map<fd_t, math::real_number_t> ps_tested_face_to_plane_normal_d_param;
-        std::map<fd_t, int> ps_tested_face_to_plane_normal_max_comp;
-        std::map<fd_t, std::vector<math::vec3>> ps_tested_face_to_vertices;
+        tested_faces_info_t ps_tested_faces_info;
+        std::map<fd_t, math::vec3> &ps_tested_face_to_plane_normal = ps_tested_faces_info.plane_normal;
+        std::map<fd_t, math::real_number_t> &ps_tested_face_to_plane_normal_d_param = ps_tested_faces_info.plane_normal_d_param;
+        std::map<fd_t, int> &ps_tested_face_to_plane_normal_max_comp = ps_tested_faces_info.plane_normal_max_comp;
+        std::map<fd_t, std::vector<math::vec3>> &ps_tested_face_to_vertices = ps_tested_faces_info.vertices;
 
         for (std::set<fd_t>::const_iterator tested_faces_iter = ps_tested_faces.cbegin(); tested_faces_iter != ps_tested_faces.cend(); tested_faces_iter++)
         {
@@ -2049,341 +2234,100 @@ inline bool interior_edge_exists(const mesh_t& m, const vd_t& src, const vd_t& t
         // -----------------------------------------
         TIME_PROFILE_START("Calculate intersection points (edge-to-face)");
 
-        for (std::map<ed_t, std::vector<fd_t>>::const_iterator ps_edge_face_intersection_pairs_iter = ps_edge_face_intersection_pairs.cbegin();
-             ps_edge_face_intersection_pairs_iter != ps_edge_face_intersection_pairs.cend();
-             ps_edge_face_intersection_pairs_iter++)
+        std::vector<edge_face_intersections_t> block_intersections;
+
+        parallel_polygon_intersection_tests(
+            *input.scheduler,
+            ps_edge_face_intersection_pairs,
+            ps,
+            ps_tested_faces_info,
+            block_intersections);
+
+        // add the intersection points to "m0" in the order in which a serial traversal
+        // of "ps_edge_face_intersection_pairs" finds them (i.e. block by block), so that
+        // the descriptors of the intersection points do not depend on the number of threads
+        for (std::vector<edge_face_intersections_t>::const_iterator block_iter = block_intersections.cbegin();
+             block_iter != block_intersections.cend();
+             ++block_iter)
         {
-
-            // our edge that we test for intersection with other faces
-            const ed_t tested_edge = ps_edge_face_intersection_pairs_iter->first;
-            // the faces against which the edge is tested for intersection
-            const std::vector<fd_t> &tested_faces = ps_edge_face_intersection_pairs_iter->second;
-
-            // the halfedges of our edge
-            const hd_t tested_edge_h0 = ps.halfedge(tested_edge, 0);
-            const hd_t tested_edge_h1 = ps.halfedge(tested_edge, 1);
-
-            // source vertex
-            const vertex_descriptor_t tested_edge_h0_source_descr = ps.source(tested_edge_h0);
-            const math::vec3 &tested_edge_h0_source_vertex = ps.vertex(tested_edge_h0_source_descr);
-            // target vertex
-            const vertex_descriptor_t tested_edge_h0_target_descr = ps.target(tested_edge_h0);
-            const math::vec3 &tested_edge_h0_target_vertex = ps.vertex(tested_edge_h0_target_descr);
-
-            // This boolean var is evaluated based on the fact that sm faces come before cm faces inside the "ps" data structure
-            const fd_t tested_edge_h0_face = ps.face(tested_edge_h0);
-            const fd_t tested_edge_h1_face = ps.face(tested_edge_h1);
-            const fd_t tested_edge_face = tested_edge_h0_face != mesh_t::null_face() ? tested_edge_h0_face : tested_edge_h1_face;
-            const bool tested_edge_belongs_to_cm = ps_is_cutmesh_face(tested_edge_face, sm_face_count);
-
-            // for each face that is to be intersected with the tested-edge
-            for (std::vector<fd_t>::const_iterator tested_faces_iter = tested_faces.cbegin();
-                 tested_faces_iter != tested_faces.cend();
-                 ++tested_faces_iter)
+            for (uint32_t i = 0; i < (uint32_t)block_iter->points.size(); ++i)
             {
-                const fd_t tested_face = *tested_faces_iter;
+                const math::vec3 &intersection_point = block_iter->points[i];
+                const ed_t tested_edge = block_iter->registry_entries[i].first;
+                const fd_t tested_face = block_iter->registry_entries[i].second;
 
-                // We are now finding the intersection points determined by calculating the location
-                // where each halfedge of face A intersects the area defined by face B (if it exists).
-
-                // get the vertices of tested_face (used to estimate its normal etc.)
-                //std::vector<vd_t> tested_face_descriptors = ps.get_vertices_around_face(tested_face);
-                MCUT_ASSERT(ps_tested_face_to_vertices.find(tested_face) != ps_tested_face_to_vertices.end());
-                const std::vector<math::vec3> &tested_face_vertices = ps_tested_face_to_vertices.at(tested_face);
-
-                //lg << "face " << fstr(tested_face) << " vertices = " << tested_face_descriptors.size() << std::endl;
-
-                //for (std::vector<vd_t>::const_iterator it = tested_face_descriptors.cbegin(); it != tested_face_descriptors.cend(); ++it) {
-                //    const math::vec3& vertex = ps.vertex(*it);
-                //    lg << "v: " << vertex << std::endl;
-                //    tested_face_vertices.push_back(vertex);
-                //}
-
-                // compute plane of tested_face
-                // -----------------------
-
-                MCUT_ASSERT(ps_tested_face_to_plane_normal.find(tested_face) != ps_tested_face_to_plane_normal.end());
-                const math::vec3 &tested_face_plane_normal = ps_tested_face_to_plane_normal.at(tested_face);
-                MCUT_ASSERT(ps_tested_face_to_plane_normal_d_param.find(tested_face) != ps_tested_face_to_plane_normal_d_param.end());
-                const math::real_number_t &tested_face_plane_param_d = ps_tested_face_to_plane_normal_d_param.at(tested_face);
-                MCUT_ASSERT(ps_tested_face_to_plane_normal_max_comp.find(tested_face) != ps_tested_face_to_plane_normal_max_comp.end());
-                const int &tested_face_plane_normal_max_comp = ps_tested_face_to_plane_normal_max_comp.at(tested_face); // geom::compute_polygon_plane_coefficients(
-                    /// tested_face_plane_normal,
-                    // tested_face_plane_param_d,
-                    // tested_face_vertices.data(),
-                //  (int)tested_face_vertices.size());
-
-                //lg << "face " << fstr(tested_face) << " normal = " << tested_face_plane_normal << std::endl;
-                //lg << "face " << fstr(tested_face) << " largest normal component = " << tested_face_plane_normal_max_comp << std::endl;
-                //lg << "face " << fstr(tested_face) << " plane d-coeff = " << tested_face_plane_param_d << std::endl;
-
-                math::vec3 intersection_point(0., 0., 0.); // the intersection point to be computed
-
-                // TODO: replace this with shewchuck predicate (nasty failure on test 42)
-                // at least orient3d will be able to give use the corrent result!
-#if 0
-            char lp_intersection_result = geom::compute_line_plane_intersection(
-                intersection_point,
-                tested_edge_h0_source_vertex,
-                tested_edge_h0_target_vertex,
-                tested_face_vertices.data(),
-                tested_face_vertices.size(),
-                tested_face_plane_normal_max_comp,
-                tested_face_plane_normal,
-                tested_face_plane_param_d);
-#else
-                char segment_intersection_type = geom::compute_segment_plane_intersection_type( // exact**
-                    tested_edge_h0_source_vertex,
-                    tested_edge_h0_target_vertex,
-                    tested_face_vertices.data(),
-                    (int)tested_face_vertices.size(),
-                    tested_face_plane_normal_max_comp);
-#endif
-                bool have_plane_intersection = (segment_intersection_type != '0'); // any intersection !
-
-                lg << "plane intersection exists: " << std::boolalpha << (bool)have_plane_intersection << std::endl;
+                // the halfedges of our edge
+                const hd_t tested_edge_h0 = ps.halfedge(tested_edge, 0);
+                const hd_t tested_edge_h1 = ps.halfedge(tested_edge, 1);
 
-                if (have_plane_intersection)
-                { // does the segment intersect the plane?
-                    lg.indent();
+                // This boolean var is evaluated based on the fact that sm faces come before cm faces inside the "ps" data structure
+                const fd_t tested_edge_h0_face = ps.face(tested_edge_h0);
+                const fd_t tested_edge_h1_face = ps.face(tested_edge_h1);
+                const fd_t tested_edge_face = tested_edge_h0_face != mesh_t::null_face() ? tested_edge_h0_face : tested_edge_h1_face;
+                const bool tested_edge_belongs_to_cm = ps_is_cutmesh_face(tested_edge_face, sm_face_count);
 
-                    lg << "intersection point: " << intersection_point << std::endl;
+                lg << "intersection point: " << intersection_point << std::endl;
 
-                    if (segment_intersection_type != '1')
-                    { // the segment only touches the the plane (the line reprsented by segment still intersects the plane)
+                // The naming convention of these variables is based on Sifakis et al. 2007
+                fd_t face_pqr = tested_edge_face;                                                                    // the face which is incident to halfedge-pq
+                fd_t face_pqs = tested_edge_face == tested_edge_h0_face ? tested_edge_h1_face : mesh_t::null_face(); // the face which is incident to the halfedge opposite to halfedge-pq
 
-                        // before jumping-the-gun and assuming that we have indeed violated GP,
-                        // we should check whether the point found to be on the plane (touching point) is
-                        // actually [inside] the tested_face. That would imply cutting through a vertex or edge (undefined).
-                        // If this is true then we have indeed violated GP. Otherwise, we just treat this as a non-intersection because
-                        // the what-would-have-been intersection point actually lies outside the tested_face.
-                        bool violatedGP = false;
-                        std::vector<const math::vec3 *> points_touching_plane;
+                vd_t new_vertex_descr = m0.add_vertex(intersection_point);
 
-                        if (segment_intersection_type == 'q' /*segment start*/ || segment_intersection_type == 'r' /*segment end*/)
-                        { // only one segment end is touching plane
-                            points_touching_plane.push_back((segment_intersection_type == 'q') ? &tested_edge_h0_source_vertex : &tested_edge_h0_target_vertex);
-                        }
-                        else
-                        { // both point are in the plane, so we will need to confirm whether BOTH are outside our tested face.
-                            points_touching_plane.push_back(&tested_edge_h0_source_vertex);
-                            points_touching_plane.push_back(&tested_edge_h0_target_vertex);
-                        }
+                MCUT_ASSERT(m0_ivtx_to_intersection_registry_entry.find(new_vertex_descr) == m0_ivtx_to_intersection_registry_entry.cend());
+                m0_ivtx_to_intersection_registry_entry[new_vertex_descr] = std::make_pair(tested_edge, tested_face);
 
-                        // if any point in "points_touching_plane" is inside the tested_face then we have violated GP
-                        for (std::vector<const math::vec3 *>::const_iterator i = points_touching_plane.cbegin(); i != points_touching_plane.cend(); ++i)
-                        {
-                            const math::vec3 &point = (*(*i));
-                            char result = geom::compute_point_in_polygon_test(
-                                point,
-                                tested_face_vertices.data(),
-                                (int)tested_face_vertices.size());
-                            if (
-                                // the touching point is inside, which implies cutting through a vertex (of "tested_edge")
-                                result == 'i' ||
-                                // The following condition means that we will have an edge-edge intersection anyway!
-                                // i.e. 'v' means that two edges (from sm and cm) touch at their tips/points since point is an end point of "tested_edge"
-                                // ... and 'e' means that an end point of "tested_edge" touches an edge of "tested_face"
-                                (result == 'v' || result == 'e'))
-                            {
-                                violatedGP = true;
-                                break;
-                            }
-                        }
+                ps_intersecting_edges[tested_edge].push_back(new_vertex_descr);
 
-                        if (violatedGP)
-                        {
-                            output.status = status_t::GENERAL_POSITION_VIOLATION;
-                            if (!input.enforce_general_position)
-                            {
-                                // Our assumption of having inputs in general position has been violated, we need to terminate
-                                // with an error since perturbation (enforment of general positions) is disabled by the user.
-                                // Note: our intersection registry formulation requires that edges completely penetrate/intersect through polygon's area.
-                                lg.set_reason_for_failure("invalid compute_segment_plane_intersection_type result ('" + std::to_string(segment_intersection_type) + "')");
-                            }
-                            return; // bail and return to the front-end
-                        }
-                        else
-                        {
-                            // same as the case where "have_plane_intersection" is false.
-                            // so we just move onto the next edge-face test.
-                            continue;
-                        }
-                    }
+                if (tested_edge_belongs_to_cm)
+                {
+                    // "tested_face" is from the source mesh
 
-                    // at this point, we have established that the segment actually intersects the plane [properly]
-
-                    // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
-                    // Now we compute the [actual] intersection point (coordinates)
-                    // and check whether it lies inside our polygon, or that GP has been violated,
-                    // which happens if e.g. the intersection point lies on an edge/vertex of "tested_face")
-
-                    // NOTE: if using fixed precision floats (i.e. double), then here we just care about getting the intersection point
-                    // irrespective of whether "segment_intersection_result" is consistent with "segment_intersection_type" from above.
-                    // The inconsistency can happen during edge cases. see e.g. test 42.
-                    geom::compute_segment_plane_intersection(
-                        intersection_point,
-                        tested_face_plane_normal,
-                        tested_face_plane_param_d,
-                        tested_edge_h0_source_vertex,
-                        tested_edge_h0_target_vertex);
-
-                    // is our intersection point in the polygon?
-                    char in_poly_test_intersection_type = geom::compute_point_in_polygon_test(
-                        intersection_point,
-                        tested_face_vertices.data(),
-                        (int)tested_face_vertices.size(),
-                        tested_face_plane_normal_max_comp);
-
-                    if (
-                        // illegal on-edge and on-vertex intersections
-                        (in_poly_test_intersection_type == 'v' || in_poly_test_intersection_type == 'e'))
+                    // NOTE: std::pair format/order is {source-mesh-face, cut-mesh-face}
+                    cutpath_edge_creation_info[std::make_pair(tested_face, face_pqr)].push_back(new_vertex_descr);
+                    if (face_pqs != mesh_t::null_face())
                     {
-                        output.status = status_t::GENERAL_POSITION_VIOLATION;
-                        if (!input.enforce_general_position)
-                        {
-                            // Our assuption of having inputs in general position has been violated, we need to terminate
-                            // with an error since perturbation (enforment of general positions) is disabled.
-                            lg.set_reason_for_failure("invalid point-in-polygon test result ('" + std::to_string(in_poly_test_intersection_type) + "')");
-                        }
-                        return;
+                        cutpath_edge_creation_info[std::make_pair(tested_face, face_pqs)].push_back(new_vertex_descr);
                     }
+                }
+                else
+                {
 
-                    bool have_point_in_polygon = in_poly_test_intersection_type == 'i';
-
-                    lg << "point in polygon = " << std::boolalpha << have_point_in_polygon << std::endl;
-
-                    if (have_point_in_polygon)
-                    { // NOTE: point must be [inside] the polygon for us to consider it further
-#if 0
-                    // Intersection point is now determined to be in side face-B (our polygon), now we must use the information
-                    // we computed from the segment-plane intersection test to find out if general position has been violated (i.e.
-                    // invalid case of cutting through a vertex)
-                    if (segment_intersection_type == 'p' || segment_intersection_type == 'q' || segment_intersection_type == 'r') {
-
-                        output.status = status_t::GENERAL_POSITION_VIOLATION;
-
-                        if (!input.enforce_general_position) {
-                            // Our assumption of having inputs in general position has been violated, we need to terminate
-                            // with an error since perturbation (i.e. enforcement of general positions) is disabled.
-                            // If any one of a segment's vertices only touch (i.e. lie on) the plane
-                            // then that implies a situation of cutting through a vertex which is undefined.
-                            lg.set_reason_for_failure("segment-plane intersection ('" + std::to_string(segment_intersection_type) + "')");
-                        }
-                        return;
-                    }
-                    vd_t pre_existing_copy = mesh_t::null_vertex(); // set to correct value if intersection has already been computed
-#endif
-                        // The naming convention of these variables is based on Sifakis et al. 2007
-                        //hd_t halfedge_pq = tested_edge_h0; // the halfedge which is intersected with polygon
-                        //hd_t halfedge_pq_opp = tested_edge_h1; // ps.opposite(halfedge_pq);
-                        fd_t face_pqr = tested_edge_face;                                                                    // the face which is incident to halfedge-pq
-                        fd_t face_xyz = tested_face;                                                                         // the face which is intersected with halfedge-pq
-                        fd_t face_pqs = tested_edge_face == tested_edge_h0_face ? tested_edge_h1_face : mesh_t::null_face(); //ps.face(halfedge_pq_opp); // the face which is incident to the halfedge opposite to halfedge-pq
-                                                                                                                             //fd_t face_pqX = mesh_t::null_face(); // a virtual face pqX (where X denotes an unspecified auxiliary point)
+                    cutpath_edge_creation_info[std::make_pair(tested_edge_face, tested_face)].push_back(new_vertex_descr);
+                    const fd_t tested_edge_face_other = (tested_edge_face == tested_edge_h0_face) ? tested_edge_h1_face : tested_edge_h0_face;
 
-#if 0
-                    
-
-                    // add vertex if it does not exist.
-                    // --------------------------------
-
-                   
-                    const bool pq_is_indicent_on_pqr_and_pqs = (face_pqs != mesh_t::null_face()); // pq is common to faces pqr and pqs
-                    std::vector<fd_t> new_vertex_incident_ps_faces; // the list of faces which are incident to our intersection point
-                    // NOTE: Two intersection vertices are same if they are incident on the same faces AND their registry halfedges are opposites
-                    //bool computed_intersection_point_exists = false;
-
-                    if (pq_is_indicent_on_pqr_and_pqs) {
-
-                        // all three faces are defined and meet at the intersection point
-                        new_vertex_incident_ps_faces.push_back(face_pqr);
-                        new_vertex_incident_ps_faces.push_back(face_pqs);
-                        new_vertex_incident_ps_faces.push_back(face_xyz);
-
-                    } // if (pq_is_indicent_on_pqr_and_pqs) {
-                    else {
-                        // pqr is the only face incident to pq
-                        // -----------------------------------
-                        new_vertex_incident_ps_faces.push_back(face_pqr);
-                        new_vertex_incident_ps_faces.push_back(face_pqX); // virtual face
-                        new_vertex_incident_ps_faces.push_back(face_xyz);
+                    if (tested_edge_face_other != mesh_t::null_face())
+                    {
+                        cutpath_edge_creation_info[std::make_pair(tested_edge_face_other, tested_face)].push_back(new_vertex_descr);
                     }
-#endif
-                        vd_t new_vertex_descr = m0.add_vertex(intersection_point);
-#if 0
-                    lg << "add vertex" << std::endl;
-                    lg.indent();
-                    std::cout << "position = (" << intersection_point << ")" << std::endl;
-                    lg << "descriptor = " << vstr(new_vertex_descr) << std::endl;
-                    lg << "registry-entry" << std::endl;
-                    lg.indent();
-                    lg << "faces = [" << fstr(new_vertex_incident_ps_faces.at(0)) << ", " << fstr(new_vertex_incident_ps_faces.at(1)) << ", " << fstr(new_vertex_incident_ps_faces.at(2)) << "]" << std::endl;
-                    lg << "halfedge = " << hstr(ps, halfedge_pq) << std::endl;
-                    lg.unindent();
-                    lg.unindent();
-#endif
-                        //m0_ivtx_to_ps_faces.insert(std::make_pair(new_vertex_descr, new_vertex_incident_ps_faces));
-                        //m0_ivtx_to_ps_edge.insert(std::make_pair(new_vertex_descr, tested_edge));
-                        MCUT_ASSERT(m0_ivtx_to_intersection_registry_entry.find(new_vertex_descr) == m0_ivtx_to_intersection_registry_entry.cend());
-                        m0_ivtx_to_intersection_registry_entry[new_vertex_descr] = std::make_pair(tested_edge, tested_face);
-
-                        // ed_t e = ps.edge(halfedge_pq);
-                        //bool edge_registered_as_intersecting = ps_intersecting_edges.find(tested_edge) != ps_intersecting_edges.cend();
-
-                        ps_intersecting_edges[tested_edge].push_back(new_vertex_descr);
-
-                        //intersection_test_ivtx_list.push_back(new_vertex_descr);
-
-                        const fd_t cm_face = tested_edge_belongs_to_cm ? tested_edge_face : tested_face;
-                        const fd_t sm_face = tested_edge_belongs_to_cm ? tested_face : tested_edge_face;
-
-                        if (tested_edge_belongs_to_cm)
-                        {
-                            // "tested_face" is from the source mesh
-
-                            // NOTE: std::pair format/order is {source-mesh-face, cut-mesh-face}
-                            cutpath_edge_creation_info[std::make_pair(tested_face, face_pqr)].push_back(new_vertex_descr);
-                            if (face_pqs != mesh_t::null_face())
-                            {
-                                cutpath_edge_creation_info[std::make_pair(tested_face, face_pqs)].push_back(new_vertex_descr);
-                            }
-                        }
-                        else
-                        {
-
-                            cutpath_edge_creation_info[std::make_pair(tested_edge_face, tested_face)].push_back(new_vertex_descr);
-                            const fd_t tested_edge_face_other = (tested_edge_face == tested_edge_h0_face) ? tested_edge_h1_face : tested_edge_h0_face;
-
-                            if (tested_edge_face_other != mesh_t::null_face())
-                            {
-                                cutpath_edge_creation_info[std::make_pair(tested_edge_face_other, tested_face)].push_back(new_vertex_descr);
-                            }
-                        }
-
-                        //MCUT_ASSERT(m0_ivtx_to_tested_polygon_normal.count(new_vertex_descr) == 0);
-                        //m0_ivtx_to_tested_polygon_normal[new_vertex_descr] = tested_face_plane_normal;
-                        //MCUT_ASSERT(m0_ivtx_to_tested_polygon_normal.count(new_vertex_descr) == 1);
-
-                        if (tested_edge_belongs_to_cm)
-                        { // halfedge_pq belongs to cut mesh
-
-                            const bool is_border_reentrant_ivertex = ps.is_border(tested_edge); // ps.is_border(ps.edge(halfedge_pq));
+                }
 
-                            if (is_border_reentrant_ivertex)
-                            {
-                                lg << "is border" << std::endl;
-                                cm_border_reentrant_ivtx_list.push_back(new_vertex_descr);
-                            } //else // is regular
-                        }
+                if (tested_edge_belongs_to_cm)
+                { // halfedge_pq belongs to cut mesh
 
-                    } // if (have_point_in_polygon)
+                    const bool is_border_reentrant_ivertex = ps.is_border(tested_edge); // ps.is_border(ps.edge(halfedge_pq));
 
-                    lg.unindent();
-                } // if (have_plane_intersection) {
-            }     // for (std::vector<fd_t>::const_iterator intersected_faces_iter = intersected_faces.cbegin(); intersected_faces_iter != intersected_faces.cend(); ++intersected_faces_iter) {
+                    if (is_border_reentrant_ivertex)
+                    {
+                        lg << "is border" << std::endl;
+                        cm_border_reentrant_ivtx_list.push_back(new_vertex_descr);
+                    } //else // is regular
+                }
+            }
 
-        } // for (std::map<ed_t, std::vector<fd_t>>::const_iterator ps_edge_face_intersection_pairs_iter = ps_edge_face_intersection_pairs.cbegin(); ps_edge_face_intersection_pairs_iter != ps_edge_face_intersection_pairs.cend(); ps_edge_face_intersection_pairs_iter++) {
+            // NOTE: the tests of a block stop at the first violation (i.e. like in a serial traversal)
+            if (block_iter->violated_general_position)
+            {
+                output.status = status_t::GENERAL_POSITION_VIOLATION;
+                if (!input.enforce_general_position)
+                {
+                    // Our assumption of having inputs in general position has been violated, we need to terminate
+                    // with an error since perturbation (enforment of general positions) is disabled by the user.
+                    lg.set_reason_for_failure(block_iter->reason_for_failure);
+                }
+                return; // bail and return to the front-end
+            }
+        } // for (std::vector<edge_face_intersections_t>::const_iterator block_iter = block_intersections.cbegin(); block_iter != block_intersections.cend(); ++block_iter) {
 
 #ifndef NDEBUG
         for (std::map<std::pair<fd_t, fd_t>, std::vector<vd_t>>::const_iterator iter = cutpath_edge_creation_info.cbegin(); iter != cutpath_edge_creation_info.cend(); ++iter)
@@ -4255,21 +4199,11 @@ inline bool interior_edge_exists(const mesh_t& m, const vd_t& src, const vd_t& t
                     const vd_t ps_h_src = ps.source(*hbegin);
                     const vd_t ps_h_tgt = ps.target(*hbegin);
 
-                    // get the "m0" version of "ps_h_src"
-                    std::map<vd_t, vd_t>::const_iterator ps_h_src_fiter = std::find_if(m0_to_ps_vtx.cbegin(), m0_to_ps_vtx.cend(),
-                                                                                       [&](const std::pair<vd_t, vd_t> &e) -> bool { return e.second == ps_h_src; });
-
-                    MCUT_ASSERT(ps_h_src_fiter != m0_to_ps_vtx.cend()); // must exist because all "ps" vertices exist in "m0"
-
-                    // get the "m0" version of "ps_h_tgt"
-                    std::map<vd_t, vd_t>::const_iterator ps_h_tgt_fiter = std::find_if(m0_to_ps_vtx.cbegin(), m0_to_ps_vtx.cend(),
-                                                                                       [&](const std::pair<vd_t, vd_t> &e) -> bool { return e.second == ps_h_tgt; });
-
-                    MCUT_ASSERT(ps_h_tgt_fiter != m0_to_ps_vtx.cend());
-
                     // the "m0" versions of "ps_h_src" and  "ps_h_tgt"
-                    const vd_t m0_h_src = ps_h_src_fiter->first;
-                    const vd_t m0_h_tgt = ps_h_tgt_fiter->first;
+                    MCUT_ASSERT(ps_to_m0_vtx.find(ps_h_src) != ps_to_m0_vtx.cend()); // must exist because all "ps" vertices exist in "m0"
+                    const vd_t m0_h_src = ps_to_m0_vtx.at(ps_h_src);
+                    MCUT_ASSERT(ps_to_m0_vtx.find(ps_h_tgt) != ps_to_m0_vtx.cend());
+                    const vd_t m0_h_tgt = ps_to_m0_vtx.at(ps_h_tgt);
 
                     // Now we find the actual "m0" halfedge equivalent to "*hbegin" using
                     // our "m0" source and target descriptors
@@ -4325,15 +4259,8 @@ inline bool interior_edge_exists(const mesh_t& m, const vd_t& src, const vd_t& t
                 for (int i = 0; i < (int)ps_coincident_vertices.size(); ++i)
                 {
 
-                    std::map<vd_t, vd_t>::const_iterator m0_to_ps_vtx_fiter = std::find_if(
-                        m0_to_ps_vtx.cbegin(), m0_to_ps_vtx.cend(),
-                        [&](const std::pair<vd_t, vd_t> &e) -> bool {
-                            return e.second == ps_coincident_vertices.at(i);
-                        });
-
-                    MCUT_ASSERT(m0_to_ps_vtx_fiter != m0_to_ps_vtx.end());
-
-                    coincident_vertices.emplace_back(m0_to_ps_vtx_fiter->first);
+                    MCUT_ASSERT(ps_to_m0_vtx.find(ps_coincident_vertices.at(i)) != ps_to_m0_vtx.cend());
+                    coincident_vertices.emplace_back(ps_to_m0_vtx.at(ps_coincident_vertices.at(i)));
                 }
 
                 MCUT_ASSERT(coincident_vertices.size() == ps_coincident_vertices.size());
@@ -5662,6 +5589,7 @@ inline bool interior_edge_exists(const mesh_t& m, const vd_t& src, const vd_t& t
                 // NOTE: The result is a mesh identical to the original source mesh except at the edges introduced by the cut..
                 extract_connected_components(
                     separated_src_mesh_fragments,
+                    *input.scheduler,
                     m0,
                     0, // no offset because traced source-mesh polygons start from the beginning of "m0_polygons"
                     std::vector<traced_polygon_t>(m0_polygons.begin(), traced_sm_polygons_iter_end),
@@ -5673,10 +5601,6 @@ inline bool interior_edge_exists(const mesh_t& m, const vd_t& src, const vd_t& t
                     std::map<int, int>(),   // Unused ... because we are extracting from "m0"
                     m0_to_ps_vtx,
                     m0_to_ps_face,
-                    ps_to_sm_vtx,
-                    ps_to_sm_face,
-                    ps_to_cm_vtx,
-                    ps_to_cm_face,
                     sm_vtx_cnt,
                     sm_face_count,
                     input.populate_vertex_maps,
@@ -5710,6 +5634,7 @@ inline bool interior_edge_exists(const mesh_t& m, const vd_t& src, const vd_t& t
 
                 mesh_t merged = extract_connected_components(
                     separated_cut_mesh_fragments,
+                    *input.scheduler,
                     m0,
                     traced_sm_polygon_count, // offset to start of traced cut-mesh polygons in "m0_polygons".
                     std::vector<traced_polygon_t>(traced_cs_polygons_iter_cbegin, m0_polygons.cend()),
@@ -5721,10 +5646,6 @@ inline bool interior_edge_exists(const mesh_t& m, const vd_t& src, const vd_t& t
                     std::map<int, int>(),   // Unused ... because we are extracting from "m0"
                     m0_to_ps_vtx,
                     m0_to_ps_face,
-                    ps_to_sm_vtx,
-                    ps_to_sm_face,
-                    ps_to_cm_vtx,
-                    ps_to_cm_face,
                     sm_vtx_cnt,
                     sm_face_count,
                     input.populate_vertex_maps,
@@ -5775,8 +5696,7 @@ inline bool interior_edge_exists(const mesh_t& m, const vd_t& src, const vd_t& t
                                 if (is_ps_vertex)
                                 {
                                     vd_t ps_descr = m0_to_ps_vtx_fiter->second;
-                                    MCUT_ASSERT(ps_to_cm_vtx.count(ps_descr) == 1);
-                                    cm_descr = ps_to_cm_vtx.at(ps_descr);
+                                    cm_descr = ps_to_cm_vertex(ps_descr, sm_vtx_cnt);
 
                                     // add an offset which allows users to deduce which birth/origin mesh (source or cut mesh) a face (map value) belongs to.
                                     cm_descr = static_cast<vd_t>(cm_descr + sm_face_count);
@@ -7187,6 +7107,7 @@ inline bool interior_edge_exists(const mesh_t& m, const vd_t& src, const vd_t& t
 
             extract_connected_components(
                 unsealed_connected_components,
+                *input.scheduler,
                 m1,
                 0,
                 m1_polygons,
@@ -7198,10 +7119,6 @@ inline bool interior_edge_exists(const mesh_t& m, const vd_t& src, const vd_t& t
                 m1_to_m0_face,
                 m0_to_ps_vtx,
                 m0_to_ps_face,
-                ps_to_sm_vtx,
-                ps_to_sm_face,
-                ps_to_cm_vtx,
-                ps_to_cm_face,
                 sm_vtx_cnt,
                 sm_face_count,
                 input.populate_vertex_maps,
@@ -7465,12 +7382,13 @@ inline bool interior_edge_exists(const mesh_t& m, const vd_t& src, const vd_t& t
 
         // Interior/inside patches must be stitched into separate connected component
         // as exterior/outside patches so we create two versions of "m1" for that.
+        // NOTE: the versions are created when we begin stitching the patches of each color (see below)
         //
         std::map<
             char,  // color value (representing the notion of "interior"/"exterior")
             mesh_t // the mesh (copy of "m1") to which corresponding patch(es) will be stitched
             >
-            color_to_m1 = {{'A' /*e.g. "red"*/, m1}, {'B' /*e.g. "blue"*/, m1}};
+            color_to_m1;
 
         // TODO: implement --> m1.free_data();
 
@@ -9008,8 +8926,7 @@ inline bool interior_edge_exists(const mesh_t& m, const vd_t& src, const vd_t& t
                         {
                             vd_t as_ps_descr = patch_to_m0_vertex.at(*v);
 
-                            MCUT_ASSERT(ps_to_cm_vtx.count(as_ps_descr) == 1);
-                            as_cm_descr = ps_to_cm_vtx.at(as_ps_descr);
+                            as_cm_descr = ps_to_cm_vertex(as_ps_descr, sm_vtx_cnt);
 
                             // add an offset which allows users to deduce which birth/origin mesh (source or cut mesh) a face (map value) belongs to.
                             as_cm_descr = static_cast<vd_t>(as_cm_descr + sm_vtx_cnt);
@@ -9033,8 +8950,7 @@ inline bool interior_edge_exists(const mesh_t& m, const vd_t& src, const vd_t& t
                         MCUT_ASSERT(m0_to_ps_face.count(as_m0_descr) == 1);
                         const fd_t as_ps_descr = m0_to_ps_face.at(as_m0_descr);
 
-                        MCUT_ASSERT(ps_to_cm_face.count(as_ps_descr) == 1);
-                        fd_t as_cm_descr = ps_to_cm_face.at(as_ps_descr);
+                        fd_t as_cm_descr = ps_to_cm_face(as_ps_descr, sm_face_count);
 
                         // add an offset which allows users to deduce which birth/origin mesh (source or cut mesh) a face (map value) belongs to.
                         as_cm_descr = static_cast<fd_t>(as_cm_descr + sm_face_count);
@@ -9244,13 +9160,13 @@ inline bool interior_edge_exists(const mesh_t& m, const vd_t& src, const vd_t& t
             char,              // color value
             std::map<int, int> // copy of m0_to_m1_face (initially containing mappings just for traced source-mesh polygon)
             >
-            color_to_m0_to_m1_face = {{'A', m0_to_m1_face}, {'B', m0_to_m1_face}};
+            color_to_m0_to_m1_face;
 
         std::map<
             char,              // color value
             std::map<int, int> // copy of m1_to_m0_face (initially containing mappings just for traced source-mesh polygon)
             >
-            color_to_m1_to_m0_face = {{'A', m1_to_m0_face}, {'B', m1_to_m0_face}};
+            color_to_m1_to_m0_face;
 
         std::map<char, std::map<vd_t, // "m1" cut-mesh vtx instance
                                 vd_t  // "m0" cut-mesh ovtx instance
@@ -9261,30 +9177,67 @@ inline bool interior_edge_exists(const mesh_t& m, const vd_t& src, const vd_t& t
             char,                // color value
             std::map<vd_t, vd_t> // copy of "m0_to_m1_vtx" (initially containing mappings just for original source-mesh & cut-mesh vertices i.e. no ivertices included!)
             >
-            color_to_m1_to_m0_sm_ovtx = {{'A', m1_to_m0_ovtx}, {'B', m1_to_m0_ovtx}};
+            color_to_m1_to_m0_sm_ovtx;
+
+        // returns whether the patches of the given color are stitched, as per user flags
+        auto color_is_stitched = [&](const char color_id) -> bool {
+            const cut_surface_patch_location_t &location = patch_color_label_to_location.at(color_id);
+            return !((location == cut_surface_patch_location_t::INSIDE && !(input.keep_fragments_sealed_inside || input.keep_fragments_sealed_inside_exhaustive)) || //
+                     (location == cut_surface_patch_location_t::OUTSIDE && !(input.keep_fragments_sealed_outside || input.keep_fragments_sealed_outside_exhaustive)));
+        };
+
+        // The last color to be stitched takes "m1" (and its maps) instead of a copy, since
+        // they are not used after stitching.
+        char last_stitched_color_id = 0;
 
-        // for each color  ("interior" / "exterior")
         for (std::map<char, std::vector<int>>::const_iterator color_to_patches_iter = color_to_patch.cbegin();
              color_to_patches_iter != color_to_patch.cend();
              ++color_to_patches_iter)
         {
-            lg.indent();
-
-            const char color_id = color_to_patches_iter->first;
+            if (color_is_stitched(color_to_patches_iter->first))
+            {
+                last_stitched_color_id = color_to_patches_iter->first;
+            }
+        }
 
-            lg << "color : " << color_id << " (" << (patch_color_label_to_location.at(color_id) == cut_surface_patch_location_t::OUTSIDE ? "exterior" : "interior") << ")" << std::endl;
+        // the colors whose patches are stitched (in order)
+        std::vector<char> stitched_color_ids;
 
-            const cut_surface_patch_location_t &location = patch_color_label_to_location.at(color_id);
+        // for each color  ("interior" / "exterior"), create the copy of "m1" (and its maps) to which its patches are stitched
+        for (std::map<char, std::vector<int>>::const_iterator color_to_patches_iter = color_to_patch.cbegin();
+             color_to_patches_iter != color_to_patch.cend();
+             ++color_to_patches_iter)
+        {
+            const char color_id = color_to_patches_iter->first;
 
-            if ((location == cut_surface_patch_location_t::INSIDE && !(input.keep_fragments_sealed_inside || input.keep_fragments_sealed_inside_exhaustive)) || //
-                (location == cut_surface_patch_location_t::OUTSIDE && !(input.keep_fragments_sealed_outside || input.keep_fragments_sealed_outside_exhaustive)))
+            if (!color_is_stitched(color_id))
             {
+                lg << "skip color : " << color_id << std::endl;
                 continue; // skip stitching of exterior/ interior patches as user desires.
             }
 
-            MCUT_ASSERT(color_to_m1.count(color_id) == 1);
-            // get the reference to the copy of "m1" to which patches of the current color will be stitched
-            mesh_t &m1_colored = color_to_m1.at(color_id);
+            stitched_color_ids.push_back(color_id);
+
+            const bool is_last_stitched_color = (color_id == last_stitched_color_id);
+
+            MCUT_ASSERT(color_to_m1.count(color_id) == 0);
+            // create the copy of "m1" to which patches of the current color will be stitched
+            mesh_t &m1_colored = color_to_m1[color_id];
+
+            if (is_last_stitched_color)
+            {
+                m1_colored = std::move(m1);
+                color_to_m0_to_m1_face[color_id] = std::move(m0_to_m1_face);
+                color_to_m1_to_m0_face[color_id] = std::move(m1_to_m0_face);
+                color_to_m1_to_m0_sm_ovtx[color_id] = std::move(m1_to_m0_ovtx);
+            }
+            else
+            {
+                m1_colored = m1; // copy
+                color_to_m0_to_m1_face[color_id] = m0_to_m1_face;
+                color_to_m1_to_m0_face[color_id] = m1_to_m0_face;
+                color_to_m1_to_m0_sm_ovtx[color_id] = m1_to_m0_ovtx;
+            }
 
 #if 0
         // used to keep track of already-calculated edges in "color_to_m1"
@@ -9318,20 +9271,49 @@ inline bool interior_edge_exists(const mesh_t& m, const vd_t& src, const vd_t& t
 
             // create entry
             color_to_m0_to_m1_he_instances.insert(std::make_pair(color_id, std::map<hd_t, std::map<int, hd_t>>()));
-            // ref to entry
-            std::map<hd_t, std::map<int, hd_t>> &m0_to_m1_he_instances = color_to_m0_to_m1_he_instances.at(color_id);
             // copy all of the "m1_polygons" that were created before we got to the stitching stage
             // Note: Before stitching has began, "m1_polygons" contains only source-mesh polygons,
             // which have been partition to allow separation of unsealed connected components
-            std::pair<std::map<char, std::vector<traced_polygon_t>>::iterator, bool> color_to_m1_polygons_insertion = color_to_m1_polygons.insert(std::make_pair(color_id, m1_polygons)); // copy!
+            std::pair<std::map<char, std::vector<traced_polygon_t>>::iterator, bool> color_to_m1_polygons_insertion = color_to_m1_polygons.insert(std::make_pair(color_id, is_last_stitched_color ? std::move(m1_polygons) : m1_polygons)); // copy (unless last color)
 
             MCUT_ASSERT(color_to_m1_polygons_insertion.second == true);
 
+            // create the list connected components (see declaration for details)
+            color_to_separated_connected_ccsponents.insert(std::make_pair(color_id, std::map<std::size_t, std::vector<std::pair<mesh_t, connected_component_info_t>>>()));
+
+            MCUT_ASSERT(colour_to_m1_to_m0_cm_ovtx.count(color_id) == 0);
+            colour_to_m1_to_m0_cm_ovtx.insert(std::make_pair(color_id, std::map<vd_t, vd_t>()));
+        }
+
+        // keeps track of the total number of cut-mesh polygons for each stitched color
+        std::vector<int> color_stitched_poly_counts(stitched_color_ids.size(), 0);
+
+        // With a stitching callback, the intermediate (partially sealed) states of the fragments are streamed to
+        // the callback as each polygon is stitched, so the "exhaustive" options do not also keep a copy of each
+        // state. Only the fully sealed fragments are then output as connected components.
+        const bool keep_partially_sealed_fragment_copies = !input.stitched_polygon_callback && //
+            (input.keep_fragments_sealed_inside_exhaustive || input.keep_fragments_sealed_outside_exhaustive);
+
+        // stitch the patches of the color at "color_index" in "stitched_color_ids"
+        auto stitch_color_patches = [&](const uint32_t color_index) {
+            lg.indent();
+
+            const char color_id = stitched_color_ids[color_index];
+
+            lg << "color : " << color_id << " (" << (patch_color_label_to_location.at(color_id) == cut_surface_patch_location_t::OUTSIDE ? "exterior" : "interior") << ")" << std::endl;
+
+            // the patches with current color
+            const std::vector<int> &color_patches = color_to_patch.at(color_id);
+
+            // ref to the copy of "m1" to which patches of the current color will be stitched
+            mesh_t &m1_colored = color_to_m1.at(color_id);
+            std::map<hd_t, std::map<int, hd_t>> &m0_to_m1_he_instances = color_to_m0_to_m1_he_instances.at(color_id);
+
             // ref to "m1_polygons" i.e. the source-mesh polygons with partitioning
-            std::vector<traced_polygon_t> &m1_polygons_colored = color_to_m1_polygons_insertion.first->second;
+            std::vector<traced_polygon_t> &m1_polygons_colored = color_to_m1_polygons.at(color_id);
 
             // reference to the list connected components (see declaration for details)
-            std::map<std::size_t, std::vector<std::pair<mesh_t, connected_component_info_t>>> &separated_stitching_CCs = color_to_separated_connected_ccsponents[color_id]; // insert
+            std::map<std::size_t, std::vector<std::pair<mesh_t, connected_component_info_t>>> &separated_stitching_CCs = color_to_separated_connected_ccsponents.at(color_id);
 
             std::map<int, int> &m0_to_m1_face_colored = color_to_m0_to_m1_face.at(color_id); // note: containing mappings only for traced source mesh polygons initially!
             std::map<int, int> &m1_to_m0_face_colored = color_to_m1_to_m0_face.at(color_id);
@@ -9350,19 +9332,21 @@ inline bool interior_edge_exists(const mesh_t& m, const vd_t& src, const vd_t& t
             // This map works like "color_to_m0_to_m1_sm_ovtx" but the difference is that each
             // "m0" vertex has two "m1" copies because we generate ccw & cw patches.
 
-            MCUT_ASSERT(colour_to_m1_to_m0_cm_ovtx.count(color_id) == 0);
             std::map<vd_t, // "m1" cut-mesh vtx instance
                      vd_t  // "m0" cut-mesh ovtx instance
-                     > &m1_to_m0_cm_ovtx_colored = colour_to_m1_to_m0_cm_ovtx[color_id];
+                     > &m1_to_m0_cm_ovtx_colored = colour_to_m1_to_m0_cm_ovtx.at(color_id);
 
-            lg << "patches : " << color_to_patches_iter->second.size() << std::endl;
+            // reused for each call to "input.stitched_polygon_callback"
+            stitched_polygon_info_t stitched_polygon;
+
+            lg << "patches : " << color_patches.size() << std::endl;
 
             // keeps track of the total number of cut-mesh polygons for the current color tag (interior/ext)
-            int stitched_poly_counter = 0;
+            int &stitched_poly_counter = color_stitched_poly_counts[color_index];
 
             // for each patch with current color
-            for (std::vector<int>::const_iterator patch_iter = color_to_patches_iter->second.cbegin();
-                 patch_iter != color_to_patches_iter->second.cend();
+            for (std::vector<int>::const_iterator patch_iter = color_patches.cbegin();
+                 patch_iter != color_patches.cend();
                  ++patch_iter)
             {
                 lg.indent();
@@ -10488,7 +10472,29 @@ inline bool interior_edge_exists(const mesh_t& m, const vd_t& src, const vd_t& t
 
                     // save meshes and dump
 
-                    if (input.keep_fragments_sealed_inside_exhaustive || input.keep_fragments_sealed_outside_exhaustive)
+                    if (input.stitched_polygon_callback)
+                    {
+                        // pass on just the new polygon (the difference from the previous state of the fragment)
+                        stitched_polygon.location = patch_color_label_to_location.at(color_id);
+                        stitched_polygon.stitch_index = stitched_poly_counter;
+                        MCUT_ASSERT(m0_to_ps_face.count(m0_cur_patch_cur_poly_idx) == 1);
+                        stitched_polygon.cut_mesh_face = ps_to_cm_face(m0_to_ps_face.at(m0_cur_patch_cur_poly_idx), sm_face_count);
+                        stitched_polygon.vertices.clear();
+                        stitched_polygon.vertex_coords.clear();
+
+                        const traced_polygon_t &m1_stitched_poly = m1_polygons_colored.back();
+
+                        for (traced_polygon_t::const_iterator he_iter = m1_stitched_poly.cbegin(); he_iter != m1_stitched_poly.cend(); ++he_iter)
+                        {
+                            const vd_t m1_vertex = m1_colored.target(*he_iter);
+                            stitched_polygon.vertices.push_back(m1_vertex);
+                            stitched_polygon.vertex_coords.push_back(m1_colored.vertex(m1_vertex));
+                        }
+
+                        input.stitched_polygon_callback(stitched_polygon);
+                    }
+
+                    if (keep_partially_sealed_fragment_copies)
                     {
                         ///////////////////////////////////////////////////////////////////////////
                         // create the sealed meshes defined by the [current] set of traced polygons
@@ -10496,6 +10502,7 @@ inline bool interior_edge_exists(const mesh_t& m, const vd_t& src, const vd_t& t
 
                         extract_connected_components(
                             separated_stitching_CCs,
+                            *input.scheduler,
                             m1_colored,
                             0,
                             m1_polygons_colored,
@@ -10507,10 +10514,6 @@ inline bool interior_edge_exists(const mesh_t& m, const vd_t& src, const vd_t& t
                             m1_to_m0_face_colored,
                             m0_to_ps_vtx,
                             m0_to_ps_face,
-                            ps_to_sm_vtx,
-                            ps_to_sm_face,
-                            ps_to_cm_vtx,
-                            ps_to_cm_face,
                             sm_vtx_cnt,
                             sm_face_count,
                             input.populate_vertex_maps,
@@ -10520,7 +10523,6 @@ inline bool interior_edge_exists(const mesh_t& m, const vd_t& src, const vd_t& t
                             input.keep_fragments_partially_cut);
                     }
 
-                    ++global_cm_poly_stitch_counter;
                     stitched_poly_counter++;
 
                     lg.unindent();
@@ -10534,7 +10536,30 @@ inline bool interior_edge_exists(const mesh_t& m, const vd_t& src, const vd_t& t
                 lg.unindent();
             } // for each patch
             lg.unindent();
-        } // for each color
+        };
+
+        // NOTE: The colors are stitched concurrently (one task per color) since each color has its own copy
+        // of "m1" and its maps, while the data that is shared by the colors is only read. A verbose dispatch
+        // stitches one color at a time because the logger is not thread-safe.
+        if (input.verbose || stitched_color_ids.size() < 2)
+        {
+            for (uint32_t color_index = 0; color_index < (uint32_t)stitched_color_ids.size(); ++color_index)
+            {
+                stitch_color_patches(color_index);
+            }
+        }
+        else
+        {
+            parallel_invoke(*input.scheduler, (uint32_t)stitched_color_ids.size(), [&](uint32_t color_index) {
+                const logger_ptr_scope_t logger_scope(&lg); // (for a helper thread)
+                stitch_color_patches(color_index);
+            });
+        }
+
+        for (std::vector<int>::const_iterator i = color_stitched_poly_counts.cbegin(); i != color_stitched_poly_counts.cend(); ++i)
+        {
+            global_cm_poly_stitch_counter += *i;
+        }
 
         TIME_PROFILE_END(); // &&&&&
 
@@ -10558,8 +10583,9 @@ inline bool interior_edge_exists(const mesh_t& m, const vd_t& src, const vd_t& t
 
         lg << "total cut-mesh polygons stitched = " << global_cm_poly_stitch_counter << std::endl;
 
-        bool userWantsFullySealedFragmentsANY = (input.keep_fragments_sealed_inside || input.keep_fragments_sealed_outside);
-        bool userWantsEvenPartiallySealedFragmentsANY = (input.keep_fragments_sealed_inside_exhaustive || input.keep_fragments_sealed_outside_exhaustive);
+        bool userWantsFullySealedFragmentsANY = (input.keep_fragments_sealed_inside || input.keep_fragments_sealed_outside || //
+                                                 input.keep_fragments_sealed_inside_exhaustive || input.keep_fragments_sealed_outside_exhaustive);
+        bool userWantsEvenPartiallySealedFragmentsANY = keep_partially_sealed_fragment_copies;
 
         // if the user wants [only] fully sealed fragment (not partially sealed)
         if (userWantsFullySealedFragmentsANY && //
@@ -10571,10 +10597,18 @@ inline bool interior_edge_exists(const mesh_t& m, const vd_t& src, const vd_t& t
 
             lg << "create final sealed connected components" << std::endl;
 
+            std::vector<std::map<char, std::map<std::size_t, std::vector<std::pair<mesh_t, connected_component_info_t>>>>::iterator> color_to_separated_CCs_iters;
+
             for (std::map<char, std::map<std::size_t, std::vector<std::pair<mesh_t, connected_component_info_t>>>>::iterator color_to_separated_CCs_iter = color_to_separated_connected_ccsponents.begin();
                  color_to_separated_CCs_iter != color_to_separated_connected_ccsponents.end();
                  ++color_to_separated_CCs_iter)
             {
+                color_to_separated_CCs_iters.push_back(color_to_separated_CCs_iter);
+            }
+
+            // extract the sealed connected components of the color at "color_index" in "color_to_separated_CCs_iters"
+            auto extract_sealed_connected_components = [&](const uint32_t color_index) {
+                std::map<char, std::map<std::size_t, std::vector<std::pair<mesh_t, connected_component_info_t>>>>::iterator color_to_separated_CCs_iter = color_to_separated_CCs_iters[color_index];
 
                 const char color_label = color_to_separated_CCs_iter->first;
                 std::map<std::size_t, std::vector<std::pair<mesh_t, connected_component_info_t>>> &separated_sealed_CCs = color_to_separated_CCs_iter->second;
@@ -10593,6 +10627,7 @@ inline bool interior_edge_exists(const mesh_t& m, const vd_t& src, const vd_t& t
                 // extract the seam vertices
                 extract_connected_components(
                     separated_sealed_CCs,
+                    *input.scheduler,
                     m1_colored,
                     0,
                     m1_polygons_colored,
@@ -10604,10 +10639,6 @@ inline bool interior_edge_exists(const mesh_t& m, const vd_t& src, const vd_t& t
                     m1_to_m0_face_colored,
                     m0_to_ps_vtx,
                     m0_to_ps_face,
-                    ps_to_sm_vtx,
-                    ps_to_sm_face,
-                    ps_to_cm_vtx,
-                    ps_to_cm_face,
                     sm_vtx_cnt,
                     sm_face_count,
                     input.populate_vertex_maps,
@@ -10615,6 +10646,22 @@ inline bool interior_edge_exists(const mesh_t& m, const vd_t& src, const vd_t& t
                     input.keep_fragments_below_cutmesh,
                     input.keep_fragments_above_cutmesh,
                     input.keep_fragments_partially_cut);
+            };
+
+            // NOTE: like stitching, the colors are processed concurrently unless the dispatch is verbose
+            if (input.verbose || color_to_separated_CCs_iters.size() < 2)
+            {
+                for (uint32_t color_index = 0; color_index < (uint32_t)color_to_separated_CCs_iters.size(); ++color_index)
+                {
+                    extract_sealed_connected_components(color_index);
+                }
+            }
+            else
+            {
+                parallel_invoke(*input.scheduler, (uint32_t)color_to_separated_CCs_iters.size(), [&](uint32_t color_index) {
+                    const logger_ptr_scope_t logger_scope(&lg); // (for a helper thread)
+                    extract_sealed_connected_components(color_index);
+                });
             }
         }
 
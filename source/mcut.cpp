@@ -25,6 +25,7 @@
 #include "mcut/internal/geom.h"
 #include "mcut/internal/kernel.h"
 #include "mcut/internal/math.h"
+#include "mcut/internal/parallel.h"
 #include "mcut/internal/utils.h"
 
 #if !defined(MCUT_WITH_ARBITRARY_PRECISION_NUMBERS)
@@ -32,11 +33,15 @@
 #endif // #if !defined(MCUT_WITH_ARBITRARY_PRECISION_NUMBERS)
 
 #include <algorithm>
+#include <condition_variable>
 #include <fstream>
 #include <memory>
+#include <mutex>
+#include <new> // std::bad_alloc
 #include <random> // perturbation
 #include <stdio.h>
 #include <string.h>
+#include <type_traits>
 
 #if defined(MCUT_BUILD_WINDOWS)
 #pragma warning(disable : 26812)
@@ -150,35 +155,155 @@ mp_rnd_t convertRoundingMode(McRoundingModeFlags rm)
 }
 #endif // #if !defined(MCUT_WITH_ARBITRARY_PRECISION_NUMBERS)
 
-struct IndexArrayMesh {
-    IndexArrayMesh() { }
-    ~IndexArrayMesh()
+// the functions that allocate the arrays of connected components (see mcSetConnectedComponentAllocator)
+struct McAllocator {
+    pfn_mcAllocate_CALLBACK pfnAllocate = nullptr; // null for the default allocator (i.e. new[])
+    pfn_mcFree_CALLBACK pfnFree = nullptr;
+    const void* userParam = nullptr;
+};
+
+// frees an array with the allocator that it was allocated with
+template <typename T>
+struct OutputArrayDeleter {
+    McAllocator allocator;
+
+    OutputArrayDeleter() { }
+
+    explicit OutputArrayDeleter(const McAllocator& allocator_)
+        : allocator(allocator_)
+    {
+    }
+
+    void operator()(T* p) const
     {
-        pVertices.release();
-        pFaceIndices.release();
-        pFaceSizes.release();
-        pEdges.release();
+        if (allocator.pfnFree != nullptr) {
+            allocator.pfnFree(reinterpret_cast<void*>(p), allocator.userParam);
+        } else {
+            delete[] p;
+        }
+    }
+};
+
+template <typename T>
+using OutputArray = std::unique_ptr<T[], OutputArrayDeleter<T>>;
+
+// allocate an array of "n" elements (null if "n" is zero).
+// Throws std::bad_alloc if the memory cannot be allocated.
+template <typename T>
+OutputArray<T> allocateOutputArray(const McAllocator& allocator, const size_t n)
+{
+    if (n == 0) {
+        return OutputArray<T>(nullptr, OutputArrayDeleter<T>(allocator));
+    }
+
+    if (allocator.pfnAllocate == nullptr) {
+        return OutputArray<T>(new T[n], OutputArrayDeleter<T>(allocator));
+    }
+
+    // NOTE: the memory from a user allocator is not initialised (i.e. no constructors are called)
+    MCUT_ASSERT(std::is_trivial<T>::value);
+
+    void* pMem = allocator.pfnAllocate((uint64_t)(n * sizeof(T)), (uint64_t)alignof(T), allocator.userParam);
+
+    if (pMem == nullptr) {
+        throw std::bad_alloc();
     }
 
-    std::unique_ptr<mcut::math::real_number_t[]> pVertices;
-    std::unique_ptr<uint32_t[]> pSeamVertexIndices;
-    std::unique_ptr<uint32_t[]> pVertexMapIndices; // descriptor/index in original mesh (source/cut-mesh), each vertex has an entry
-    std::unique_ptr<uint32_t[]> pFaceIndices;
-    std::unique_ptr<uint32_t[]> pFaceMapIndices; // descriptor/index in original mesh (source/cut-mesh), each face has an entry
-    std::unique_ptr<uint32_t[]> pFaceSizes;
-    std::unique_ptr<uint32_t[]> pEdges;
+    return OutputArray<T>(static_cast<T*>(pMem), OutputArrayDeleter<T>(allocator));
+}
+
+struct IndexArrayMesh {
+    OutputArray<mcut::math::real_number_t> pVertices; // null if the vertices are stored in "pVerticesFloat"
+    OutputArray<float> pVerticesFloat; // see MC_DISPATCH_OUTPUT_VERTEX_ARRAY_FLOAT
+    OutputArray<uint32_t> pSeamVertexIndices;
+    OutputArray<uint32_t> pVertexMapIndices; // descriptor/index in original mesh (source/cut-mesh), each vertex has an entry
+    OutputArray<uint32_t> pFaceIndices;
+    OutputArray<uint32_t> pFaceMapIndices; // descriptor/index in original mesh (source/cut-mesh), each face has an entry
+    OutputArray<uint32_t> pFaceSizes;
+    OutputArray<uint32_t> pEdges;
+    OutputArray<uint32_t> pFaceTriangulation; // computed when first queried (see "triangulateConnComp")
+    OutputArray<uint32_t> pFaceTriangulationMap; // face map value of each triangle
 
     uint32_t numVertices = 0;
     uint32_t numSeamVertexIndices = 0;
     uint32_t numFaces = 0;
     uint32_t numFaceIndices = 0;
     uint32_t numEdgeIndices = 0;
+    uint32_t numFaceTriangulationIndices = 0;
+    bool isTriangulated = false;
+};
+
+// get a vertex coordinate of "indexArrayMesh" (which is stored in either of its vertex arrays) as type "T"
+template <typename T>
+T getVertexCoordinate(const IndexArrayMesh& indexArrayMesh, const size_t index)
+{
+    if (indexArrayMesh.pVerticesFloat != nullptr) {
+        return static_cast<T>(indexArrayMesh.pVerticesFloat[index]);
+    }
+
+#if !defined(MCUT_WITH_ARBITRARY_PRECISION_NUMBERS)
+    return static_cast<T>(indexArrayMesh.pVertices[index]);
+#else
+    return static_cast<T>(indexArrayMesh.pVertices[index].to_double());
+#endif
+}
+
+// The data of a dispatch call that is shared by its connected components, which is needed to map
+// their vertices and faces to the user-provided input meshes (see "halfedgeMeshToIndexArrayMesh")
+struct DispatchDataMaps {
+    std::map<mcut::vd_t, mcut::math::vec3> addedFpPartitioningVerticesOnSrcMesh;
+    std::map<mcut::fd_t, mcut::fd_t> fpPartitionChildFaceToInputSrcMeshFace;
+    std::map<mcut::vd_t, mcut::math::vec3> addedFpPartitioningVerticesOnCutMesh; // offsetted
+    std::map<mcut::fd_t, mcut::fd_t> fpPartitionChildFaceToInputCutMeshFace; // offsetted
+    int userSrcMeshVertexCount = 0;
+    int userSrcMeshFaceCount = 0;
+    int internalSrcMeshVertexCount = 0;
+    int internalSrcMeshFaceCount = 0;
+    bool outputFloatVertices = false; // MC_DISPATCH_OUTPUT_VERTEX_ARRAY_FLOAT
+};
+
+// the source-mesh of a dispatch call in the internal format, and its BVH (also used for
+// the cut-mesh of mcDispatchMeshes)
+struct DispatchSrcMesh {
+    mcut::mesh_t mesh;
+    std::vector<mcut::geom::bounding_box_t<mcut::math::fast_vec3>> bvhAABBs;
+    std::vector<mcut::fd_t> bvhLeafNodeFaces;
+    // as provided by the user
+    uint32_t numInputVertices = 0;
+    uint32_t numInputFaces = 0;
+};
+
+// a source-mesh that is created with mcCreateMesh, which can be cut many times without being rebuilt
+struct McMeshInternal {
+    // NOTE: replaced by mcUpdateMesh, while mcRefitMesh and mcSetMeshTransform only move its vertices
+    std::shared_ptr<DispatchSrcMesh> srcMesh;
+    // traversal cost of the source-mesh BVH when it was last built (see getOIBVHCost)
+    double bvhBuildCost = 0.0;
+    // the untransformed vertices of a mesh that has a transform (see mcSetMeshTransform), which is
+    // row-major and affine. Empty if the mesh has no transform (i.e. the identity).
+    std::vector<mcut::math::vec3> restVertices;
+    double transform[16] = {};
+    // whether "srcMesh" holds the transformed vertices. Otherwise, it holds "restVertices" (with its BVH in
+    // the frame of the mesh) and the transform is applied when needed: to the BVH and the placed copy of
+    // the mesh by mcDispatchMeshes (i.e. for a cut-mesh), or to "srcMesh" by applyMeshTransform.
+    bool transformIsApplied = false;
 };
 
 struct McConnCompBase {
     virtual ~McConnCompBase() {};
     McConnectedComponentType type = (McConnectedComponentType)0;
+    uint32_t cutMeshIndex = 0; // index of the cut-mesh in a batched dispatch
     IndexArrayMesh indexArrayMesh;
+
+    // The output of the kernel, which is converted into "indexArrayMesh" when the connected
+    // component is first queried (and then freed). Null once converted.
+    std::unique_ptr<mcut::output_mesh_info_t> kernelMesh;
+    std::shared_ptr<const DispatchDataMaps> dataMaps;
+    std::mutex conversionMutex; // connected components can be queried by multiple threads
+
+    // vertex arrays which are converted from the vertices of "indexArrayMesh" for mcMapConnectedComponentData
+    OutputArray<float> mappedVerticesFloat;
+    OutputArray<double> mappedVerticesDouble;
 };
 
 struct McFragmentConnComp : public McConnCompBase {
@@ -207,12 +332,24 @@ void ccDeletorFunc(McConnCompBase* p)
 
 struct McDispatchContextInternal {
     std::map<McConnectedComponent, std::unique_ptr<McConnCompBase, void (*)(McConnCompBase*)>> connComps = {};
+    // for adding connected components during a batched dispatch, and while enqueued dispatches run
+    // concurrently with the functions that query connected components
+    std::mutex connCompsMutex;
+    std::map<McMesh, std::unique_ptr<McMeshInternal>> meshes = {};
 
     // state & dispatch flags
     // -----
     McFlags flags = (McFlags)0;
     McFlags dispatchFlags = (McFlags)0;
 
+    // allocator of connected component data
+    // -------
+    McAllocator connCompAllocator;
+
+    // threads that execute the parallel parts of dispatch calls (persists for the lifetime of the context)
+    // -------
+    std::unique_ptr<mcut::thread_pool> scheduler;
+
     // debugging
     // ---------
     pfn_mcDebugOutput_CALLBACK debugCallback = nullptr;
@@ -221,6 +358,25 @@ struct McDispatchContextInternal {
     McFlags debugType = 0;
     McFlags debugSeverity = 0;
     std::string lastLoggedDebugDetail = "";
+    // messages can be logged by multiple threads of a dispatch call (e.g. during output conversion),
+    // but the user's callback is never called concurrently
+    std::mutex debugMutex;
+
+    // receives the polygons stitched by dispatch calls (see mcSetStitchingCallback)
+    // -------
+    pfn_mcStitching_CALLBACK stitchingCallback = nullptr;
+    const void* stitchingCallbackUserParam = nullptr;
+    // the cuts of a batched dispatch (and the inside and outside patches of one cut) are stitched concurrently,
+    // but the user's callback is never called concurrently
+    std::mutex stitchingCallbackMutex;
+
+    // return the state of "connComp", or nullptr if it is not a connected component of the context
+    McConnCompBase* findConnComp(const McConnectedComponent connComp)
+    {
+        std::lock_guard<std::mutex> lock(connCompsMutex);
+        auto ccRef = connComps.find(connComp);
+        return (ccRef == connComps.cend()) ? nullptr : ccRef->second.get();
+    }
 
     void log(McDebugSource source,
         McDebugType type,
@@ -229,6 +385,7 @@ struct McDispatchContextInternal {
         const std::string& message)
     {
         if (debugCallback != nullptr) {
+            std::lock_guard<std::mutex> lock(debugMutex);
             (*debugCallback)(source, type, id, severity, message.length(), message.c_str(), debugCallbackUserParam);
         }
     }
@@ -298,6 +455,11 @@ struct McDispatchContextInternal {
         // }
 #endif
     }
+
+    // asynchronous dispatch calls (see mcEnqueueDispatch)
+    // -------
+    // NOTE: declared last so that pending commands are executed before the rest of the context is destroyed
+    mcut::command_queue commands;
 };
 
 #if !defined(MCUT_WITH_ARBITRARY_PRECISION_NUMBERS)
@@ -312,10 +474,111 @@ const mpfr_prec_t McDispatchContextInternal::minPrecision = MPFR_PREC_MIN;
 const mpfr_prec_t McDispatchContextInternal::maxPrecision = MPFR_PREC_MAX;
 #endif // #if !defined(MCUT_WITH_ARBITRARY_PRECISION_NUMBERS)
 
+// All contexts that have been created and not yet released. The exclusive lock is only taken while a
+// context is created or released: the other API functions look up their context with the shared lock
+// (see findDispatchContext), so that threads which use different contexts do not serialize on it.
 std::map<McContext, std::unique_ptr<McDispatchContextInternal>> gDispatchContexts;
+mcut::shared_mutex gDispatchContextsMutex;
+
+// return the state of "context", or nullptr if "context" is not a valid handle
+// NOTE: std::map does not relocate its elements, so the state remains valid until the context is released
+McDispatchContextInternal* findDispatchContext(const McContext context)
+{
+    mcut::shared_lock_guard lock(gDispatchContextsMutex);
+    auto ctxtIter = gDispatchContexts.find(context);
+    return (ctxtIter == gDispatchContexts.end()) ? nullptr : ctxtIter->second.get();
+}
+
+struct McEventInternal {
+    McContext context = MC_NULL_HANDLE;
+
+    std::mutex mutex; // protects the members below
+    std::condition_variable completed;
+    bool signalled = false; // command is complete and the callbacks have been called
+    McEventCommandExecStatus commandExecStatus = MC_SUBMITTED;
+    McResult runtimeExecStatus = MC_NO_ERROR;
+    std::vector<std::pair<pfn_McEvent_CALLBACK, void*>> callbacks;
+
+    McEventCommandExecStatus getCommandExecStatus()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return commandExecStatus;
+    }
+
+    McResult getRuntimeExecStatus()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return runtimeExecStatus;
+    }
+
+    void setRunning()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        commandExecStatus = MC_RUNNING;
+    }
+
+    void setComplete(McResult result)
+    {
+        std::vector<std::pair<pfn_McEvent_CALLBACK, void*>> callbacksToCall;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            commandExecStatus = MC_COMPLETE;
+            runtimeExecStatus = result;
+            callbacksToCall.swap(callbacks);
+        }
+
+        // called without holding the lock so that callbacks can query the event
+        for (std::vector<std::pair<pfn_McEvent_CALLBACK, void*>>::const_iterator i = callbacksToCall.cbegin(); i != callbacksToCall.cend(); ++i) {
+            (*i->first)(reinterpret_cast<McEvent>(this), i->second);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            signalled = true;
+        }
+
+        completed.notify_all();
+    }
+
+    // return the error code of the command once it is complete (and its callbacks have returned)
+    McResult wait()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        completed.wait(lock, [&]() { return signalled; });
+        return runtimeExecStatus;
+    }
+
+    void addCallback(pfn_McEvent_CALLBACK cb, void* data)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (commandExecStatus != MC_COMPLETE) {
+                callbacks.emplace_back(cb, data);
+                return;
+            }
+        }
+
+        (*cb)(reinterpret_cast<McEvent>(this), data);
+    }
+};
+
+// All events that have been created and not yet released. An event is shared with the command that
+// it is associated with, so that the user can release it before the command is complete.
+std::map<McEvent, std::shared_ptr<McEventInternal>> gEvents;
+std::mutex gEventsMutex;
+
+// return the state of "event", or nullptr if "event" is not a valid handle
+std::shared_ptr<McEventInternal> findEvent(const McEvent event)
+{
+    std::lock_guard<std::mutex> lock(gEventsMutex);
+    auto eventIter = gEvents.find(event);
+    return (eventIter == gEvents.end()) ? nullptr : eventIter->second;
+}
 
 McResult indexArrayMeshToHalfedgeMesh(
-    std::unique_ptr<McDispatchContextInternal>& ctxtPtr,
+    McDispatchContextInternal* ctxtPtr,
+    const McFlags vertexArrayFlags, // MC_DISPATCH_VERTEX_ARRAY_FLOAT or MC_DISPATCH_VERTEX_ARRAY_DOUBLE
     mcut::mesh_t& halfedgeMesh,
     mcut::math::real_number_t& bboxDiagonal,
     const void* pVertices,
@@ -328,26 +591,27 @@ McResult indexArrayMeshToHalfedgeMesh(
     ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_OTHER, 0, McDebugSeverity::MC_DEBUG_SEVERITY_NOTIFICATION, "construct halfedge mesh");
 
     McResult result = McResult::MC_NO_ERROR;
-    std::map<uint32_t, mcut::vd_t> vmap;
+    std::vector<mcut::math::vec3> vertices;
+    vertices.reserve(numVertices);
 
-    if (ctxtPtr->dispatchFlags & MC_DISPATCH_VERTEX_ARRAY_FLOAT) {
+    if (vertexArrayFlags & MC_DISPATCH_VERTEX_ARRAY_FLOAT) {
         const float* vptr = reinterpret_cast<const float*>(pVertices);
         for (uint32_t i = 0; i < numVertices; ++i) {
             const float& x = vptr[(i * 3) + 0];
             const float& y = vptr[(i * 3) + 1];
             const float& z = vptr[(i * 3) + 2];
-            vmap[i] = halfedgeMesh.add_vertex(
+            vertices.emplace_back(
                 x + (perturbation != NULL ? (*perturbation).x() : 0.f),
                 y + (perturbation != NULL ? (*perturbation).y() : 0.f),
                 z + (perturbation != NULL ? (*perturbation).z() : 0.f));
         }
-    } else if (ctxtPtr->dispatchFlags & MC_DISPATCH_VERTEX_ARRAY_DOUBLE) {
+    } else if (vertexArrayFlags & MC_DISPATCH_VERTEX_ARRAY_DOUBLE) {
         const double* vptr = reinterpret_cast<const double*>(pVertices);
         for (uint32_t i = 0; i < numVertices; ++i) {
             const double& x = vptr[(i * 3) + 0];
             const double& y = vptr[(i * 3) + 1];
             const double& z = vptr[(i * 3) + 2];
-            vmap[i] = halfedgeMesh.add_vertex(
+            vertices.emplace_back(
                 x + (perturbation != NULL ? (*perturbation).x() : 0.f),
                 y + (perturbation != NULL ? (*perturbation).y() : 0.f),
                 z + (perturbation != NULL ? (*perturbation).z() : 0.f));
@@ -364,21 +628,19 @@ McResult indexArrayMeshToHalfedgeMesh(
 
     mcut::math::vec3 bboxMin(1e10);
     mcut::math::vec3 bboxMax(-1e10);
-    for (mcut::mesh_t::vertex_iterator_t i = halfedgeMesh.vertices_begin(); i != halfedgeMesh.vertices_end(); ++i) {
-        const mcut::math::vec3& coords = halfedgeMesh.vertex(*i);
-        bboxMin = mcut::math::compwise_min(bboxMin, coords);
-        bboxMax = mcut::math::compwise_max(bboxMax, coords);
+    for (std::vector<mcut::math::vec3>::const_iterator i = vertices.cbegin(); i != vertices.cend(); ++i) {
+        bboxMin = mcut::math::compwise_min(bboxMin, *i);
+        bboxMax = mcut::math::compwise_max(bboxMax, *i);
     }
     bboxDiagonal = mcut::math::length(bboxMax - bboxMin);
 
+    // validate the faces before building the mesh (which expects valid polygons)
+
     int faceSizeOffset = 0;
 
     for (uint32_t i = 0; i < numFaces; ++i) {
 
-        std::vector<mcut::vd_t> faceVertices;
-        int numFaceVertices = 3; // triangle
-
-        numFaceVertices = ((uint32_t*)pFaceSizes)[i];
+        const int numFaceVertices = ((uint32_t*)pFaceSizes)[i];
 
         if (numFaceVertices < 3) {
             result = McResult::MC_INVALID_VALUE;
@@ -390,14 +652,13 @@ McResult indexArrayMeshToHalfedgeMesh(
             }
         }
 
-        faceVertices.reserve(numFaceVertices);
+        const uint32_t* faceIndices = ((uint32_t*)pFaceIndices) + faceSizeOffset;
 
         for (int j = 0; j < numFaceVertices; ++j) {
 
-            uint32_t idx = ((uint32_t*)pFaceIndices)[faceSizeOffset + j];
-            std::map<uint32_t, mcut::vd_t>::const_iterator fIter = vmap.find(idx);
+            const uint32_t idx = faceIndices[j];
 
-            if (fIter == vmap.cend()) {
+            if (idx >= numVertices) {
 
                 result = McResult::MC_INVALID_VALUE;
 
@@ -408,9 +669,7 @@ McResult indexArrayMeshToHalfedgeMesh(
                 }
             }
 
-            const mcut::vertex_descriptor_t descr = fIter->second; //vmap[*fIter.first];
-
-            const bool isDuplicate = std::find(faceVertices.cbegin(), faceVertices.cend(), descr) != faceVertices.cend();
+            const bool isDuplicate = std::find(faceIndices, faceIndices + j, idx) != faceIndices + j;
 
             if (isDuplicate) {
                 result = McResult::MC_INVALID_VALUE;
@@ -421,24 +680,28 @@ McResult indexArrayMeshToHalfedgeMesh(
                     return result;
                 }
             }
-
-            faceVertices.push_back(descr);
         }
 
-        mcut::fd_t fd = halfedgeMesh.add_face(faceVertices);
+        faceSizeOffset += numFaceVertices;
+    }
 
-        if (fd == mcut::mesh_t::null_face()) {
+    std::vector<std::pair<mcut::vd_t, mcut::vd_t>> nonManifoldEdges;
+    const bool isManifold = halfedgeMesh.build_from_arrays(vertices, pFaceIndices, pFaceSizes, numFaces, &nonManifoldEdges);
 
-            result = McResult::MC_INVALID_VALUE;
-            if (result != McResult::MC_NO_ERROR) {
-                ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "invalid vertices on face - " + std::to_string(i));
+    if (!isManifold) {
+        result = McResult::MC_INVALID_VALUE;
 
-                return result;
+        if (result != McResult::MC_NO_ERROR) {
+            std::string msg = "found " + std::to_string(nonManifoldEdges.size()) + " non-manifold edge(s) -";
+            for (std::vector<std::pair<mcut::vd_t, mcut::vd_t>>::const_iterator i = nonManifoldEdges.cbegin(); i != nonManifoldEdges.cend(); ++i) {
+                msg += " (" + std::to_string(i->first) + ", " + std::to_string(i->second) + ")";
             }
-        }
+            ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, msg);
 
-        faceSizeOffset += numFaceVertices;
+            return result;
+        }
     }
+
     return result;
 }
 
@@ -511,8 +774,9 @@ McFragmentLocation convert(const mcut::connected_component_location_t& v)
 }
 
 McResult halfedgeMeshToIndexArrayMesh(
-    const std::unique_ptr<McDispatchContextInternal>& ctxtPtr,
+    McDispatchContextInternal* ctxtPtr,
     IndexArrayMesh& indexArrayMesh,
+    const McAllocator& allocator,
     const mcut::output_mesh_info_t& halfedgeMeshInfo,
     const std::map<mcut::vd_t, mcut::math::vec3>& addedFpPartitioningVerticesOnCorrespondingInputSrcMesh,
     const std::map<mcut::fd_t, mcut::fd_t>& fpPartitionChildFaceToCorrespondingInputSrcMeshFace,
@@ -521,11 +785,17 @@ McResult halfedgeMeshToIndexArrayMesh(
     const int userSrcMeshVertexCount,
     const int userSrcMeshFaceCount,
     const int internalSrcMeshVertexCount,
-    const int internalSrcMeshFaceCount)
+    const int internalSrcMeshFaceCount,
+    const bool outputFloatVertices)
 {
     McResult result = McResult::MC_NO_ERROR;
 
-    std::map<mcut::vd_t, uint32_t> vmap;
+    const mcut::mesh_t& mesh = halfedgeMeshInfo.mesh;
+
+    // NOTE: each element type is converted in one sweep over the mesh. Output vertex indices are
+    // looked up in "vmap", which is indexed by descriptor, and the data maps (which are ordered
+    // by descriptor, like the element iterators) are walked alongside the elements.
+    std::vector<uint32_t> vmap(mesh.number_of_internal_vertices(), UINT32_MAX);
     //
     // vertices
     //
@@ -534,35 +804,60 @@ McResult halfedgeMeshToIndexArrayMesh(
     // number of vertices is the same irrespective of whether we are dealing with a
     // triangulated mesh instance or not. Thus, only one set of vertices is stored
 
-    indexArrayMesh.numVertices = halfedgeMeshInfo.mesh.number_of_vertices();
+    indexArrayMesh.numVertices = mesh.number_of_vertices();
 
     MCUT_ASSERT(indexArrayMesh.numVertices >= 3);
 
-    indexArrayMesh.pVertices = std::unique_ptr<mcut::math::real_number_t[]>(new mcut::math::real_number_t[(size_t)indexArrayMesh.numVertices * 3u]);
+    if (outputFloatVertices) {
+        // i.e. no array of internal numbers is materialised
+        indexArrayMesh.pVerticesFloat = allocateOutputArray<float>(allocator, (size_t)indexArrayMesh.numVertices * 3u);
+    } else {
+#if defined(MCUT_WITH_ARBITRARY_PRECISION_NUMBERS)
+        // NOTE: arbitrary-precision numbers are not placed in user-allocated memory
+        indexArrayMesh.pVertices = allocateOutputArray<mcut::math::real_number_t>(McAllocator(), (size_t)indexArrayMesh.numVertices * 3u);
+#else
+        indexArrayMesh.pVertices = allocateOutputArray<mcut::math::real_number_t>(allocator, (size_t)indexArrayMesh.numVertices * 3u);
+#endif // #if defined(MCUT_WITH_ARBITRARY_PRECISION_NUMBERS)
+    }
     if (!halfedgeMeshInfo.data_maps.vertex_map.empty()) {
-        indexArrayMesh.pVertexMapIndices = std::unique_ptr<uint32_t[]>(new uint32_t[(size_t)indexArrayMesh.numVertices]);
+        indexArrayMesh.pVertexMapIndices = allocateOutputArray<uint32_t>(allocator, (size_t)indexArrayMesh.numVertices);
     }
 
-    for (uint32_t i = 0; i < indexArrayMesh.numVertices; ++i) {
+    std::map<mcut::vd_t, mcut::vd_t>::const_iterator vertexMapIter = halfedgeMeshInfo.data_maps.vertex_map.cbegin();
+    uint32_t vertexIndex = 0;
+
+    for (mcut::mesh_t::vertex_iterator_t vIter = mesh.vertices_begin(); vIter != mesh.vertices_end(); ++vIter, ++vertexIndex) {
 
-        mcut::mesh_t::vertex_iterator_t vIter = halfedgeMeshInfo.mesh.vertices_begin();
-        std::advance(vIter, i);
-        const mcut::math::vec3& point = halfedgeMeshInfo.mesh.vertex(*vIter);
+        const mcut::math::vec3& point = mesh.vertex(*vIter);
 
-        indexArrayMesh.pVertices[((size_t)i * 3u) + 0u] = point.x();
-        indexArrayMesh.pVertices[((size_t)i * 3u) + 1u] = point.y();
-        indexArrayMesh.pVertices[((size_t)i * 3u) + 2u] = point.z();
+        if (outputFloatVertices) {
+            for (int j = 0; j < 3; ++j) {
+#if !defined(MCUT_WITH_ARBITRARY_PRECISION_NUMBERS)
+                indexArrayMesh.pVerticesFloat[((size_t)vertexIndex * 3u) + j] = static_cast<float>(point[j]);
+#else
+                indexArrayMesh.pVerticesFloat[((size_t)vertexIndex * 3u) + j] = static_cast<float>(point[j].to_double());
+#endif
+            }
+        } else {
+            indexArrayMesh.pVertices[((size_t)vertexIndex * 3u) + 0u] = point.x();
+            indexArrayMesh.pVertices[((size_t)vertexIndex * 3u) + 1u] = point.y();
+            indexArrayMesh.pVertices[((size_t)vertexIndex * 3u) + 2u] = point.z();
+        }
 
         //std::cout << indexArrayMesh.pVertices[(i * 3u) + 0u] << " " << indexArrayMesh.pVertices[(i * 3u) + 1u] << " " << indexArrayMesh.pVertices[(i * 3u) + 2u] << std::endl;
 
-        vmap[*vIter] = i;
+        vmap[*vIter] = vertexIndex;
 
         if (!halfedgeMeshInfo.data_maps.vertex_map.empty()) {
-            MCUT_ASSERT(halfedgeMeshInfo.data_maps.vertex_map.count(*vIter) == 1);
+            while (vertexMapIter != halfedgeMeshInfo.data_maps.vertex_map.cend() && vertexMapIter->first < *vIter) {
+                ++vertexMapIter;
+            }
+
+            MCUT_ASSERT(vertexMapIter != halfedgeMeshInfo.data_maps.vertex_map.cend() && vertexMapIter->first == *vIter);
 
             // Here we use whatever value was assigned to the current vertex by the kernel.
             // Vertices that are polygon intersection points have a value of uint_max i.e. null_vertex().
-            uint32_t internalInputMeshVertexDescr = halfedgeMeshInfo.data_maps.vertex_map.at(*vIter);
+            uint32_t internalInputMeshVertexDescr = vertexMapIter->second;
             // We use the same default value as that used by the kernel for intersection
             // points (intersection points at mapped to uint_max i.e. null_vertex())
             uint32_t userInputMeshVertexDescr = UINT32_MAX;
@@ -612,11 +907,11 @@ McResult halfedgeMeshToIndexArrayMesh(
                 }
             }
 
-            indexArrayMesh.pVertexMapIndices[i] = userInputMeshVertexDescr;
+            indexArrayMesh.pVertexMapIndices[vertexIndex] = userInputMeshVertexDescr;
         }
     }
 
-    MCUT_ASSERT(!vmap.empty());
+    MCUT_ASSERT(vertexIndex == indexArrayMesh.numVertices);
 
     // create array of seam vertices
 
@@ -624,9 +919,11 @@ McResult halfedgeMeshToIndexArrayMesh(
     indexArrayMesh.numSeamVertexIndices = numSeamVertexIndices;
     if (indexArrayMesh.numSeamVertexIndices > 0u) {
 
-        indexArrayMesh.pSeamVertexIndices = std::unique_ptr<uint32_t[]>(new uint32_t[numSeamVertexIndices]);
+        indexArrayMesh.pSeamVertexIndices = allocateOutputArray<uint32_t>(allocator, numSeamVertexIndices);
         for (uint32_t i = 0; i < numSeamVertexIndices; ++i) {
-            indexArrayMesh.pSeamVertexIndices[i] = halfedgeMeshInfo.seam_vertices[i];
+            const mcut::vd_t vd = halfedgeMeshInfo.seam_vertices[i];
+            MCUT_ASSERT((size_t)vd < vmap.size() && vmap[vd] != UINT32_MAX);
+            indexArrayMesh.pSeamVertexIndices[i] = vmap[vd];
         }
     }
 
@@ -635,39 +932,42 @@ McResult halfedgeMeshToIndexArrayMesh(
     //
 
     // NOTE: faces can be zero if mesh is a cut-path mesh
-    indexArrayMesh.numFaces = halfedgeMeshInfo.mesh.number_of_faces();
+    indexArrayMesh.numFaces = mesh.number_of_faces();
 
     MCUT_ASSERT(indexArrayMesh.numFaces > 0);
 
-    indexArrayMesh.pFaceSizes = std::unique_ptr<uint32_t[]>(new uint32_t[indexArrayMesh.numFaces]);
+    indexArrayMesh.pFaceSizes = allocateOutputArray<uint32_t>(allocator, indexArrayMesh.numFaces);
     if (!halfedgeMeshInfo.data_maps.face_map.empty()) {
-        indexArrayMesh.pFaceMapIndices = std::unique_ptr<uint32_t[]>(new uint32_t[indexArrayMesh.numFaces]);
+        indexArrayMesh.pFaceMapIndices = allocateOutputArray<uint32_t>(allocator, indexArrayMesh.numFaces);
     }
     indexArrayMesh.numFaceIndices = 0;
 
-    std::vector<std::vector<mcut::vd_t>> gatheredFaces;
-    for (mcut::mesh_t::face_iterator_t i = halfedgeMeshInfo.mesh.faces_begin(); i != halfedgeMeshInfo.mesh.faces_end(); ++i) {
+    // face sizes and face map (the number of face indices is needed to allocate the index array)
+    std::map<mcut::fd_t, mcut::fd_t>::const_iterator faceMapIter = halfedgeMeshInfo.data_maps.face_map.cbegin();
+    uint32_t faceIndex = 0;
 
-        std::vector<mcut::vd_t> face;
-        std::vector<mcut::vd_t> vertices_around_face = halfedgeMeshInfo.mesh.get_vertices_around_face(*i);
+    for (mcut::mesh_t::face_iterator_t i = mesh.faces_begin(); i != mesh.faces_end(); ++i, ++faceIndex) {
 
-        for (std::vector<mcut::vd_t>::const_iterator iter = vertices_around_face.cbegin();
-             iter != vertices_around_face.cend();
-             ++iter) {
-            MCUT_ASSERT(*iter != mcut::mesh_t::null_vertex());
+        const size_t faceSize = mesh.get_halfedges_around_face(*i).size();
 
-            face.push_back(*iter);
+        if (static_cast<std::size_t>(std::numeric_limits<uint32_t>::max()) < faceSize) {
+            ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH,
+                std::string("number of vertices in face (") + std::to_string(faceSize) + ") exceeds maximum (" + std::to_string(std::numeric_limits<uint32_t>::max()) + ")");
+            result = McResult::MC_INVALID_VALUE;
+            return result;
         }
 
-        gatheredFaces.emplace_back(face);
-
-        indexArrayMesh.numFaceIndices += (int)face.size();
+        indexArrayMesh.pFaceSizes[faceIndex] = static_cast<uint32_t>(faceSize);
+        indexArrayMesh.numFaceIndices += static_cast<uint32_t>(faceSize);
 
         if (!halfedgeMeshInfo.data_maps.face_map.empty()) {
-            MCUT_ASSERT(halfedgeMeshInfo.data_maps.face_map.count(*i) == 1);
-            //const size_t idx = std::distance(halfedgeMeshInfo.mesh.faces_begin(), i);
+            while (faceMapIter != halfedgeMeshInfo.data_maps.face_map.cend() && faceMapIter->first < *i) {
+                ++faceMapIter;
+            }
+
+            MCUT_ASSERT(faceMapIter != halfedgeMeshInfo.data_maps.face_map.cend() && faceMapIter->first == *i);
 
-            uint32_t internalInputMeshFaceDescr = (uint32_t)halfedgeMeshInfo.data_maps.face_map.at(*i);
+            uint32_t internalInputMeshFaceDescr = (uint32_t)faceMapIter->second;
             uint32_t userInputMeshFaceDescr = INT32_MAX;
 
             //bool faceExistsDueToFacePartition = false;
@@ -697,104 +997,178 @@ McResult halfedgeMeshToIndexArrayMesh(
 
             MCUT_ASSERT(userInputMeshFaceDescr != INT32_MAX);
 
-#if 0
-            if (!faceExistsDueToFacePartition) { // user-mesh vertex
-
-                MCUT_ASSERT(internalSrcMeshFaceCount > 0);
-
-                if ((int)internalInputMeshFaceDescr >= internalSrcMeshFaceCount) // is it a cut-mesh face discriptor ..?
-                {
-                    MCUT_ASSERT(internalSrcMeshFaceCount >= userSrcMeshFaceCount);
-                    const int offset_descrepancy = (internalSrcMeshFaceCount - userSrcMeshFaceCount);
-                    userInputMeshFaceDescr = (internalInputMeshFaceDescr - offset_descrepancy); // ensure that we offset using number of user mesh vertices
-                }
-            }
-#endif
-#if 0
-            std::map<mcut::fd_t, mcut::fd_t>::const_iterator fiter = fpPartitionChildFaceToCorrespondingInputMeshFace.find(mcut::fd_t(value));
-
-            bool faceAddedDueToFacePartitioning = (fiter != fpPartitionChildFaceToCorrespondingInputMeshFace.cend());
-            if (faceAddedDueToFacePartitioning) {
-                value = fiter->second;
-            }
-
-            MCUT_ASSERT(value != UINT32_MAX);
-
-            MCUT_ASSERT(internalSrcMeshFaceCount > 0);
-            if ((int)value >= internalSrcMeshFaceCount) // cut-mesh face ..?
-            {
-                MCUT_ASSERT(internalSrcMeshFaceCount >= userSrcMeshFaceCount);
-                const int offset_descrepancy = (internalSrcMeshFaceCount - userSrcMeshFaceCount);
-                value = (value - offset_descrepancy); // ensure that we offset using number of user mesh faces
-            }
-#endif
-            indexArrayMesh.pFaceMapIndices[(uint32_t)(*i)] = userInputMeshFaceDescr;
+            indexArrayMesh.pFaceMapIndices[faceIndex] = userInputMeshFaceDescr;
         }
     }
 
     // sanity check
 
-    MCUT_ASSERT(gatheredFaces.size() == indexArrayMesh.numFaces);
-
-    indexArrayMesh.pFaceIndices = std::unique_ptr<uint32_t[]>(new uint32_t[indexArrayMesh.numFaceIndices]);
+    MCUT_ASSERT(faceIndex == indexArrayMesh.numFaces);
 
-    int faceOffset = 0;
+    indexArrayMesh.pFaceIndices = allocateOutputArray<uint32_t>(allocator, indexArrayMesh.numFaceIndices);
 
-    for (int i = 0; i < (int)gatheredFaces.size(); ++i) {
-        const std::vector<mcut::vd_t>& face = gatheredFaces[i];
-        if (static_cast<std::size_t>(std::numeric_limits<uint32_t>::max()) < face.size()) {
-            ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH,
-                std::string("number of vertices in face (") + std::to_string(face.size()) + ") exceeds maximum (" + std::to_string(std::numeric_limits<uint32_t>::max()) + ")");
-            result = McResult::MC_INVALID_VALUE;
-            return result;
-        }
+    size_t faceOffset = 0;
 
-        indexArrayMesh.pFaceSizes[i] = static_cast<uint32_t>(face.size());
+    for (mcut::mesh_t::face_iterator_t i = mesh.faces_begin(); i != mesh.faces_end(); ++i) {
+        const std::vector<mcut::hd_t>& halfedgesAroundFace = mesh.get_halfedges_around_face(*i);
 
-        for (int j = 0; j < (int)face.size(); ++j) {
-            const mcut::vd_t vd = face[j];
+        for (std::vector<mcut::hd_t>::const_iterator h = halfedgesAroundFace.cbegin(); h != halfedgesAroundFace.cend(); ++h) {
+            const mcut::vd_t vd = mesh.target(*h);
+            MCUT_ASSERT(vd != mcut::mesh_t::null_vertex());
+            MCUT_ASSERT(vmap[vd] != UINT32_MAX);
 
-            indexArrayMesh.pFaceIndices[(size_t)faceOffset + j] = vmap[vd];
+            indexArrayMesh.pFaceIndices[faceOffset++] = vmap[vd];
         }
-        faceOffset += static_cast<int>(face.size());
     }
-    gatheredFaces.clear();
+
+    MCUT_ASSERT(faceOffset == indexArrayMesh.numFaceIndices);
 
     //
     // edges
     //
 
-    indexArrayMesh.numEdgeIndices = halfedgeMeshInfo.mesh.number_of_edges() * 2;
+    indexArrayMesh.numEdgeIndices = mesh.number_of_edges() * 2;
 
     MCUT_ASSERT(indexArrayMesh.numEdgeIndices > 0);
 
-    std::vector<std::pair<mcut::vd_t, mcut::vd_t>> gatheredEdges;
+    indexArrayMesh.pEdges = allocateOutputArray<uint32_t>(allocator, indexArrayMesh.numEdgeIndices);
+
+    size_t edgeOffset = 0;
 
-    for (mcut::mesh_t::edge_iterator_t i = halfedgeMeshInfo.mesh.edges_begin(); i != halfedgeMeshInfo.mesh.edges_end(); ++i) {
+    for (mcut::mesh_t::edge_iterator_t i = mesh.edges_begin(); i != mesh.edges_end(); ++i) {
 
-        mcut::vd_t v0 = halfedgeMeshInfo.mesh.vertex(*i, 0);
-        mcut::vd_t v1 = halfedgeMeshInfo.mesh.vertex(*i, 1);
+        const mcut::vd_t v0 = mesh.vertex(*i, 0);
+        const mcut::vd_t v1 = mesh.vertex(*i, 1);
 
-        gatheredEdges.emplace_back(v0, v1);
+        MCUT_ASSERT(vmap[v0] != UINT32_MAX);
+        indexArrayMesh.pEdges[edgeOffset++] = vmap[v0];
+        MCUT_ASSERT(vmap[v1] != UINT32_MAX);
+        indexArrayMesh.pEdges[edgeOffset++] = vmap[v1];
     }
 
     // sanity check
 
-    MCUT_ASSERT(gatheredEdges.size() == indexArrayMesh.numEdgeIndices / 2);
+    MCUT_ASSERT(edgeOffset == indexArrayMesh.numEdgeIndices);
+
+    return result;
+}
+
+// convert a connected component into the format that is returned to the user, if it has not been converted yet
+McResult convertConnComp(
+    McDispatchContextInternal* ctxtPtr,
+    McConnCompBase& connComp)
+{
+    McResult result = McResult::MC_NO_ERROR;
+
+    std::lock_guard<std::mutex> lock(connComp.conversionMutex);
+
+    if (connComp.kernelMesh == nullptr) {
+        return result; // already converted
+    }
+
+    const DispatchDataMaps& dataMaps = *connComp.dataMaps;
+
+    try {
+        result = halfedgeMeshToIndexArrayMesh(ctxtPtr, connComp.indexArrayMesh, ctxtPtr->connCompAllocator, *connComp.kernelMesh,
+            dataMaps.addedFpPartitioningVerticesOnSrcMesh, dataMaps.fpPartitionChildFaceToInputSrcMeshFace,
+            dataMaps.addedFpPartitioningVerticesOnCutMesh, dataMaps.fpPartitionChildFaceToInputCutMeshFace,
+            dataMaps.userSrcMeshVertexCount, dataMaps.userSrcMeshFaceCount, dataMaps.internalSrcMeshVertexCount, dataMaps.internalSrcMeshFaceCount,
+            dataMaps.outputFloatVertices);
+    } catch (const std::bad_alloc&) {
+        ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "failed to allocate connected component data");
+        connComp.indexArrayMesh = IndexArrayMesh(); // free what was allocated
+        result = McResult::MC_OUT_OF_MEMORY;
+    }
+
+    if (result == McResult::MC_NO_ERROR) {
+        connComp.kernelMesh.reset();
+        connComp.dataMaps.reset();
+    }
+
+    return result;
+}
+
+// triangulate the faces of a (converted) connected component, if they have not been triangulated yet
+McResult triangulateConnComp(
+    McDispatchContextInternal* ctxtPtr,
+    McConnCompBase& connComp)
+{
+    McResult result = McResult::MC_NO_ERROR;
+
+    std::lock_guard<std::mutex> lock(connComp.conversionMutex);
+
+    IndexArrayMesh& indexArrayMesh = connComp.indexArrayMesh;
+
+    if (indexArrayMesh.isTriangulated) {
+        return result;
+    }
+
+    // a face with N vertices is always split into N-2 triangles
+    const uint32_t numTriangles = indexArrayMesh.numFaceIndices - (2 * indexArrayMesh.numFaces);
+    const bool haveFaceMap = indexArrayMesh.pFaceMapIndices != nullptr;
+
+    try {
+        indexArrayMesh.pFaceTriangulation = allocateOutputArray<uint32_t>(ctxtPtr->connCompAllocator, (size_t)numTriangles * 3);
+
+        if (haveFaceMap) {
+            indexArrayMesh.pFaceTriangulationMap = allocateOutputArray<uint32_t>(ctxtPtr->connCompAllocator, numTriangles);
+        }
+    } catch (const std::bad_alloc&) {
+        ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "failed to allocate connected component data");
+        indexArrayMesh.pFaceTriangulation.reset();
+        indexArrayMesh.pFaceTriangulationMap.reset();
+        result = McResult::MC_OUT_OF_MEMORY;
+        return result;
+    }
 
-    indexArrayMesh.pEdges = std::unique_ptr<uint32_t[]>(new uint32_t[indexArrayMesh.numEdgeIndices]);
+    std::vector<mcut::math::vec3> faceVertices;
+    std::vector<int> faceTriangleIndices; // local to the face
+    uint32_t faceIndexOffset = 0;
+    uint32_t triangleIndexOffset = 0;
 
-    for (uint32_t i = 0; i < (uint32_t)gatheredEdges.size(); ++i) {
-        const std::pair<mcut::vd_t, mcut::vd_t>& edge = gatheredEdges[i];
-        mcut::vd_t v0 = edge.first;
-        mcut::vd_t v1 = edge.second;
+    for (uint32_t f = 0; f < indexArrayMesh.numFaces; ++f) {
+        const uint32_t faceSize = indexArrayMesh.pFaceSizes[f];
+        const uint32_t* pFace = indexArrayMesh.pFaceIndices.get() + faceIndexOffset;
 
-        MCUT_ASSERT(vmap.find(v0) != vmap.cend());
-        indexArrayMesh.pEdges[((size_t)i * 2u) + 0u] = vmap[v0];
-        MCUT_ASSERT(vmap.find(v1) != vmap.cend());
-        indexArrayMesh.pEdges[((size_t)i * 2u) + 1u] = vmap[v1];
+        faceVertices.resize(faceSize);
+
+        for (uint32_t i = 0; i < faceSize; ++i) {
+            const size_t vertexOffset = (size_t)pFace[i] * 3;
+
+            if (indexArrayMesh.pVertices != nullptr) {
+                const mcut::math::real_number_t* pVertex = indexArrayMesh.pVertices.get() + vertexOffset;
+                faceVertices[i] = mcut::math::vec3(pVertex[0], pVertex[1], pVertex[2]);
+            } else {
+                const float* pVertex = indexArrayMesh.pVerticesFloat.get() + vertexOffset;
+                faceVertices[i] = mcut::math::vec3(pVertex[0], pVertex[1], pVertex[2]);
+            }
+        }
+
+        faceTriangleIndices.clear();
+        mcut::geom::triangulate_polygon(faceTriangleIndices, faceVertices.data(), (int)faceSize);
+
+        MCUT_ASSERT(faceTriangleIndices.size() == (size_t)(faceSize - 2) * 3);
+
+        for (std::vector<int>::const_iterator i = faceTriangleIndices.cbegin(); i != faceTriangleIndices.cend(); ++i) {
+            indexArrayMesh.pFaceTriangulation[triangleIndexOffset++] = pFace[*i];
+        }
+
+        if (haveFaceMap) {
+            const uint32_t firstTriangle = (triangleIndexOffset / 3) - (faceSize - 2);
+
+            for (uint32_t t = firstTriangle; t < (triangleIndexOffset / 3); ++t) {
+                indexArrayMesh.pFaceTriangulationMap[t] = indexArrayMesh.pFaceMapIndices[f];
+            }
+        }
+
+        faceIndexOffset += faceSize;
     }
 
+    MCUT_ASSERT(triangleIndexOffset == numTriangles * 3);
+
+    indexArrayMesh.numFaceTriangulationIndices = triangleIndexOffset;
+    indexArrayMesh.isTriangulated = true;
+
     return result;
 }
 
@@ -802,15 +1176,18 @@ MCAPI_ATTR McResult MCAPI_CALL mcSetRoundingMode(McContext context, McFlags rmod
 {
     McResult result = MC_NO_ERROR;
 
-    auto ctxtIter = gDispatchContexts.find(context);
+    McDispatchContextInternal* ctxtEntry = findDispatchContext(context);
 
-    if (ctxtIter == gDispatchContexts.cend()) {
+    if (ctxtEntry == nullptr) {
         std::fprintf(stderr, "error: context undefined");
         result = McResult::MC_INVALID_VALUE;
         return result;
     }
 
-    std::unique_ptr<McDispatchContextInternal>& ctxtPtr = ctxtIter->second;
+    McDispatchContextInternal* ctxtPtr = ctxtEntry;
+
+    // the enqueued dispatches use the current rounding mode
+    ctxtPtr->commands.finish();
 
     McRoundingModeFlags f = static_cast<McRoundingModeFlags>(rmode);
     bool isvalid = f == MC_ROUNDING_MODE_TO_NEAREST || //
@@ -837,15 +1214,15 @@ MCAPI_ATTR McResult MCAPI_CALL mcGetRoundingMode(McContext context, McFlags* rmo
         return result;
     }
 
-    auto ctxtIter = gDispatchContexts.find(context);
+    McDispatchContextInternal* ctxtEntry = findDispatchContext(context);
 
-    if (ctxtIter == gDispatchContexts.cend()) {
+    if (ctxtEntry == nullptr) {
         std::fprintf(stderr, "err: context undefined");
         result = McResult::MC_INVALID_VALUE;
         return result;
     }
 
-    const std::unique_ptr<McDispatchContextInternal>& ctxtPtr = ctxtIter->second;
+    McDispatchContextInternal* ctxtPtr = ctxtEntry;
 
     *rmode = ctxtPtr->roundingMode;
 
@@ -862,15 +1239,18 @@ MCAPI_ATTR McResult MCAPI_CALL mcSetPrecision(McContext context, uint64_t prec)
         return result;
     }
 
-    auto ctxtIter = gDispatchContexts.find(context);
+    McDispatchContextInternal* ctxtEntry = findDispatchContext(context);
 
-    if (ctxtIter == gDispatchContexts.cend()) {
+    if (ctxtEntry == nullptr) {
         std::fprintf(stderr, "err: context undefined");
         result = McResult::MC_INVALID_VALUE;
         return result;
     }
 
-    const std::unique_ptr<McDispatchContextInternal>& ctxtPtr = ctxtIter->second;
+    McDispatchContextInternal* ctxtPtr = ctxtEntry;
+
+    // the enqueued dispatches use the current precision
+    ctxtPtr->commands.finish();
 
     if (prec < McDispatchContextInternal::minPrecision || prec > McDispatchContextInternal::maxPrecision) {
         ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_LOW, "out of range precision");
@@ -887,21 +1267,26 @@ MCAPI_ATTR McResult MCAPI_CALL mcGetPrecision(McContext context, uint64_t* prec)
 {
     McResult result = MC_NO_ERROR;
 
-    auto ctxtIter = gDispatchContexts.find(context);
+    McDispatchContextInternal* ctxtEntry = findDispatchContext(context);
 
-    if (ctxtIter == gDispatchContexts.cend()) {
+    if (ctxtEntry == nullptr) {
         std::fprintf(stderr, "err: context undefined");
         result = McResult::MC_INVALID_VALUE;
         return result;
     }
 
-    const std::unique_ptr<McDispatchContextInternal>& ctxtPtr = ctxtIter->second;
+    McDispatchContextInternal* ctxtPtr = ctxtEntry;
     *prec = ctxtPtr->precision;
 
     return result;
 }
 
 MCAPI_ATTR McResult MCAPI_CALL mcCreateContext(McContext* pContext, McFlags flags)
+{
+    return mcCreateContextWithHelpers(pContext, flags, mcut::thread_pool::get_default_helper_thread_count());
+}
+
+MCAPI_ATTR McResult MCAPI_CALL mcCreateContextWithHelpers(McContext* pContext, McFlags flags, uint32_t helperThreadCount)
 {
     McResult result = McResult::MC_NO_ERROR;
 
@@ -913,7 +1298,15 @@ MCAPI_ATTR McResult MCAPI_CALL mcCreateContext(McContext* pContext, McFlags flag
 
     std::unique_ptr<McDispatchContextInternal> ctxt = std::unique_ptr<McDispatchContextInternal>(new McDispatchContextInternal);
     ctxt->flags = flags;
+    ctxt->scheduler = std::unique_ptr<mcut::thread_pool>(new mcut::thread_pool(helperThreadCount));
     McContext handle = reinterpret_cast<McContext>(ctxt.get());
+
+    // initialize the globals used by the exact geometric predicates before the first context is
+    // registered, since dispatches that run on other contexts read them without synchronization
+    static std::once_flag exactinitFlag;
+    std::call_once(exactinitFlag, ::exactinit);
+
+    std::lock_guard<mcut::shared_mutex> lock(gDispatchContextsMutex);
     auto ret = gDispatchContexts.emplace(handle, std::move(ctxt));
     if (ret.second == false) {
         std::fprintf(stderr, "err: failed to create context\n");
@@ -922,8 +1315,6 @@ MCAPI_ATTR McResult MCAPI_CALL mcCreateContext(McContext* pContext, McFlags flag
     }
     *pContext = ret.first->first;
 
-    ::exactinit();
-
     return result;
 }
 
@@ -937,15 +1328,18 @@ MCAPI_ATTR McResult MCAPI_CALL mcDebugMessageCallback(McContext pContext, pfn_mc
         return result;
     }
 
-    auto ctxtIter = gDispatchContexts.find(pContext);
+    McDispatchContextInternal* ctxtEntry = findDispatchContext(pContext);
 
-    if (ctxtIter == gDispatchContexts.cend()) {
+    if (ctxtEntry == nullptr) {
         std::fprintf(stderr, "err: context undefined");
         result = McResult::MC_INVALID_VALUE;
         return result;
     }
 
-    const std::unique_ptr<McDispatchContextInternal>& ctxtPtr = ctxtIter->second;
+    McDispatchContextInternal* ctxtPtr = ctxtEntry;
+
+    // the enqueued dispatches log via the current callback
+    ctxtPtr->commands.finish();
 
     if (cb == nullptr) {
         ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_LOW, "callback parameter NULL");
@@ -959,6 +1353,66 @@ MCAPI_ATTR McResult MCAPI_CALL mcDebugMessageCallback(McContext pContext, pfn_mc
     return result;
 }
 
+MCAPI_ATTR McResult MCAPI_CALL mcSetConnectedComponentAllocator(
+    McContext context,
+    pfn_mcAllocate_CALLBACK pfnAllocate,
+    pfn_mcFree_CALLBACK pfnFree,
+    const void* userParam)
+{
+    McResult result = McResult::MC_NO_ERROR;
+
+    McDispatchContextInternal* ctxtEntry = findDispatchContext(context);
+
+    if (ctxtEntry == nullptr) {
+        std::fprintf(stderr, "err: context undefined");
+        result = McResult::MC_INVALID_VALUE;
+        return result;
+    }
+
+    McDispatchContextInternal* ctxtPtr = ctxtEntry;
+
+    // the enqueued dispatches allocate with the current allocator
+    ctxtPtr->commands.finish();
+
+    if ((pfnAllocate == nullptr) != (pfnFree == nullptr)) {
+        ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "allocation and deallocation functions must both be specified (or both NULL)");
+        result = McResult::MC_INVALID_VALUE;
+        return result;
+    }
+
+    ctxtPtr->connCompAllocator.pfnAllocate = pfnAllocate;
+    ctxtPtr->connCompAllocator.pfnFree = pfnFree;
+    ctxtPtr->connCompAllocator.userParam = userParam;
+
+    return result;
+}
+
+MCAPI_ATTR McResult MCAPI_CALL mcSetStitchingCallback(
+    McContext context,
+    pfn_mcStitching_CALLBACK pfnCallback,
+    const void* userParam)
+{
+    McResult result = McResult::MC_NO_ERROR;
+
+    McDispatchContextInternal* ctxtEntry = findDispatchContext(context);
+
+    if (ctxtEntry == nullptr) {
+        std::fprintf(stderr, "err: context undefined");
+        result = McResult::MC_INVALID_VALUE;
+        return result;
+    }
+
+    McDispatchContextInternal* ctxtPtr = ctxtEntry;
+
+    // the enqueued dispatches use the current callback
+    ctxtPtr->commands.finish();
+
+    ctxtPtr->stitchingCallback = pfnCallback;
+    ctxtPtr->stitchingCallbackUserParam = userParam;
+
+    return result;
+}
+
 // find the number of trailing zeros in v
 // http://graphics.stanford.edu/~seander/bithacks.html#ZerosOnRightLinear
 int trailing_zeroes(unsigned int v)
@@ -1003,15 +1457,18 @@ MCAPI_ATTR McResult MCAPI_CALL mcDebugMessageControl(McContext pContext, McDebug
 {
     McResult result = McResult::MC_NO_ERROR;
 
-    auto ctxtIter = gDispatchContexts.find(pContext);
+    McDispatchContextInternal* ctxtEntry = findDispatchContext(pContext);
 
-    if (ctxtIter == gDispatchContexts.cend()) {
+    if (ctxtEntry == nullptr) {
         std::fprintf(stderr, "err: context undefined");
         result = McResult::MC_INVALID_VALUE;
         return result;
     }
 
-    const std::unique_ptr<McDispatchContextInternal>& ctxtPtr = ctxtIter->second;
+    McDispatchContextInternal* ctxtPtr = ctxtEntry;
+
+    // the enqueued dispatches filter their log messages with the current settings
+    ctxtPtr->commands.finish();
 
     // check source parameter
     bool sourceParamValid = source == MC_DEBUG_SOURCE_API || //
@@ -1081,15 +1538,15 @@ MCAPI_ATTR McResult MCAPI_CALL mcGetInfo(const McContext context, McFlags info,
 {
     McResult result = McResult::MC_NO_ERROR;
 
-    auto ctxtIter = gDispatchContexts.find(context);
+    McDispatchContextInternal* ctxtEntry = findDispatchContext(context);
 
-    if (ctxtIter == gDispatchContexts.cend()) {
+    if (ctxtEntry == nullptr) {
         std::fprintf(stderr, "err: invalid context\n");
         result = McResult::MC_INVALID_VALUE;
         return result;
     }
 
-    const std::unique_ptr<McDispatchContextInternal>& ctxtPtr = ctxtIter->second;
+    McDispatchContextInternal* ctxtPtr = ctxtEntry;
 
     if (bytes != 0 && pMem == nullptr) {
         ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "null parameter");
@@ -1158,6 +1615,19 @@ MCAPI_ATTR McResult MCAPI_CALL mcGetInfo(const McContext context, McFlags info,
             memcpy(pMem, reinterpret_cast<const void*>(&McDispatchContextInternal::minPrecision), bytes);
         }
         break;
+    case MC_CONTEXT_HELPER_THREAD_COUNT: {
+        const uint32_t helperThreadCount = ctxtPtr->scheduler->get_helper_thread_count();
+        if (pMem == nullptr) {
+            *pNumBytes = sizeof(helperThreadCount);
+        } else {
+            if (bytes > sizeof(helperThreadCount)) {
+                ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "out of bounds memory access");
+                result = McResult::MC_INVALID_VALUE;
+                return result;
+            }
+            memcpy(pMem, reinterpret_cast<const void*>(&helperThreadCount), bytes);
+        }
+    } break;
     case MC_DEBUG_KERNEL_TRACE:
         if (pMem == nullptr) {
             *pNumBytes = ctxtPtr->lastLoggedDebugDetail.length();
@@ -1181,7 +1651,7 @@ MCAPI_ATTR McResult MCAPI_CALL mcGetInfo(const McContext context, McFlags info,
 }
 
 bool checkFrontendMesh(
-    std::unique_ptr<McDispatchContextInternal>& ctxtPtr,
+    McDispatchContextInternal* ctxtPtr,
     const void* pVertices,
     const uint32_t* pFaceIndices,
     const uint32_t* pFaceSizes,
@@ -1214,7 +1684,7 @@ bool checkFrontendMesh(
 }
 
 #if 0
-McResult checkMeshPlacement(std::unique_ptr<McDispatchContextInternal>& ctxtPtr, const mcut::mesh_t& srcMesh, const mcut::mesh_t& cutMesh)
+McResult checkMeshPlacement(McDispatchContextInternal* ctxtPtr, const mcut::mesh_t& srcMesh, const mcut::mesh_t& cutMesh)
 {
     MCUT_ASSERT(srcMesh.number_of_vertices() >= 3);
     MCUT_ASSERT(cutMesh.number_of_vertices() >= 3);
@@ -1240,349 +1710,561 @@ McResult checkMeshPlacement(std::unique_ptr<McDispatchContextInternal>& ctxtPtr,
 }
 #endif
 
-#include <algorithm> // std::sort
-#include <queue> // std::queue for traversal
-
-void constructOIBVH(
-    const mcut::mesh_t& mesh,
-    std::vector<mcut::geom::bounding_box_t<mcut::math::fast_vec3>>& bvhAABBs,
-    std::vector<mcut::fd_t>& bvhLeafNodeFaces)
+#include <algorithm> // std::fill, std::sort
+#include <atomic> // parallel traversal
+#include <queue>
+
+// minimum number of elements (faces, vertices, nodes etc.) that a thread must process
+// before constructOIBVH bothers to run a pass in parallel
+const uint32_t OIBVH_MIN_ELEMENTS_PER_THREAD = 1 << 12;
+
+// Sort the (30-bit) morton codes of the mesh faces in ascending order using a parallel
+// LSD radix sort with 8-bit digits. The sort is stable so faces with equal morton codes
+// remain in face-index order, which makes the result independent of the thread count.
+void radixSortMortonCodes(
+    mcut::thread_pool& scheduler,
+    std::vector<uint32_t>& mortonCodes,
+    std::vector<uint32_t>& faceIndices)
 {
-    const int meshFaceCount = mesh.number_of_faces();
-    const int bvhNodeCount = mcut::bvh::get_ostensibly_implicit_bvh_size(meshFaceCount);
+    MCUT_ASSERT(mortonCodes.size() == faceIndices.size());
 
-    // compute mesh-face bounding boxes and their centers
-    // ::::::::::::::::::::::::::::::::::::::::::::::::::
+    const uint32_t radixBits = 8;
+    const uint32_t radixSize = (1 << radixBits);
+    const uint32_t radixMask = radixSize - 1;
+    const uint32_t mortonCodeBits = 30;
+
+    const uint32_t count = (uint32_t)mortonCodes.size();
+    const uint32_t numBlocks = mcut::get_parallel_block_count(scheduler, count, OIBVH_MIN_ELEMENTS_PER_THREAD);
+
+    // per-block digit counts (histograms), which become per-block scatter offsets
+    std::vector<uint32_t> blockDigitOffsets(numBlocks * radixSize);
+    std::vector<uint32_t> mortonCodesTmp(count);
+    std::vector<uint32_t> faceIndicesTmp(count);
 
-    std::vector<mcut::geom::bounding_box_t<mcut::math::fast_vec3>> face_bboxes(meshFaceCount, mcut::geom::bounding_box_t<mcut::math::fast_vec3>());
-    std::vector<mcut::math::fast_vec3> face_bbox_centers(meshFaceCount, mcut::math::fast_vec3());
+    for (uint32_t shift = 0; shift < mortonCodeBits; shift += radixBits) {
+
+        std::fill(blockDigitOffsets.begin(), blockDigitOffsets.end(), 0);
+
+        mcut::parallel_for_blocks(scheduler, count, numBlocks, [&](uint32_t block, uint32_t begin, uint32_t end) {
+            uint32_t* histogram = blockDigitOffsets.data() + (block * radixSize);
+            for (uint32_t i = begin; i < end; ++i) {
+                histogram[(mortonCodes[i] >> shift) & radixMask]++;
+            }
+        });
 
-    // for each face in mesh
-    for (mcut::mesh_t::face_iterator_t f = mesh.faces_begin(); f != mesh.faces_end(); ++f) {
-        const int faceIdx = static_cast<int>(*f);
-        const std::vector<mcut::vd_t> vertices_on_face = mesh.get_vertices_around_face(*f);
+        // exclusive prefix sum in (digit, block) order so that each block writes
+        // its elements after those of the preceding blocks with the same digit
+        uint32_t sum = 0;
+        bool allCodesHaveSameDigit = false;
+
+        for (uint32_t digit = 0; digit < radixSize; ++digit) {
+            const uint32_t digitStart = sum;
+            for (uint32_t block = 0; block < numBlocks; ++block) {
+                uint32_t& offset = blockDigitOffsets[(block * radixSize) + digit];
+                const uint32_t digitCount = offset;
+                offset = sum;
+                sum += digitCount;
+            }
+            allCodesHaveSameDigit = allCodesHaveSameDigit || ((sum - digitStart) == count);
+        }
 
-        // for each vertex on face
-        for (std::vector<mcut::vd_t>::const_iterator v = vertices_on_face.cbegin(); v != vertices_on_face.cend(); ++v) {
-            const mcut::math::fast_vec3 coords = mesh.vertex(*v);
-            face_bboxes[faceIdx].expand(coords);
+        if (allCodesHaveSameDigit) {
+            continue; // scattering would not change the order
         }
 
-        const mcut::geom::bounding_box_t<mcut::math::fast_vec3>& bbox = face_bboxes[faceIdx];
+        mcut::parallel_for_blocks(scheduler, count, numBlocks, [&](uint32_t block, uint32_t begin, uint32_t end) {
+            uint32_t* offsets = blockDigitOffsets.data() + (block * radixSize);
+            for (uint32_t i = begin; i < end; ++i) {
+                const uint32_t dst = offsets[(mortonCodes[i] >> shift) & radixMask]++;
+                mortonCodesTmp[dst] = mortonCodes[i];
+                faceIndicesTmp[dst] = faceIndices[i];
+            }
+        });
 
-        // calculate bbox center
-        face_bbox_centers[*f] = (bbox.minimum() + bbox.maximum()) / 2;
+        mortonCodes.swap(mortonCodesTmp);
+        faceIndices.swap(faceIndicesTmp);
     }
+}
+
+// compute the bounding boxes of the internal nodes of an oi-bvh from those of its leaves,
+// which are stored in the last "meshFaceCount" elements of "bvhAABBs"
+void computeOIBVHInternalNodes(
+    mcut::thread_pool& scheduler,
+    const int meshFaceCount,
+    std::vector<mcut::geom::bounding_box_t<mcut::math::fast_vec3>>& bvhAABBs)
+{
+    const int bvhNodeCount = (int)bvhAABBs.size();
+    const int leaf_level_index = mcut::bvh::get_leaf_level_from_real_leaf_count(meshFaceCount);
+    const int rightmost_real_leaf = mcut::bvh::get_rightmost_real_leaf(leaf_level_index, meshFaceCount);
+    const int leaf_level_memory_offset = bvhNodeCount - meshFaceCount;
+
+    MCUT_ASSERT(bvhNodeCount == mcut::bvh::get_ostensibly_implicit_bvh_size(meshFaceCount));
+
+    int child_level_memory_offset = leaf_level_memory_offset;
+    int leftmost_real_node_on_child_level = mcut::bvh::get_level_leftmost_node(leaf_level_index);
+    int rightmost_real_node_on_child_level = rightmost_real_leaf;
+
+    // for each level in the oi-bvh tree (starting from the penultimate level). The nodes
+    // on a level depend only on their children, so each level is processed in parallel.
+    for (int level_index = leaf_level_index - 1; level_index >= 0; --level_index) {
+
+        const int rightmost_real_node_on_level = mcut::bvh::get_level_rightmost_real_node(rightmost_real_leaf, leaf_level_index, level_index);
+        const int leftmost_real_node_on_level = mcut::bvh::get_level_leftmost_node(level_index);
+        const int number_of_real_nodes_on_level = (rightmost_real_node_on_level - leftmost_real_node_on_level) + 1;
+        const int level_memory_offset = mcut::bvh::get_node_mem_index(
+            leftmost_real_node_on_level,
+            leftmost_real_node_on_level,
+            0,
+            rightmost_real_node_on_level);
+
+        MCUT_ASSERT(level_memory_offset + number_of_real_nodes_on_level <= child_level_memory_offset);
+
+        mcut::parallel_for(scheduler, number_of_real_nodes_on_level, OIBVH_MIN_ELEMENTS_PER_THREAD, [&](uint32_t begin, uint32_t end) {
+            // for each node on the current level
+            for (uint32_t level_node_idx_iter = begin; level_node_idx_iter < end; ++level_node_idx_iter) {
+
+                const int node_implicit_idx = leftmost_real_node_on_level + (int)level_node_idx_iter;
+                const int left_child_implicit_idx = (node_implicit_idx * 2) + 1;
+                const int right_child_implicit_idx = (node_implicit_idx * 2) + 2;
+                const bool right_child_exists = (right_child_implicit_idx <= rightmost_real_node_on_child_level);
+
+                mcut::geom::bounding_box_t<mcut::math::fast_vec3>& node_bbox = bvhAABBs[level_memory_offset + level_node_idx_iter];
+
+                node_bbox = bvhAABBs[child_level_memory_offset + (left_child_implicit_idx - leftmost_real_node_on_child_level)];
+
+                if (right_child_exists) {
+                    node_bbox.expand(bvhAABBs[child_level_memory_offset + (right_child_implicit_idx - leftmost_real_node_on_child_level)]);
+                }
+            } // for each real node on level
+        });
+
+        child_level_memory_offset = level_memory_offset;
+        leftmost_real_node_on_child_level = leftmost_real_node_on_level;
+        rightmost_real_node_on_child_level = rightmost_real_node_on_level;
+    } // for each internal level
+}
+
+void constructOIBVH(
+    mcut::thread_pool& scheduler,
+    const mcut::mesh_t& mesh,
+    std::vector<mcut::geom::bounding_box_t<mcut::math::fast_vec3>>& bvhAABBs,
+    std::vector<mcut::fd_t>& bvhLeafNodeFaces)
+{
+    const int meshFaceCount = mesh.number_of_faces();
+    const int bvhNodeCount = mcut::bvh::get_ostensibly_implicit_bvh_size(meshFaceCount);
+
+    // NOTE: faces are addressed by index below, which requires that there are no removed faces
+    MCUT_ASSERT(meshFaceCount == mesh.number_of_internal_faces());
+
+    // compute mesh-face bounding boxes and their centers
+    // ::::::::::::::::::::::::::::::::::::::::::::::::::
+
+    std::vector<mcut::geom::bounding_box_t<mcut::math::fast_vec3>> face_bboxes(meshFaceCount);
+
+    mcut::parallel_for(scheduler, meshFaceCount, OIBVH_MIN_ELEMENTS_PER_THREAD, [&](uint32_t begin, uint32_t end) {
+        for (uint32_t faceIdx = begin; faceIdx < end; ++faceIdx) {
+            const std::vector<mcut::hd_t>& halfedges_on_face = mesh.get_halfedges_around_face(mcut::fd_t(faceIdx));
+            mcut::geom::bounding_box_t<mcut::math::fast_vec3>& face_bbox = face_bboxes[faceIdx];
+
+            // for each vertex on face
+            for (std::vector<mcut::hd_t>::const_iterator h = halfedges_on_face.cbegin(); h != halfedges_on_face.cend(); ++h) {
+                const mcut::math::fast_vec3 coords = mesh.vertex(mesh.target(*h));
+                face_bbox.expand(coords);
+            }
+        }
+    });
 
     // compute mesh bounding box
     // :::::::::::::::::::::::::
 
-    bvhAABBs.resize(bvhNodeCount);
-    mcut::geom::bounding_box_t<mcut::math::fast_vec3>& meshBbox = bvhAABBs.front(); // root bounding box
+    const uint32_t meshVertexSlotCount = mesh.number_of_internal_vertices();
+    const uint32_t numVertexBlocks = mcut::get_parallel_block_count(scheduler, meshVertexSlotCount, OIBVH_MIN_ELEMENTS_PER_THREAD);
+    std::vector<mcut::geom::bounding_box_t<mcut::math::fast_vec3>> blockBboxes(numVertexBlocks);
 
-    // for each vertex in mesh
-    for (mcut::mesh_t::vertex_iterator_t v = mesh.vertices_begin(); v != mesh.vertices_end(); ++v) {
-        const mcut::math::vec3& coords = mesh.vertex(*v);
-        meshBbox.expand(coords);
+    mcut::parallel_for_blocks(scheduler, meshVertexSlotCount, numVertexBlocks, [&](uint32_t block, uint32_t begin, uint32_t end) {
+        for (uint32_t vertexIdx = begin; vertexIdx < end; ++vertexIdx) {
+            const mcut::vd_t v(vertexIdx);
+            if (!mesh.is_removed(v)) {
+                const mcut::math::vec3& coords = mesh.vertex(v);
+                blockBboxes[block].expand(coords);
+            }
+        }
+    });
+
+    mcut::geom::bounding_box_t<mcut::math::fast_vec3> meshBbox;
+
+    for (uint32_t block = 0; block < numVertexBlocks; ++block) {
+        meshBbox.expand(blockBboxes[block]);
     }
 
     // compute morton codes
     // ::::::::::::::::::::
 
-    std::vector<std::pair<mcut::fd_t, uint32_t>> bvhLeafNodeDescriptors(meshFaceCount, std::pair<mcut::fd_t, uint32_t>());
+    std::vector<uint32_t> mortonCodes(meshFaceCount);
+    std::vector<uint32_t> sortedFaceIndices(meshFaceCount);
 
-    for (mcut::mesh_t::face_iterator_t f = mesh.faces_begin(); f != mesh.faces_end(); ++f) {
-        const uint32_t faceIdx = static_cast<uint32_t>(*f);
-
-        const mcut::math::fast_vec3& face_aabb_centre = face_bbox_centers.at(faceIdx);
-        const mcut::math::fast_vec3 offset = face_aabb_centre - meshBbox.minimum();
+    mcut::parallel_for(scheduler, meshFaceCount, OIBVH_MIN_ELEMENTS_PER_THREAD, [&](uint32_t begin, uint32_t end) {
         const mcut::math::fast_vec3 dims = meshBbox.maximum() - meshBbox.minimum();
 
-        const unsigned int mortion_code = mcut::bvh::morton3D(
-            static_cast<float>(offset.x() / dims.x()),
-            static_cast<float>(offset.y() / dims.y()),
-            static_cast<float>(offset.z() / dims.z()));
+        for (uint32_t faceIdx = begin; faceIdx < end; ++faceIdx) {
+            const mcut::geom::bounding_box_t<mcut::math::fast_vec3>& bbox = face_bboxes[faceIdx];
+            const mcut::math::fast_vec3 face_aabb_centre = (bbox.minimum() + bbox.maximum()) / 2;
+            const mcut::math::fast_vec3 offset = face_aabb_centre - meshBbox.minimum();
 
-        const uint32_t idx = (uint32_t)std::distance(mesh.faces_begin(), f);
-        bvhLeafNodeDescriptors[idx].first = *f;
-        bvhLeafNodeDescriptors[idx].second = mortion_code;
-    }
+            mortonCodes[faceIdx] = mcut::bvh::morton3D(
+                static_cast<float>(offset.x() / dims.x()),
+                static_cast<float>(offset.y() / dims.y()),
+                static_cast<float>(offset.z() / dims.z()));
+            sortedFaceIndices[faceIdx] = faceIdx;
+        }
+    });
 
     // sort faces according to morton codes
 
-    std::sort(
-        bvhLeafNodeDescriptors.begin(),
-        bvhLeafNodeDescriptors.end(),
-        [](const std::pair<mcut::fd_t, uint32_t>& a, const std::pair<mcut::fd_t, uint32_t>& b) {
-            return a.second < b.second;
-        });
+    radixSortMortonCodes(scheduler, mortonCodes, sortedFaceIndices);
 
+    // save sorted leaf node bvhAABBs and their corrresponding face id
+    // :::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+    bvhAABBs.resize(bvhNodeCount);
     bvhLeafNodeFaces.resize(meshFaceCount);
 
-    const int leaf_level_index = mcut::bvh::get_leaf_level_from_real_leaf_count(meshFaceCount);
-    const int leftmost_real_node_on_leaf_level = mcut::bvh::get_level_leftmost_node(leaf_level_index);
-    const int rightmost_real_leaf = mcut::bvh::get_rightmost_real_leaf(leaf_level_index, meshFaceCount);
-    const int rightmost_real_node_on_leaf_level = mcut::bvh::get_level_rightmost_real_node(rightmost_real_leaf, leaf_level_index, leaf_level_index);
+    // NOTE: the real nodes of a level are stored contiguously, so the memory index of a
+    // node is the memory index of the leftmost node on its level plus its offset on the level.
+    // The leaves are therefore stored in the last "meshFaceCount" elements of "bvhAABBs".
+    const int leaf_level_memory_offset = bvhNodeCount - meshFaceCount;
 
-    // save sorted leaf node bvhAABBs and their corrresponding face id
-    for (std::vector<std::pair<mcut::fd_t, uint32_t>>::const_iterator it = bvhLeafNodeDescriptors.cbegin(); it != bvhLeafNodeDescriptors.cend(); ++it) {
-        const uint32_t index_on_leaf_level = (uint32_t)std::distance(bvhLeafNodeDescriptors.cbegin(), it);
+    mcut::parallel_for(scheduler, meshFaceCount, OIBVH_MIN_ELEMENTS_PER_THREAD, [&](uint32_t begin, uint32_t end) {
+        for (uint32_t index_on_leaf_level = begin; index_on_leaf_level < end; ++index_on_leaf_level) {
+            const uint32_t faceIdx = sortedFaceIndices[index_on_leaf_level];
+            bvhLeafNodeFaces[index_on_leaf_level] = mcut::fd_t(faceIdx);
+            bvhAABBs[leaf_level_memory_offset + index_on_leaf_level] = face_bboxes[faceIdx];
+        }
+    });
+
+    // construct internal-node bounding boxes
+    // ::::::::::::::::::::::::::::::::::::::
 
-        bvhLeafNodeFaces[index_on_leaf_level] = it->first;
+    computeOIBVHInternalNodes(scheduler, meshFaceCount, bvhAABBs);
+}
 
-        const int implicit_idx = leftmost_real_node_on_leaf_level + index_on_leaf_level;
-        const int memory_idx = mcut::bvh::get_node_mem_index(
-            implicit_idx,
-            leftmost_real_node_on_leaf_level,
-            0,
-            rightmost_real_node_on_leaf_level);
+// update the bounding boxes of an oi-bvh that is built by "constructOIBVH" after the vertices of
+// "mesh" have moved. The leaves keep their order (i.e. the faces are not re-sorted), so the tree
+// becomes less efficient to traverse as the faces move away from their original positions.
+void refitOIBVH(
+    mcut::thread_pool& scheduler,
+    const mcut::mesh_t& mesh,
+    std::vector<mcut::geom::bounding_box_t<mcut::math::fast_vec3>>& bvhAABBs,
+    const std::vector<mcut::fd_t>& bvhLeafNodeFaces)
+{
+    const int meshFaceCount = mesh.number_of_faces();
+    const int leaf_level_memory_offset = (int)bvhAABBs.size() - meshFaceCount;
 
-        const mcut::geom::bounding_box_t<mcut::math::fast_vec3>& face_bbox = face_bboxes[(uint32_t)it->first];
-        bvhAABBs[memory_idx] = face_bbox;
+    MCUT_ASSERT((int)bvhLeafNodeFaces.size() == meshFaceCount);
+
+    mcut::parallel_for(scheduler, meshFaceCount, OIBVH_MIN_ELEMENTS_PER_THREAD, [&](uint32_t begin, uint32_t end) {
+        for (uint32_t index_on_leaf_level = begin; index_on_leaf_level < end; ++index_on_leaf_level) {
+            const std::vector<mcut::hd_t>& halfedges_on_face = mesh.get_halfedges_around_face(bvhLeafNodeFaces[index_on_leaf_level]);
+            mcut::geom::bounding_box_t<mcut::math::fast_vec3> face_bbox;
+
+            for (std::vector<mcut::hd_t>::const_iterator h = halfedges_on_face.cbegin(); h != halfedges_on_face.cend(); ++h) {
+                const mcut::math::fast_vec3 coords = mesh.vertex(mesh.target(*h));
+                face_bbox.expand(coords);
+            }
+
+            bvhAABBs[leaf_level_memory_offset + index_on_leaf_level] = face_bbox;
+        }
+    });
+
+    computeOIBVHInternalNodes(scheduler, meshFaceCount, bvhAABBs);
+}
+
+// the increase in the traversal cost of a refitted oi-bvh (relative to when it was built) beyond
+// which it is rebuilt
+const double OIBVH_MAX_REFIT_COST_RATIO = 2.0;
+
+// the sum of the surface areas of the internal nodes of an oi-bvh relative to that of its root, which
+// estimates the cost of traversing the tree. It grows as the boxes of sibling nodes overlap.
+double getOIBVHCost(const std::vector<mcut::geom::bounding_box_t<mcut::math::fast_vec3>>& bvhAABBs, const int meshFaceCount)
+{
+    const int internalNodeCount = (int)bvhAABBs.size() - meshFaceCount;
+
+    if (internalNodeCount == 0) {
+        return 0.0; // the root is a leaf
     }
 
-    // construct internal-node bounding boxes
-    // ::::::::::::::::::::::::::::::::::::::
+    const auto surfaceArea = [](const mcut::geom::bounding_box_t<mcut::math::fast_vec3>& bbox) {
+        const mcut::math::fast_vec3 dims = bbox.maximum() - bbox.minimum();
+        return 2.0 * ((dims.x() * dims.y()) + (dims.y() * dims.z()) + (dims.z() * dims.x()));
+    };
 
-    // for each level in the oi-bvh tree (starting from the penultimate level)
-    for (int level_index = leaf_level_index - 1; level_index >= 0; --level_index) {
+    double totalArea = 0.0;
 
-        const int rightmost_real_node_on_level = mcut::bvh::get_level_rightmost_real_node(rightmost_real_leaf, leaf_level_index, level_index);
-        const int leftmost_real_node_on_level = mcut::bvh::get_level_leftmost_node(level_index);
-        const int number_of_real_nodes_on_level = (rightmost_real_node_on_level - leftmost_real_node_on_level) + 1;
+    for (int i = 0; i < internalNodeCount; ++i) {
+        totalArea += surfaceArea(bvhAABBs[i]);
+    }
 
-        // for each node on the current level
-        for (int level_node_idx_iter = 0; level_node_idx_iter < number_of_real_nodes_on_level; ++level_node_idx_iter) {
+    const double rootArea = surfaceArea(bvhAABBs[0]);
 
-            const int node_implicit_idx = leftmost_real_node_on_level + level_node_idx_iter;
-            const int left_child_implicit_idx = (node_implicit_idx * 2) + 1;
-            const int right_child_implicit_idx = (node_implicit_idx * 2) + 2;
-            const bool is_penultimate_level = (level_index == (leaf_level_index - 1));
-            const int rightmost_real_node_on_child_level = mcut::bvh::get_level_rightmost_real_node(rightmost_real_leaf, leaf_level_index, level_index + 1);
-            const int leftmost_real_node_on_child_level = mcut::bvh::get_level_leftmost_node(level_index + 1);
-            const bool right_child_exists = (right_child_implicit_idx <= rightmost_real_node_on_child_level);
+    return rootArea > 0.0 ? (totalArea / rootArea) : 0.0;
+}
 
-            mcut::geom::bounding_box_t<mcut::math::fast_vec3> node_bbox;
+// the layout of a level in an oi-bvh (used to locate nodes during traversal)
+struct OIBVHLevelInfo {
+    int leftmostNode; // implicit index
+    int rightmostRealNode; // implicit index
+    int memoryOffset; // index of the leftmost node in the AABB array
+};
 
-            if (is_penultimate_level) { // both children are leaves
+// read-only view of an oi-bvh for traversal, where the per-level node
+// layout is computed once instead of for every visited node
+struct OIBVHTraversalInfo {
+    const std::vector<mcut::geom::bounding_box_t<mcut::math::fast_vec3>>* aabbs;
+    const std::vector<mcut::fd_t>* leafNodeFaces;
+    // (row-major) affine transform of the mesh, which is applied to the bounding boxes
+    // as they are visited. Null if the bounding boxes are in the frame of the other BVH.
+    const double* transform;
+    int leafLevel;
+    std::vector<OIBVHLevelInfo> levels;
+
+    OIBVHTraversalInfo(
+        const std::vector<mcut::geom::bounding_box_t<mcut::math::fast_vec3>>& bvhAABBs,
+        const std::vector<mcut::fd_t>& bvhLeafNodeFaces,
+        const double* bvhTransform = nullptr)
+        : aabbs(&bvhAABBs)
+        , leafNodeFaces(&bvhLeafNodeFaces)
+        , transform(bvhTransform)
+    {
+        const int numLeaves = (int)bvhLeafNodeFaces.size();
+        MCUT_ASSERT(numLeaves >= 1);
 
-                const int left_child_index_on_level = left_child_implicit_idx - leftmost_real_node_on_child_level;
-                const mcut::fd_t& left_child_face = bvhLeafNodeFaces.at(left_child_index_on_level);
-                const mcut::geom::bounding_box_t<mcut::math::fast_vec3>& left_child_bbox = face_bboxes.at(left_child_face);
+        leafLevel = mcut::bvh::get_leaf_level_from_real_leaf_count(numLeaves);
+        const int rightmostRealLeaf = mcut::bvh::get_rightmost_real_leaf(leafLevel, numLeaves);
 
-                node_bbox.expand(left_child_bbox);
+        levels.resize(leafLevel + 1);
 
-                if (right_child_exists) {
-                    const int right_child_index_on_level = right_child_implicit_idx - leftmost_real_node_on_child_level;
-                    const mcut::fd_t& right_child_face = bvhLeafNodeFaces.at(right_child_index_on_level);
-                    const mcut::geom::bounding_box_t<mcut::math::fast_vec3>& right_child_bbox = face_bboxes.at(right_child_face);
-                    node_bbox.expand(right_child_bbox);
-                }
-            } else { // remaining internal node levels
+        for (int level = 0; level <= leafLevel; ++level) {
+            OIBVHLevelInfo& info = levels[level];
+            info.leftmostNode = mcut::bvh::get_level_leftmost_node(level);
+            info.rightmostRealNode = mcut::bvh::get_level_rightmost_real_node(rightmostRealLeaf, leafLevel, level);
+            info.memoryOffset = mcut::bvh::get_node_mem_index(info.leftmostNode, info.leftmostNode, 0, info.rightmostRealNode);
+        }
+    }
+};
 
-                const int left_child_memory_idx = mcut::bvh::get_node_mem_index(
-                    left_child_implicit_idx,
-                    leftmost_real_node_on_child_level,
-                    0,
-                    rightmost_real_node_on_child_level);
-                const mcut::geom::bounding_box_t<mcut::math::fast_vec3>& left_child_bbox = bvhAABBs.at(left_child_memory_idx);
+// the axis-aligned bounding box of "bbox" after it is moved by a (row-major) affine transform, which
+// encloses the transformed (i.e. oriented) box
+mcut::geom::bounding_box_t<mcut::math::fast_vec3> transformBoundingBox(
+    const mcut::geom::bounding_box_t<mcut::math::fast_vec3>& bbox,
+    const double* m)
+{
+    const mcut::math::fast_vec3 center = (bbox.minimum() + bbox.maximum()) / 2;
+    const mcut::math::fast_vec3 extents = (bbox.maximum() - bbox.minimum()) / 2;
+    mcut::math::fast_vec3 transformedCenter;
+    mcut::math::fast_vec3 transformedExtents;
+
+    for (int i = 0; i < 3; ++i) {
+        const double* row = m + (i * 4);
+        transformedCenter[i] = (row[0] * center[0]) + (row[1] * center[1]) + (row[2] * center[2]) + row[3];
+        transformedExtents[i] = (std::fabs(row[0]) * extents[0]) + (std::fabs(row[1]) * extents[1]) + (std::fabs(row[2]) * extents[2]);
+    }
 
-                node_bbox.expand(left_child_bbox);
+    return mcut::geom::bounding_box_t<mcut::math::fast_vec3>(transformedCenter - transformedExtents, transformedCenter + transformedExtents);
+}
 
-                if (right_child_exists) {
-                    const int right_child_memory_idx = mcut::bvh::get_node_mem_index(
-                        right_child_implicit_idx,
-                        leftmost_real_node_on_child_level,
-                        0,
-                        rightmost_real_node_on_child_level);
-                    const mcut::geom::bounding_box_t<mcut::math::fast_vec3>& right_child_bbox = bvhAABBs.at(right_child_memory_idx);
-                    node_bbox.expand(right_child_bbox);
-                }
-            }
+// test the bounding boxes of a pair of nodes (sm BVH, cm BVH) for overlap. Overlapping
+// leaf nodes produce a pair of (potentially) intersecting faces, otherwise the child node
+// pairs that must be tested next are passed to "pushNodePair" (in left-to-right order).
+template <typename push_fn_type>
+void visitOIBVHNodePair(
+    const mcut::bvh::node_pair_t& nodePair,
+    const OIBVHTraversalInfo& sm,
+    const OIBVHTraversalInfo& cm,
+    std::vector<std::pair<mcut::fd_t, mcut::fd_t>>& intersecting_sm_cm_face_pairs,
+    const push_fn_type& pushNodePair)
+{
+    const int sm_node_implicit_idx = nodePair.m_left;
+    const int sm_node_level = mcut::bvh::get_level_from_implicit_idx(sm_node_implicit_idx);
+    const OIBVHLevelInfo& sm_level = sm.levels[sm_node_level];
+    const bool sm_node_is_leaf = (sm_node_level == sm.leafLevel);
+
+    const int cm_node_implicit_idx = nodePair.m_right;
+    const int cm_node_level = mcut::bvh::get_level_from_implicit_idx(cm_node_implicit_idx);
+    const OIBVHLevelInfo& cm_level = cm.levels[cm_node_level];
+    const bool cm_node_is_leaf = (cm_node_level == cm.leafLevel);
+
+    const mcut::geom::bounding_box_t<mcut::math::fast_vec3>& sm_node_bbox = (*sm.aabbs)[sm_level.memoryOffset + (sm_node_implicit_idx - sm_level.leftmostNode)];
+    const mcut::geom::bounding_box_t<mcut::math::fast_vec3>& cm_node_bbox = (*cm.aabbs)[cm_level.memoryOffset + (cm_node_implicit_idx - cm_level.leftmostNode)];
+
+    if (cm.transform == nullptr) {
+        if (!intersect_bounding_boxes(sm_node_bbox, cm_node_bbox)) {
+            return;
+        }
+    } else if (!intersect_bounding_boxes(sm_node_bbox, transformBoundingBox(cm_node_bbox, cm.transform))) {
+        return;
+    }
 
-            const int node_memory_idx = mcut::bvh::get_node_mem_index(
-                node_implicit_idx,
-                leftmost_real_node_on_level,
-                0,
-                rightmost_real_node_on_level);
+    if (sm_node_is_leaf && cm_node_is_leaf) {
+        const mcut::fd_t sm_node_face = (*sm.leafNodeFaces)[sm_node_implicit_idx - sm_level.leftmostNode];
+        const mcut::fd_t cm_node_face = (*cm.leafNodeFaces)[cm_node_implicit_idx - cm_level.leftmostNode];
+        intersecting_sm_cm_face_pairs.emplace_back(sm_node_face, cm_node_face);
+        return;
+    }
 
-            bvhAABBs.at(node_memory_idx) = node_bbox;
-        } // for each real node on level
-    } // for each internal level
+    // a leaf node is paired with the children of the other node
+    const int sm_left_child = sm_node_is_leaf ? sm_node_implicit_idx : (sm_node_implicit_idx * 2) + 1;
+    const int cm_left_child = cm_node_is_leaf ? cm_node_implicit_idx : (cm_node_implicit_idx * 2) + 1;
+    const bool sm_right_child_is_real = !sm_node_is_leaf && (sm_left_child + 1) <= sm.levels[sm_node_level + 1].rightmostRealNode;
+    const bool cm_right_child_is_real = !cm_node_is_leaf && (cm_left_child + 1) <= cm.levels[cm_node_level + 1].rightmostRealNode;
+
+    pushNodePair(mcut::bvh::node_pair_t { sm_left_child, cm_left_child });
+
+    if (cm_right_child_is_real) {
+        pushNodePair(mcut::bvh::node_pair_t { sm_left_child, cm_left_child + 1 });
+    }
+
+    if (sm_right_child_is_real) {
+        pushNodePair(mcut::bvh::node_pair_t { sm_left_child + 1, cm_left_child });
+
+        if (cm_right_child_is_real) {
+            pushNodePair(mcut::bvh::node_pair_t { sm_left_child + 1, cm_left_child + 1 });
+        }
+    }
 }
 
+// number of node pairs (from the top levels of the collision tree) from which
+// the parallel traversal starts. NOTE: this is a constant (and not a function of
+// the number of threads) so that the order of the face pairs is the same on all machines
+const uint32_t OIBVH_TRAVERSAL_SEED_COUNT = 256;
+
 void intersectOIBVHs(
+    mcut::thread_pool& scheduler,
     std::vector<std::pair<mcut::fd_t, mcut::fd_t>>& intersecting_sm_cm_face_pairs,
     const std::vector<mcut::geom::bounding_box_t<mcut::math::fast_vec3>>& srcMeshBvhAABBs,
     const std::vector<mcut::fd_t>& srcMeshBvhLeafNodeFaces,
     const std::vector<mcut::geom::bounding_box_t<mcut::math::fast_vec3>>& cutMeshBvhAABBs,
-    const std::vector<mcut::fd_t>& cutMeshBvhLeafNodeFaces)
+    const std::vector<mcut::fd_t>& cutMeshBvhLeafNodeFaces,
+    const double* cutMeshBvhTransform, // null if the cut-mesh BVH is in the frame of the source-mesh BVH
+    const bool deterministicOrder)
 {
-    // simultaneuosly traverse both BVHs to find intersecting pairs
-    std::queue<mcut::bvh::node_pair_t> traversalQueue;
-    traversalQueue.push({ 0, 0 }); // left = sm BVH; right = cm BVH
+    const OIBVHTraversalInfo sm(srcMeshBvhAABBs, srcMeshBvhLeafNodeFaces);
+    const OIBVHTraversalInfo cm(cutMeshBvhAABBs, cutMeshBvhLeafNodeFaces, cutMeshBvhTransform);
 
-    const int numSrcMeshFaces = (int)srcMeshBvhLeafNodeFaces.size();
-    MCUT_ASSERT(numSrcMeshFaces >= 1);
-    const int numCutMeshFaces = (int)cutMeshBvhLeafNodeFaces.size();
-    MCUT_ASSERT(numCutMeshFaces >= 1);
+    // seed the traversal by expanding the top levels of the collision tree breadth-first
+    // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
-    const int sm_bvh_leaf_level_idx = mcut::bvh::get_leaf_level_from_real_leaf_count(numSrcMeshFaces);
-    const int cs_bvh_leaf_level_idx = mcut::bvh::get_leaf_level_from_real_leaf_count(numCutMeshFaces);
+    std::vector<mcut::bvh::node_pair_t> seeds(1, mcut::bvh::node_pair_t { 0, 0 }); // left = sm BVH; right = cm BVH
+    std::vector<mcut::bvh::node_pair_t> nextSeeds;
 
-    const int sm_bvh_rightmost_real_leaf = mcut::bvh::get_rightmost_real_leaf(sm_bvh_leaf_level_idx, numSrcMeshFaces);
-    const int cs_bvh_rightmost_real_leaf = mcut::bvh::get_rightmost_real_leaf(cs_bvh_leaf_level_idx, numCutMeshFaces);
-
-    do {
-        mcut::bvh::node_pair_t ct_front_node = traversalQueue.front();
-
-        mcut::geom::bounding_box_t<mcut::math::fast_vec3> sm_bvh_node_bbox;
-        mcut::geom::bounding_box_t<mcut::math::fast_vec3> cs_bvh_node_bbox;
-
-        // sm
-        const int sm_bvh_node_implicit_idx = ct_front_node.m_left;
-        const int sm_bvh_node_level_idx = mcut::bvh::get_level_from_implicit_idx(sm_bvh_node_implicit_idx);
-        const bool sm_bvh_node_is_leaf = sm_bvh_node_level_idx == sm_bvh_leaf_level_idx;
-        const int sm_bvh_node_level_leftmost_node = mcut::bvh::get_level_leftmost_node(sm_bvh_node_level_idx);
-        mcut::fd_t sm_node_face = mcut::mesh_t::null_face();
-        const int sm_bvh_node_level_rightmost_node = mcut::bvh::get_level_rightmost_real_node(sm_bvh_rightmost_real_leaf, sm_bvh_leaf_level_idx, sm_bvh_node_level_idx);
-        const int sm_bvh_node_mem_idx = mcut::bvh::get_node_mem_index(
-            sm_bvh_node_implicit_idx,
-            sm_bvh_node_level_leftmost_node,
-            0,
-            sm_bvh_node_level_rightmost_node);
-        sm_bvh_node_bbox = srcMeshBvhAABBs.at(sm_bvh_node_mem_idx);
-
-        if (sm_bvh_node_is_leaf) {
-            const int sm_bvh_node_idx_on_level = sm_bvh_node_implicit_idx - sm_bvh_node_level_leftmost_node;
-            sm_node_face = srcMeshBvhLeafNodeFaces.at(sm_bvh_node_idx_on_level);
-        }
-
-        // cs
-        const int cs_bvh_node_implicit_idx = ct_front_node.m_right;
-        const int cs_bvh_node_level_idx = mcut::bvh::get_level_from_implicit_idx(cs_bvh_node_implicit_idx);
-        const int cs_bvh_node_level_leftmost_node = mcut::bvh::get_level_leftmost_node(cs_bvh_node_level_idx);
-        const bool cs_bvh_node_is_leaf = cs_bvh_node_level_idx == cs_bvh_leaf_level_idx;
-        mcut::fd_t cs_node_face = mcut::mesh_t::null_face();
-        const int cs_bvh_node_level_rightmost_node = mcut::bvh::get_level_rightmost_real_node(cs_bvh_rightmost_real_leaf, cs_bvh_leaf_level_idx, cs_bvh_node_level_idx);
-        const int cs_bvh_node_mem_idx = mcut::bvh::get_node_mem_index(
-            cs_bvh_node_implicit_idx,
-            cs_bvh_node_level_leftmost_node,
-            0,
-            cs_bvh_node_level_rightmost_node);
-        cs_bvh_node_bbox = cutMeshBvhAABBs.at(cs_bvh_node_mem_idx);
+    while (!seeds.empty() && seeds.size() < OIBVH_TRAVERSAL_SEED_COUNT) {
+        nextSeeds.clear();
 
-        if (cs_bvh_node_is_leaf) {
-            const int cs_bvh_node_idx_on_level = cs_bvh_node_implicit_idx - cs_bvh_node_level_leftmost_node;
-            cs_node_face = cutMeshBvhLeafNodeFaces.at(cs_bvh_node_idx_on_level);
+        for (std::vector<mcut::bvh::node_pair_t>::const_iterator it = seeds.cbegin(); it != seeds.cend(); ++it) {
+            visitOIBVHNodePair(*it, sm, cm, intersecting_sm_cm_face_pairs,
+                [&](const mcut::bvh::node_pair_t& p) { nextSeeds.push_back(p); });
         }
 
-        const bool haveOverlap = intersect_bounding_boxes(sm_bvh_node_bbox, cs_bvh_node_bbox);
+        seeds.swap(nextSeeds);
+    }
 
-        if (haveOverlap) {
+    const uint32_t numSeeds = (uint32_t)seeds.size();
 
-            if (cs_bvh_node_is_leaf && sm_bvh_node_is_leaf) {
-                MCUT_ASSERT(cs_node_face != mcut::mesh_t::null_face());
-                MCUT_ASSERT(sm_node_face != mcut::mesh_t::null_face());
+    if (numSeeds == 0) {
+        return; // the whole collision tree has been traversed
+    }
 
-                intersecting_sm_cm_face_pairs.emplace_back(sm_node_face, cs_node_face);
+    // traverse the subtrees of the seeds depth-first in parallel
+    // ::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 
-            } else if (sm_bvh_node_is_leaf && !cs_bvh_node_is_leaf) {
-                MCUT_ASSERT(cs_node_face == mcut::mesh_t::null_face());
-                MCUT_ASSERT(sm_node_face != mcut::mesh_t::null_face());
+    // the face pairs found from a range of seeds
+    struct seed_range_t {
+        uint32_t firstSeed;
+        uint32_t lastSeed; // exclusive
+        uint32_t thread;
+        uint32_t begin; // offset into the thread's pairs
+        uint32_t end;
+    };
 
-                const int cs_bvh_node_left_child_implicit_idx = (cs_bvh_node_implicit_idx * 2) + 1;
-                const int cs_bvh_node_right_child_implicit_idx = (cs_bvh_node_implicit_idx * 2) + 2;
+    const uint32_t numThreads = mcut::get_parallel_block_count(scheduler, numSeeds, 1);
+    const uint32_t seedsPerTask = std::max(numSeeds / (numThreads * 8), (uint32_t)1);
 
-                const int rightmost_real_node_on_child_level = mcut::bvh::get_level_rightmost_real_node(cs_bvh_rightmost_real_leaf, cs_bvh_leaf_level_idx, cs_bvh_node_level_idx + 1);
-                const bool right_child_is_real = cs_bvh_node_right_child_implicit_idx <= rightmost_real_node_on_child_level;
+    std::vector<std::vector<std::pair<mcut::fd_t, mcut::fd_t>>> threadFacePairs(numThreads);
+    std::vector<std::vector<seed_range_t>> threadSeedRanges(numThreads);
+    std::atomic<uint32_t> nextSeed(0);
 
-                traversalQueue.push({ sm_bvh_node_implicit_idx, cs_bvh_node_left_child_implicit_idx });
+    mcut::parallel_invoke(scheduler, numThreads, [&](uint32_t thread) {
+        std::vector<std::pair<mcut::fd_t, mcut::fd_t>>& facePairs = threadFacePairs[thread];
+        std::vector<seed_range_t>& seedRanges = threadSeedRanges[thread];
+        std::vector<mcut::bvh::node_pair_t> traversalStack;
 
-                if (right_child_is_real) {
-                    traversalQueue.push({ sm_bvh_node_implicit_idx, cs_bvh_node_right_child_implicit_idx });
-                }
-            } else if (!sm_bvh_node_is_leaf && cs_bvh_node_is_leaf) {
+        // idle threads take the next unprocessed seeds
+        for (uint32_t firstSeed = nextSeed.fetch_add(seedsPerTask); firstSeed < numSeeds; firstSeed = nextSeed.fetch_add(seedsPerTask)) {
+            const uint32_t lastSeed = std::min(firstSeed + seedsPerTask, numSeeds);
+            const uint32_t begin = (uint32_t)facePairs.size();
 
-                MCUT_ASSERT(cs_node_face != mcut::mesh_t::null_face());
-                MCUT_ASSERT(sm_node_face == mcut::mesh_t::null_face());
+            for (uint32_t s = firstSeed; s < lastSeed; ++s) {
+                traversalStack.push_back(seeds[s]);
 
-                const int sm_bvh_node_left_child_implicit_idx = (sm_bvh_node_implicit_idx * 2) + 1;
-                const int sm_bvh_node_right_child_implicit_idx = (sm_bvh_node_implicit_idx * 2) + 2;
+                do {
+                    const mcut::bvh::node_pair_t nodePair = traversalStack.back();
+                    traversalStack.pop_back();
 
-                const int rightmost_real_node_on_child_level = mcut::bvh::get_level_rightmost_real_node(sm_bvh_rightmost_real_leaf, sm_bvh_leaf_level_idx, sm_bvh_node_level_idx + 1);
-                const bool right_child_is_real = sm_bvh_node_right_child_implicit_idx <= rightmost_real_node_on_child_level;
+                    const size_t stackSize = traversalStack.size();
 
-                traversalQueue.push({ sm_bvh_node_left_child_implicit_idx, cs_bvh_node_implicit_idx });
+                    visitOIBVHNodePair(nodePair, sm, cm, facePairs,
+                        [&](const mcut::bvh::node_pair_t& p) { traversalStack.push_back(p); });
 
-                if (right_child_is_real) {
-                    traversalQueue.push({ sm_bvh_node_right_child_implicit_idx, cs_bvh_node_implicit_idx });
-                }
+                    // visit the children in left-to-right order
+                    std::reverse(traversalStack.begin() + stackSize, traversalStack.end());
+                } while (!traversalStack.empty());
+            }
 
-            } else { // both nodes are internal
-                MCUT_ASSERT(cs_node_face == mcut::mesh_t::null_face());
-                MCUT_ASSERT(sm_node_face == mcut::mesh_t::null_face());
+            seedRanges.push_back(seed_range_t { firstSeed, lastSeed, thread, begin, (uint32_t)facePairs.size() });
+        }
+    });
 
-                const int sm_bvh_node_left_child_implicit_idx = (sm_bvh_node_implicit_idx * 2) + 1;
-                const int sm_bvh_node_right_child_implicit_idx = (sm_bvh_node_implicit_idx * 2) + 2;
+    // concatenate the face pairs found by each thread
+    // :::::::::::::::::::::::::::::::::::::::::::::::
 
-                const int cs_bvh_node_left_child_implicit_idx = (cs_bvh_node_implicit_idx * 2) + 1;
-                const int cs_bvh_node_right_child_implicit_idx = (cs_bvh_node_implicit_idx * 2) + 2;
+    size_t numFacePairs = intersecting_sm_cm_face_pairs.size();
 
-                const int sm_rightmost_real_node_on_child_level = mcut::bvh::get_level_rightmost_real_node(sm_bvh_rightmost_real_leaf, sm_bvh_leaf_level_idx, sm_bvh_node_level_idx + 1);
-                const bool sm_right_child_is_real = sm_bvh_node_right_child_implicit_idx <= sm_rightmost_real_node_on_child_level;
+    for (uint32_t thread = 0; thread < numThreads; ++thread) {
+        numFacePairs += threadFacePairs[thread].size();
+    }
 
-                const int cs_rightmost_real_node_on_child_level = mcut::bvh::get_level_rightmost_real_node(cs_bvh_rightmost_real_leaf, cs_bvh_leaf_level_idx, cs_bvh_node_level_idx + 1);
-                const bool cs_right_child_is_real = cs_bvh_node_right_child_implicit_idx <= cs_rightmost_real_node_on_child_level;
+    intersecting_sm_cm_face_pairs.reserve(numFacePairs);
 
-                traversalQueue.push({ sm_bvh_node_left_child_implicit_idx, cs_bvh_node_left_child_implicit_idx });
+    if (deterministicOrder) { // i.e. in seed order, which is independent of the thread that processed a seed
+        std::vector<seed_range_t> seedRanges;
 
-                if (cs_right_child_is_real) {
-                    traversalQueue.push({ sm_bvh_node_left_child_implicit_idx, cs_bvh_node_right_child_implicit_idx });
-                }
+        for (uint32_t thread = 0; thread < numThreads; ++thread) {
+            seedRanges.insert(seedRanges.end(), threadSeedRanges[thread].cbegin(), threadSeedRanges[thread].cend());
+        }
 
-                if (sm_right_child_is_real) {
-                    traversalQueue.push({ sm_bvh_node_right_child_implicit_idx, cs_bvh_node_left_child_implicit_idx });
+        std::sort(seedRanges.begin(), seedRanges.end(),
+            [](const seed_range_t& a, const seed_range_t& b) { return a.firstSeed < b.firstSeed; });
 
-                    if (cs_right_child_is_real) {
-                        traversalQueue.push({ sm_bvh_node_right_child_implicit_idx, cs_bvh_node_right_child_implicit_idx });
-                    }
-                }
-            }
+        for (std::vector<seed_range_t>::const_iterator it = seedRanges.cbegin(); it != seedRanges.cend(); ++it) {
+            const std::vector<std::pair<mcut::fd_t, mcut::fd_t>>& facePairs = threadFacePairs[it->thread];
+            intersecting_sm_cm_face_pairs.insert(intersecting_sm_cm_face_pairs.end(), facePairs.cbegin() + it->begin, facePairs.cbegin() + it->end);
         }
-
-        traversalQueue.pop(); // rm ct_front_node
-    } while (!traversalQueue.empty());
+    } else {
+        for (uint32_t thread = 0; thread < numThreads; ++thread) {
+            intersecting_sm_cm_face_pairs.insert(intersecting_sm_cm_face_pairs.end(), threadFacePairs[thread].cbegin(), threadFacePairs[thread].cend());
+        }
+    }
 }
 
-MCAPI_ATTR McResult MCAPI_CALL mcDispatch(
-    const McContext context,
+// check the dispatch flags and make them the flags of the current dispatch call
+// NOTE: the floating-point type flags are only required when vertex arrays are passed
+McResult applyDispatchFlags(
+    McDispatchContextInternal* ctxtPtr,
     McFlags dispatchFlags,
-    const void* pSrcMeshVertices,
-    const uint32_t* pSrcMeshFaceIndices,
-    const uint32_t* pSrcMeshFaceSizes,
-    uint32_t numSrcMeshVertices,
-    uint32_t numSrcMeshFaces,
-    const void* pCutMeshVertices,
-    const uint32_t* pCutMeshFaceIndices,
-    const uint32_t* pCutMeshFaceSizes,
-    uint32_t numCutMeshVertices,
-    uint32_t numCutMeshFaces)
+    bool vertexArrayTypeRequired = true)
 {
-
     McResult result = McResult::MC_NO_ERROR;
-    std::map<McContext, std::unique_ptr<McDispatchContextInternal>>::iterator ctxtIter = gDispatchContexts.find(context);
-
-    // check context found
-    if (ctxtIter == gDispatchContexts.cend()) {
-        fprintf(stderr, "err: context undefined\n");
-        result = McResult::MC_INVALID_VALUE;
-        return result;
-    }
-
-    std::unique_ptr<McDispatchContextInternal>& ctxtPtr = ctxtIter->second;
 
-    if ((dispatchFlags & MC_DISPATCH_VERTEX_ARRAY_FLOAT) == 0 && (dispatchFlags & MC_DISPATCH_VERTEX_ARRAY_DOUBLE) == 0) {
+    if (vertexArrayTypeRequired && (dispatchFlags & MC_DISPATCH_VERTEX_ARRAY_FLOAT) == 0 && (dispatchFlags & MC_DISPATCH_VERTEX_ARRAY_DOUBLE) == 0) {
         ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "dispatch floating-point type unspecified");
         result = McResult::MC_INVALID_VALUE;
         return result;
@@ -1590,6 +2272,22 @@ MCAPI_ATTR McResult MCAPI_CALL mcDispatch(
 
     ctxtPtr->dispatchFlags = dispatchFlags;
 
+    return result;
+}
+
+// check the arrays of a source-mesh and build its internal representation (with its BVH)
+McResult buildDispatchSrcMesh(
+    McDispatchContextInternal* ctxtPtr,
+    DispatchSrcMesh& srcMesh,
+    McFlags vertexArrayFlags,
+    const void* pSrcMeshVertices,
+    const uint32_t* pSrcMeshFaceIndices,
+    const uint32_t* pSrcMeshFaceSizes,
+    uint32_t numSrcMeshVertices,
+    uint32_t numSrcMeshFaces)
+{
+    McResult result = McResult::MC_NO_ERROR;
+
     bool srcMeshOk = checkFrontendMesh(
         ctxtPtr,
         pSrcMeshVertices,
@@ -1603,24 +2301,11 @@ MCAPI_ATTR McResult MCAPI_CALL mcDispatch(
         return result;
     }
 
-    bool cutMeshOk = checkFrontendMesh(
-        ctxtPtr,
-        pCutMeshVertices,
-        pCutMeshFaceIndices,
-        pCutMeshFaceSizes,
-        numCutMeshVertices,
-        numCutMeshFaces);
-
-    if (!cutMeshOk) {
-        result = McResult::MC_INVALID_VALUE;
-        return result;
-    }
-
-    mcut::mesh_t srcMeshInternal;
     mcut::math::real_number_t srcMeshBboxDiagonal(0.0);
     result = indexArrayMeshToHalfedgeMesh(
         ctxtPtr,
-        srcMeshInternal,
+        vertexArrayFlags,
+        srcMesh.mesh,
         srcMeshBboxDiagonal,
         pSrcMeshVertices,
         pSrcMeshFaceIndices,
@@ -1632,14 +2317,146 @@ MCAPI_ATTR McResult MCAPI_CALL mcDispatch(
         return result;
     }
 
+    srcMesh.numInputVertices = numSrcMeshVertices;
+    srcMesh.numInputFaces = numSrcMeshFaces;
+
+    ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_OTHER, 0, McDebugSeverity::MC_DEBUG_SEVERITY_NOTIFICATION, "Build source-mesh BVH");
+
+    constructOIBVH(*ctxtPtr->scheduler, srcMesh.mesh, srcMesh.bvhAABBs, srcMesh.bvhLeafNodeFaces);
+
+    return result;
+}
+
+// check the dispatch flags and build the internal source-mesh (with its BVH), which is then
+// cut by one cut-mesh (see mcDispatch) or shared by many cut-meshes (see mcDispatchBatch)
+McResult prepareDispatchSrcMesh(
+    McDispatchContextInternal* ctxtPtr,
+    DispatchSrcMesh& srcMesh,
+    McFlags dispatchFlags,
+    const void* pSrcMeshVertices,
+    const uint32_t* pSrcMeshFaceIndices,
+    const uint32_t* pSrcMeshFaceSizes,
+    uint32_t numSrcMeshVertices,
+    uint32_t numSrcMeshFaces)
+{
+    McResult result = applyDispatchFlags(ctxtPtr, dispatchFlags);
+
+    if (result != McResult::MC_NO_ERROR) {
+        return result;
+    }
+
+    result = buildDispatchSrcMesh(ctxtPtr, srcMesh, dispatchFlags,
+        pSrcMeshVertices, pSrcMeshFaceIndices, pSrcMeshFaceSizes, numSrcMeshVertices, numSrcMeshFaces);
+
+    return result;
+}
+
+// whether a (row-major) 4x4 transform is affine, i.e. its last row is (0, 0, 0, 1)
+bool isAffineTransform(const double* m)
+{
+    return m[12] == 0.0 && m[13] == 0.0 && m[14] == 0.0 && m[15] == 1.0;
+}
+
+// apply a (row-major) affine transform to "vertex"
+mcut::math::vec3 transformMeshVertex(const double* m, const mcut::math::vec3& vertex)
+{
+    return mcut::math::vec3(
+        (vertex.x() * m[0]) + (vertex.y() * m[1]) + (vertex.z() * m[2]) + m[3],
+        (vertex.x() * m[4]) + (vertex.y() * m[5]) + (vertex.z() * m[6]) + m[7],
+        (vertex.x() * m[8]) + (vertex.y() * m[9]) + (vertex.z() * m[10]) + m[11]);
+}
+
+// compute the (row-major) affine transform "m" which applies "b" and then "a"
+void multiplyAffineTransforms(double* m, const double* a, const double* b)
+{
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 4; ++j) {
+            m[(i * 4) + j] = (a[(i * 4) + 0] * b[j]) + (a[(i * 4) + 1] * b[4 + j]) + (a[(i * 4) + 2] * b[8 + j]) + (j == 3 ? a[(i * 4) + 3] : 0.0);
+        }
+    }
+
+    m[12] = 0.0;
+    m[13] = 0.0;
+    m[14] = 0.0;
+    m[15] = 1.0;
+}
+
+// copy a cut-mesh that is created with mcCreateMesh, and move its vertices by "pTransform" and
+// then by "perturbation" (either of which may be null)
+void placeCutMesh(
+    mcut::mesh_t& cutMesh,
+    mcut::math::real_number_t& bboxDiagonal,
+    const mcut::mesh_t& mesh,
+    const double* pTransform,
+    const mcut::math::vec3* perturbation)
+{
+    cutMesh = mesh;
+
+    mcut::math::vec3 bboxMin(1e10);
+    mcut::math::vec3 bboxMax(-1e10);
+
+    for (int i = 0; i < cutMesh.number_of_vertices(); ++i) {
+        const mcut::vd_t v(i);
+        mcut::math::vec3 coords = pTransform != nullptr ? transformMeshVertex(pTransform, cutMesh.vertex(v)) : cutMesh.vertex(v);
+
+        if (perturbation != nullptr) {
+            coords = coords + *perturbation;
+        }
+
+        cutMesh.set_vertex(v, coords);
+        bboxMin = mcut::math::compwise_min(bboxMin, coords);
+        bboxMax = mcut::math::compwise_max(bboxMax, coords);
+    }
+
+    bboxDiagonal = mcut::math::length(bboxMax - bboxMin);
+}
+
+// cut the source-mesh that is prepared by "prepareDispatchSrcMesh" (or "buildDispatchSrcMesh") with one cut-mesh, and add the
+// resulting connected components to the context. This function is called concurrently (with the
+// same source-mesh) by batched dispatch calls, where "cutMeshIndex" identifies the cut-mesh.
+McResult cutDispatchSrcMesh(
+    McDispatchContextInternal* ctxtPtr,
+    const DispatchSrcMesh& sharedSrcMesh,
+    const void* pCutMeshVertices,
+    const uint32_t* pCutMeshFaceIndices,
+    const uint32_t* pCutMeshFaceSizes,
+    uint32_t numCutMeshVertices,
+    uint32_t numCutMeshFaces,
+    uint32_t cutMeshIndex,
+    const DispatchSrcMesh* prebuiltCutMesh = nullptr, // created with mcCreateMesh (then the arrays are unused)
+    const double* pCutMeshTransform = nullptr)
+{
+    McResult result = McResult::MC_NO_ERROR;
+
+    if (prebuiltCutMesh == nullptr) { // i.e. the prebuilt cut-mesh is already checked
+        bool cutMeshOk = checkFrontendMesh(
+            ctxtPtr,
+            pCutMeshVertices,
+            pCutMeshFaceIndices,
+            pCutMeshFaceSizes,
+            numCutMeshVertices,
+            numCutMeshFaces);
+
+        if (!cutMeshOk) {
+            result = McResult::MC_INVALID_VALUE;
+            return result;
+        }
+    }
+
+    // NOTE: the source-mesh may be shared with other cut-meshes, so it is copied (with its BVH) if
+    // this dispatch has to modify it (i.e. to partition a floating polygon on one of its faces)
+    const DispatchSrcMesh* srcMesh = &sharedSrcMesh;
+    std::unique_ptr<DispatchSrcMesh> modifiedSrcMesh;
+
     // check here to ensure that vertex coordinates of one mesh are not colocated with any coordinates in the other mesh
-    //result = checkMeshPlacement(ctxtPtr, srcMeshInternal, cutMeshInternal);
+    //result = checkMeshPlacement(ctxtPtr, srcMesh->mesh, cutMeshInternal);
     //if (result != McResult::MC_NO_ERROR) {
     //    return result;
     //}
 
     mcut::input_t backendInput;
-    backendInput.src_mesh = &srcMeshInternal;
+    backendInput.scheduler = ctxtPtr->scheduler.get();
+    backendInput.src_mesh = &srcMesh->mesh;
 
     backendInput.verbose = false;
     backendInput.require_looped_cutpaths = false;
@@ -1732,12 +2549,6 @@ MCAPI_ATTR McResult MCAPI_CALL mcDispatch(
     // Construct BVHs
     // ::::::::::::::
 
-    ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_OTHER, 0, McDebugSeverity::MC_DEBUG_SEVERITY_NOTIFICATION, "Build source-mesh BVH");
-    std::vector<mcut::geom::bounding_box_t<mcut::math::fast_vec3>> srcMeshBvhAABBs;
-    std::vector<mcut::fd_t> srcMeshBvhLeafNodeFaces;
-
-    constructOIBVH(srcMeshInternal, srcMeshBvhAABBs, srcMeshBvhLeafNodeFaces);
-
     ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_OTHER, 0, McDebugSeverity::MC_DEBUG_SEVERITY_NOTIFICATION, "Build cut-mesh BVH");
 
     std::map<mcut::fd_t, mcut::fd_t> fpPartitionChildFaceToInputSrcMeshFace;
@@ -1747,7 +2558,7 @@ MCAPI_ATTR McResult MCAPI_CALL mcDispatch(
     std::map<mcut::vd_t, mcut::math::vec3> addedFpPartitioningVerticesOnSrcMesh;
     std::map<mcut::vd_t, mcut::math::vec3> addedFpPartitioningVerticesOnCutMesh;
 
-    int numSourceMeshFacesInLastDispatchCall = numSrcMeshFaces;
+    int numSourceMeshFacesInLastDispatchCall = srcMesh->numInputFaces;
 
     mcut::output_t backendOutput;
 
@@ -1755,6 +2566,50 @@ MCAPI_ATTR McResult MCAPI_CALL mcDispatch(
     mcut::math::real_number_t cutMeshBboxDiagonal(0.0);
     std::vector<mcut::geom::bounding_box_t<mcut::math::fast_vec3>> cutMeshBvhAABBs;
     std::vector<mcut::fd_t> cutMeshBvhLeafNodeFaces;
+    // the cut-mesh BVH that is traversed. NOTE: the BVH of a prebuilt cut-mesh is used (in the frame of
+    // the cut-mesh, i.e. before "pCutMeshTransform") until the cut-mesh has to be rebuilt or modified
+    const std::vector<mcut::geom::bounding_box_t<mcut::math::fast_vec3>>* cutMeshBvhAABBsPtr = &cutMeshBvhAABBs;
+    const std::vector<mcut::fd_t>* cutMeshBvhLeafNodeFacesPtr = &cutMeshBvhLeafNodeFaces;
+    const double* cutMeshBvhTransform = nullptr;
+    bool cutMeshIsPlaced = true; // i.e. "cutMeshInternal" holds the vertices of the cut-mesh
+
+    // arrays of the polygon that is passed to the user's stitching callback
+    std::vector<uint32_t> stitchedPolygonVertexIds;
+    std::vector<double> stitchedPolygonVertexCoords;
+
+    if (ctxtPtr->stitchingCallback != nullptr) {
+        backendInput.stitched_polygon_callback = [&](const mcut::stitched_polygon_info_t& stitchedPolygon) {
+            // NOTE: the kernel stitches the inside and outside patches concurrently
+            std::lock_guard<std::mutex> lock(ctxtPtr->stitchingCallbackMutex);
+
+            // map the face of the (possibly partitioned) internal cut-mesh to the user's cut-mesh face
+            std::map<mcut::fd_t, mcut::fd_t>::const_iterator fiter = fpPartitionChildFaceToInputCutMeshFace.find(stitchedPolygon.cut_mesh_face);
+            const mcut::fd_t userCutMeshFace = (fiter != fpPartitionChildFaceToInputCutMeshFace.cend()) ? fiter->second : stitchedPolygon.cut_mesh_face;
+
+            stitchedPolygonVertexIds.resize(stitchedPolygon.vertices.size());
+            stitchedPolygonVertexCoords.resize(stitchedPolygon.vertices.size() * 3);
+
+            for (std::size_t i = 0; i < stitchedPolygon.vertices.size(); ++i) {
+                stitchedPolygonVertexIds[i] = static_cast<uint32_t>(stitchedPolygon.vertices[i]);
+
+                const mcut::math::vec3& coords = stitchedPolygon.vertex_coords[i];
+                for (int j = 0; j < 3; ++j) {
+                    stitchedPolygonVertexCoords[(i * 3) + j] = static_cast<double>(coords[j]);
+                }
+            }
+
+            McStitchedPolygonDesc desc;
+            desc.cutMeshIndex = cutMeshIndex;
+            desc.location = (stitchedPolygon.location == mcut::cut_surface_patch_location_t::INSIDE) ? McPatchLocation::MC_PATCH_LOCATION_INSIDE : McPatchLocation::MC_PATCH_LOCATION_OUTSIDE;
+            desc.stitchIndex = static_cast<uint32_t>(stitchedPolygon.stitch_index);
+            desc.cutMeshFace = static_cast<uint32_t>(userCutMeshFace);
+            desc.numVertices = static_cast<uint32_t>(stitchedPolygonVertexIds.size());
+            desc.pVertexIds = stitchedPolygonVertexIds.data();
+            desc.pVertexCoords = stitchedPolygonVertexCoords.data();
+
+            (*ctxtPtr->stitchingCallback)(&desc, ctxtPtr->stitchingCallbackUserParam);
+        };
+    }
 
     int perturbationIters = 0;
     int kernelDispatchCallCounter = -1;
@@ -1792,31 +2647,49 @@ MCAPI_ATTR McResult MCAPI_CALL mcDispatch(
             // TODO: assume that re-adding elements (vertices and faces) is going to change the order
             // from the user-provided order. So we still need to fix the mapping, which may no longer
             // be one-to-one as in the case when things do not change.
-            cutMeshInternal.remove_elements();
+            cutMeshInternal = mcut::mesh_t(); // NOTE: the mesh is rebuilt from scratch with the perturbed vertices
 
             // TODO: the number of cut-mesh faces and vertices may increase due to polygon partitioning
             // Therefore: we need to perturb [the updated cut-mesh] i.e. the one containing partitioned polygons
             // "pCutMeshFaces" are simply the user provided faces
             // We must also use the newly added vertices (coords) due to polygon partitioning as "unperturbed" values
             // This will require some intricate mapping
-            result = indexArrayMeshToHalfedgeMesh(
-                ctxtPtr,
-                cutMeshInternal,
-                cutMeshBboxDiagonal,
-                pCutMeshVertices,
-                pCutMeshFaceIndices,
-                pCutMeshFaceSizes,
-                numCutMeshVertices,
-                numCutMeshFaces,
-                ((perturbationIters == 0) ? NULL : &perturbation));
+            if (prebuiltCutMesh == nullptr) {
+                result = indexArrayMeshToHalfedgeMesh(
+                    ctxtPtr,
+                    ctxtPtr->dispatchFlags,
+                    cutMeshInternal,
+                    cutMeshBboxDiagonal,
+                    pCutMeshVertices,
+                    pCutMeshFaceIndices,
+                    pCutMeshFaceSizes,
+                    numCutMeshVertices,
+                    numCutMeshFaces,
+                    ((perturbationIters == 0) ? NULL : &perturbation));
 
-            if (result != McResult::MC_NO_ERROR) {
-                return result;
+                if (result != McResult::MC_NO_ERROR) {
+                    return result;
+                }
+
+                constructOIBVH(*ctxtPtr->scheduler, cutMeshInternal, cutMeshBvhAABBs, cutMeshBvhLeafNodeFaces);
+            } else if (perturbationIters == 0) {
+                // NOTE: the prebuilt cut-mesh is placed (i.e. copied and transformed) once its BVH is found to
+                // overlap the source-mesh BVH, since the BVH can be traversed without moving the cut-mesh
+                cutMeshIsPlaced = false;
+                cutMeshBvhAABBsPtr = &prebuiltCutMesh->bvhAABBs;
+                cutMeshBvhLeafNodeFacesPtr = &prebuiltCutMesh->bvhLeafNodeFaces;
+                cutMeshBvhTransform = pCutMeshTransform;
+            } else {
+                placeCutMesh(cutMeshInternal, cutMeshBboxDiagonal, prebuiltCutMesh->mesh, pCutMeshTransform, &perturbation);
+                cutMeshIsPlaced = true;
+
+                constructOIBVH(*ctxtPtr->scheduler, cutMeshInternal, cutMeshBvhAABBs, cutMeshBvhLeafNodeFaces);
+                cutMeshBvhAABBsPtr = &cutMeshBvhAABBs;
+                cutMeshBvhLeafNodeFacesPtr = &cutMeshBvhLeafNodeFaces;
+                cutMeshBvhTransform = nullptr;
             }
 
             backendInput.cut_mesh = &cutMeshInternal;
-
-            constructOIBVH(cutMeshInternal, cutMeshBvhAABBs, cutMeshBvhLeafNodeFaces);
         }
 
         if (floating_polygon_was_detected) {
@@ -1839,7 +2712,13 @@ MCAPI_ATTR McResult MCAPI_CALL mcDispatch(
 
                 // pointer to input mesh with face containing floating polygon
                 // Note: this mesh will be modified as we add new faces.
-                mcut::mesh_t* fpOriginInputMesh = (fpIsOnSrcMesh ? &srcMeshInternal : &cutMeshInternal);
+                if (fpIsOnSrcMesh && modifiedSrcMesh == nullptr) {
+                    modifiedSrcMesh = std::unique_ptr<DispatchSrcMesh>(new DispatchSrcMesh(*srcMesh));
+                    srcMesh = modifiedSrcMesh.get();
+                    backendInput.src_mesh = &srcMesh->mesh;
+                }
+
+                mcut::mesh_t* fpOriginInputMesh = (fpIsOnSrcMesh ? &modifiedSrcMesh->mesh : &cutMeshInternal);
 
                 srcMeshIsUpdated = srcMeshIsUpdated || fpIsOnSrcMesh;
                 cutMeshIsUpdated = cutMeshIsUpdated || !fpIsOnSrcMesh;
@@ -2469,7 +3348,6 @@ MCAPI_ATTR McResult MCAPI_CALL mcDispatch(
                         for (std::vector<mcut::hd_t>::const_iterator j = oldHalfedges.cbegin(); j != oldHalfedges.cend(); ++j) {
 
                             const mcut::hd_t oldHalfedge = *j;
-                            mcut::hd_t newHalfedge = mcut::mesh_t::null_halfedge();
                             const mcut::ed_t oldHalfedgeEdge = fpOriginInputMesh->edge(oldHalfedge);
 
                             // is the halfedge part of an edge that is to be partitioned...?
@@ -2503,6 +3381,7 @@ MCAPI_ATTR McResult MCAPI_CALL mcDispatch(
 
                         const mcut::fd_t fdescr = fpOriginInputMesh->add_face(faceVertices);
                         MCUT_ASSERT(fdescr == i->first);
+                        (void)fdescr;
 
 #if 0
                         std::map<mcut::fd_t, mcut::fd_t>::const_iterator fiter = fpOriginFaceChildFaceToUserInputMeshFace.find(fdescr);
@@ -2613,14 +3492,17 @@ MCAPI_ATTR McResult MCAPI_CALL mcDispatch(
             // rebuild the BVH of "fpOriginInputMesh" again
 
             if (srcMeshIsUpdated) {
-                srcMeshBvhAABBs.clear();
-                srcMeshBvhLeafNodeFaces.clear();
-                constructOIBVH(srcMeshInternal, srcMeshBvhAABBs, srcMeshBvhLeafNodeFaces);
+                modifiedSrcMesh->bvhAABBs.clear();
+                modifiedSrcMesh->bvhLeafNodeFaces.clear();
+                constructOIBVH(*ctxtPtr->scheduler, modifiedSrcMesh->mesh, modifiedSrcMesh->bvhAABBs, modifiedSrcMesh->bvhLeafNodeFaces);
             }
             if (cutMeshIsUpdated) {
                 cutMeshBvhAABBs.clear();
                 cutMeshBvhLeafNodeFaces.clear();
-                constructOIBVH(cutMeshInternal, cutMeshBvhAABBs, cutMeshBvhLeafNodeFaces);
+                constructOIBVH(*ctxtPtr->scheduler, cutMeshInternal, cutMeshBvhAABBs, cutMeshBvhLeafNodeFaces);
+                cutMeshBvhAABBsPtr = &cutMeshBvhAABBs;
+                cutMeshBvhLeafNodeFacesPtr = &cutMeshBvhLeafNodeFaces;
+                cutMeshBvhTransform = nullptr;
             }
 
             backendOutput.detected_floating_polygons.clear();
@@ -2691,7 +3573,10 @@ MCAPI_ATTR McResult MCAPI_CALL mcDispatch(
 
         std::vector<std::pair<mcut::fd_t, mcut::fd_t>> intersecting_sm_cm_face_pairs;
 
-        intersectOIBVHs(intersecting_sm_cm_face_pairs, srcMeshBvhAABBs, srcMeshBvhLeafNodeFaces, cutMeshBvhAABBs, cutMeshBvhLeafNodeFaces);
+        // NOTE: the order of the pairs determines the order of the intersection points
+        // computed by the kernel, so it must not depend on the threads for reproducible output
+        const bool deterministicOrder = true;
+        intersectOIBVHs(*ctxtPtr->scheduler, intersecting_sm_cm_face_pairs, srcMesh->bvhAABBs, srcMesh->bvhLeafNodeFaces, *cutMeshBvhAABBsPtr, *cutMeshBvhLeafNodeFacesPtr, cutMeshBvhTransform, deterministicOrder);
 
         ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_OTHER, 0, McDebugSeverity::MC_DEBUG_SEVERITY_NOTIFICATION, "Polygon-pairs found = " + std::to_string(intersecting_sm_cm_face_pairs.size()));
 
@@ -2700,12 +3585,17 @@ MCAPI_ATTR McResult MCAPI_CALL mcDispatch(
             return result;
         }
 
+        if (!cutMeshIsPlaced) {
+            placeCutMesh(cutMeshInternal, cutMeshBboxDiagonal, prebuiltCutMesh->mesh, pCutMeshTransform, NULL);
+            cutMeshIsPlaced = true;
+        }
+
         backendInput.intersecting_sm_cm_face_pairs = &intersecting_sm_cm_face_pairs;
 
         // cut!
         // ----
 
-        numSourceMeshFacesInLastDispatchCall = srcMeshInternal.number_of_faces();
+        numSourceMeshFacesInLastDispatchCall = srcMesh->mesh.number_of_faces();
 
         try {
             ctxtPtr->applyPrecisionAndRoundingModeSettings();
@@ -2732,7 +3622,10 @@ MCAPI_ATTR McResult MCAPI_CALL mcDispatch(
             McDebugSeverity::MC_DEBUG_SEVERITY_HIGH,
             mcut::to_string(backendOutput.status) + " : " + backendOutput.logger.get_reason_for_failure());
 
-        ctxtPtr->lastLoggedDebugDetail = backendOutput.logger.get_log_string();
+        {
+            std::lock_guard<std::mutex> lock(ctxtPtr->debugMutex);
+            ctxtPtr->lastLoggedDebugDetail = backendOutput.logger.get_log_string();
+        }
 
         return result;
     }
@@ -2744,41 +3637,55 @@ MCAPI_ATTR McResult MCAPI_CALL mcDispatch(
     // This offsetting follows a design choice used in the kernel that (ps-faces belonging to cut-mesh start [after] the
     // source-mesh faces).
     // Refer to the function "halfedgeMeshToIndexArrayMesh()" on how we use this information.
-    std::map<mcut::fd_t, mcut::fd_t> fpPartitionChildFaceToInputCutMeshFaceOFFSETTED = fpPartitionChildFaceToInputCutMeshFace;
+    std::shared_ptr<DispatchDataMaps> dataMaps = std::make_shared<DispatchDataMaps>();
+    std::map<mcut::fd_t, mcut::fd_t>& fpPartitionChildFaceToInputCutMeshFaceOFFSETTED = dataMaps->fpPartitionChildFaceToInputCutMeshFace;
+    fpPartitionChildFaceToInputCutMeshFaceOFFSETTED = fpPartitionChildFaceToInputCutMeshFace;
     for (std::map<mcut::fd_t, mcut::fd_t>::iterator i = fpPartitionChildFaceToInputCutMeshFace.begin();
          i != fpPartitionChildFaceToInputCutMeshFace.end(); ++i) {
-        mcut::fd_t offsettedDescr = mcut::fd_t(i->first + srcMeshInternal.number_of_faces());
+        mcut::fd_t offsettedDescr = mcut::fd_t(i->first + srcMesh->mesh.number_of_faces());
         fpPartitionChildFaceToInputCutMeshFaceOFFSETTED[offsettedDescr] = mcut::fd_t(i->second + numSourceMeshFacesInLastDispatchCall); // apply offset
             // i->second = mcut::fd_t(i->second + numSourceMeshFacesInLastDispatchCall); // apply offset
     }
 
-    std::map<mcut::vd_t, mcut::math::vec3> addedFpPartitioningVerticesOnCutMeshOFFSETTED;
+    std::map<mcut::vd_t, mcut::math::vec3>& addedFpPartitioningVerticesOnCutMeshOFFSETTED = dataMaps->addedFpPartitioningVerticesOnCutMesh;
     for (std::map<mcut::vd_t, mcut::math::vec3>::const_iterator i = addedFpPartitioningVerticesOnCutMesh.begin();
          i != addedFpPartitioningVerticesOnCutMesh.end(); ++i) {
-        mcut::vd_t offsettedDescr = mcut::vd_t(i->first + srcMeshInternal.number_of_vertices());
+        mcut::vd_t offsettedDescr = mcut::vd_t(i->first + srcMesh->mesh.number_of_vertices());
         addedFpPartitioningVerticesOnCutMeshOFFSETTED[offsettedDescr] = i->second; // apply offset
     }
 
+    dataMaps->addedFpPartitioningVerticesOnSrcMesh = std::move(addedFpPartitioningVerticesOnSrcMesh);
+    dataMaps->fpPartitionChildFaceToInputSrcMeshFace = std::move(fpPartitionChildFaceToInputSrcMeshFace);
+    dataMaps->userSrcMeshVertexCount = srcMesh->numInputVertices;
+    dataMaps->userSrcMeshFaceCount = srcMesh->numInputFaces;
+    dataMaps->internalSrcMeshVertexCount = srcMesh->mesh.number_of_vertices();
+    dataMaps->internalSrcMeshFaceCount = srcMesh->mesh.number_of_faces();
+    dataMaps->outputFloatVertices = static_cast<bool>(ctxtPtr->dispatchFlags & MC_DISPATCH_OUTPUT_VERTEX_ARRAY_FLOAT);
+
+    // the connected components of this dispatch, which are added to the context at the end (in one step, since
+    // other cut-meshes of a batch may be adding theirs concurrently).
+    // NOTE: the connected components keep the output of the kernel, which is converted into the format that is
+    // returned to the user only when they are queried (see "convertConnComp")
+    std::map<McConnectedComponent, std::unique_ptr<McConnCompBase, void (*)(McConnCompBase*)>> dispatchConnComps;
+
     //
     // sealed-fragment connected components
     //
 
-    for (std::map<mcut::connected_component_location_t, std::map<mcut::cut_surface_patch_location_t, std::vector<mcut::output_mesh_info_t>>>::const_iterator i = backendOutput.connected_components.cbegin();
-         i != backendOutput.connected_components.cend();
+    for (std::map<mcut::connected_component_location_t, std::map<mcut::cut_surface_patch_location_t, std::vector<mcut::output_mesh_info_t>>>::iterator i = backendOutput.connected_components.begin();
+         i != backendOutput.connected_components.end();
          ++i) {
 
-        for (std::map<mcut::cut_surface_patch_location_t, std::vector<mcut::output_mesh_info_t>>::const_iterator j = i->second.cbegin();
-             j != i->second.cend();
+        for (std::map<mcut::cut_surface_patch_location_t, std::vector<mcut::output_mesh_info_t>>::iterator j = i->second.begin();
+             j != i->second.end();
              ++j) {
 
-            const std::string cs_patch_loc_str = mcut::to_string(j->first);
-
-            for (std::vector<mcut::output_mesh_info_t>::const_iterator k = j->second.cbegin(); k != j->second.cend(); ++k) {
+            for (std::vector<mcut::output_mesh_info_t>::iterator k = j->second.begin(); k != j->second.end(); ++k) {
 
                 std::unique_ptr<McConnCompBase, void (*)(McConnCompBase*)> frag = std::unique_ptr<McFragmentConnComp, void (*)(McConnCompBase*)>(new McFragmentConnComp, ccDeletorFunc<McFragmentConnComp>);
                 McConnectedComponent clientHandle = reinterpret_cast<McConnectedComponent>(frag.get());
-                ctxtPtr->connComps.emplace(clientHandle, std::move(frag));
-                McFragmentConnComp* asFragPtr = dynamic_cast<McFragmentConnComp*>(ctxtPtr->connComps.at(clientHandle).get());
+                dispatchConnComps.emplace(clientHandle, std::move(frag));
+                McFragmentConnComp* asFragPtr = dynamic_cast<McFragmentConnComp*>(dispatchConnComps.at(clientHandle).get());
                 asFragPtr->type = MC_CONNECTED_COMPONENT_TYPE_FRAGMENT;
                 asFragPtr->fragmentLocation = convert(i->first);
                 asFragPtr->patchLocation = convert(j->first);
@@ -2786,10 +3693,8 @@ MCAPI_ATTR McResult MCAPI_CALL mcDispatch(
                 MCUT_ASSERT(asFragPtr->patchLocation != MC_PATCH_LOCATION_UNDEFINED);
                 asFragPtr->srcMeshSealType = McFragmentSealType::MC_FRAGMENT_SEAL_TYPE_COMPLETE;
 
-                halfedgeMeshToIndexArrayMesh(
-                    ctxtPtr, asFragPtr->indexArrayMesh, *k,
-                    addedFpPartitioningVerticesOnSrcMesh, fpPartitionChildFaceToInputSrcMeshFace, addedFpPartitioningVerticesOnCutMeshOFFSETTED, fpPartitionChildFaceToInputCutMeshFaceOFFSETTED,
-                    numSrcMeshVertices, numSrcMeshFaces, srcMeshInternal.number_of_vertices(), srcMeshInternal.number_of_faces());
+                asFragPtr->kernelMesh = std::unique_ptr<mcut::output_mesh_info_t>(new mcut::output_mesh_info_t(std::move(*k)));
+                asFragPtr->dataMaps = dataMaps;
             }
         }
     }
@@ -2797,61 +3702,58 @@ MCAPI_ATTR McResult MCAPI_CALL mcDispatch(
     //
     // unsealed connected components (fragements)
     //
-    for (std::map<mcut::connected_component_location_t, std::vector<mcut::output_mesh_info_t>>::const_iterator i = backendOutput.unsealed_cc.cbegin();
-         i != backendOutput.unsealed_cc.cend();
+    for (std::map<mcut::connected_component_location_t, std::vector<mcut::output_mesh_info_t>>::iterator i = backendOutput.unsealed_cc.begin();
+         i != backendOutput.unsealed_cc.end();
          ++i) { // for each cc location flag (above/below/undefined)
 
-        for (std::vector<mcut::output_mesh_info_t>::const_iterator j = i->second.cbegin(); j != i->second.cend(); ++j) { // for each mesh
+        for (std::vector<mcut::output_mesh_info_t>::iterator j = i->second.begin(); j != i->second.end(); ++j) { // for each mesh
 
             std::unique_ptr<McConnCompBase, void (*)(McConnCompBase*)> unsealedFrag = std::unique_ptr<McFragmentConnComp, void (*)(McConnCompBase*)>(new McFragmentConnComp, ccDeletorFunc<McFragmentConnComp>);
             McConnectedComponent clientHandle = reinterpret_cast<McConnectedComponent>(unsealedFrag.get());
-            ctxtPtr->connComps.emplace(clientHandle, std::move(unsealedFrag));
-            McFragmentConnComp* asFragPtr = dynamic_cast<McFragmentConnComp*>(ctxtPtr->connComps.at(clientHandle).get());
+            dispatchConnComps.emplace(clientHandle, std::move(unsealedFrag));
+            McFragmentConnComp* asFragPtr = dynamic_cast<McFragmentConnComp*>(dispatchConnComps.at(clientHandle).get());
             asFragPtr->type = MC_CONNECTED_COMPONENT_TYPE_FRAGMENT;
             asFragPtr->fragmentLocation = convert(i->first);
             asFragPtr->patchLocation = McPatchLocation::MC_PATCH_LOCATION_UNDEFINED;
             asFragPtr->srcMeshSealType = McFragmentSealType::MC_FRAGMENT_SEAL_TYPE_NONE;
 
-            halfedgeMeshToIndexArrayMesh(ctxtPtr, asFragPtr->indexArrayMesh, *j,
-                addedFpPartitioningVerticesOnSrcMesh, fpPartitionChildFaceToInputSrcMeshFace, addedFpPartitioningVerticesOnCutMeshOFFSETTED, fpPartitionChildFaceToInputCutMeshFaceOFFSETTED,
-                numSrcMeshVertices, numSrcMeshFaces, srcMeshInternal.number_of_vertices(), srcMeshInternal.number_of_faces());
+            asFragPtr->kernelMesh = std::unique_ptr<mcut::output_mesh_info_t>(new mcut::output_mesh_info_t(std::move(*j)));
+            asFragPtr->dataMaps = dataMaps;
         }
     }
 
     // inside patches
-    const std::vector<mcut::output_mesh_info_t>& insidePatches = backendOutput.inside_patches[mcut::cut_surface_patch_winding_order_t::DEFAULT];
+    std::vector<mcut::output_mesh_info_t>& insidePatches = backendOutput.inside_patches[mcut::cut_surface_patch_winding_order_t::DEFAULT];
 
-    for (std::vector<mcut::output_mesh_info_t>::const_iterator it = insidePatches.cbegin();
-         it != insidePatches.cend();
+    for (std::vector<mcut::output_mesh_info_t>::iterator it = insidePatches.begin();
+         it != insidePatches.end();
          ++it) {
 
         std::unique_ptr<McConnCompBase, void (*)(McConnCompBase*)> patchConnComp = std::unique_ptr<McPatchConnComp, void (*)(McConnCompBase*)>(new McPatchConnComp, ccDeletorFunc<McPatchConnComp>);
         McConnectedComponent clientHandle = reinterpret_cast<McConnectedComponent>(patchConnComp.get());
-        ctxtPtr->connComps.emplace(clientHandle, std::move(patchConnComp));
-        McPatchConnComp* asPatchPtr = dynamic_cast<McPatchConnComp*>(ctxtPtr->connComps.at(clientHandle).get());
+        dispatchConnComps.emplace(clientHandle, std::move(patchConnComp));
+        McPatchConnComp* asPatchPtr = dynamic_cast<McPatchConnComp*>(dispatchConnComps.at(clientHandle).get());
         asPatchPtr->type = MC_CONNECTED_COMPONENT_TYPE_PATCH;
         asPatchPtr->patchLocation = MC_PATCH_LOCATION_INSIDE;
 
-        halfedgeMeshToIndexArrayMesh(ctxtPtr, asPatchPtr->indexArrayMesh, *it,
-            addedFpPartitioningVerticesOnSrcMesh, fpPartitionChildFaceToInputSrcMeshFace, addedFpPartitioningVerticesOnCutMeshOFFSETTED, fpPartitionChildFaceToInputCutMeshFaceOFFSETTED,
-            numSrcMeshVertices, numSrcMeshFaces, srcMeshInternal.number_of_vertices(), srcMeshInternal.number_of_faces());
+        asPatchPtr->kernelMesh = std::unique_ptr<mcut::output_mesh_info_t>(new mcut::output_mesh_info_t(std::move(*it)));
+        asPatchPtr->dataMaps = dataMaps;
     }
 
     // outside patches
-    const std::vector<mcut::output_mesh_info_t>& outsidePatches = backendOutput.outside_patches[mcut::cut_surface_patch_winding_order_t::DEFAULT];
+    std::vector<mcut::output_mesh_info_t>& outsidePatches = backendOutput.outside_patches[mcut::cut_surface_patch_winding_order_t::DEFAULT];
 
-    for (std::vector<mcut::output_mesh_info_t>::const_iterator it = outsidePatches.cbegin(); it != outsidePatches.cend(); ++it) {
+    for (std::vector<mcut::output_mesh_info_t>::iterator it = outsidePatches.begin(); it != outsidePatches.end(); ++it) {
 
         std::unique_ptr<McConnCompBase, void (*)(McConnCompBase*)> patchConnComp = std::unique_ptr<McPatchConnComp, void (*)(McConnCompBase*)>(new McPatchConnComp, ccDeletorFunc<McPatchConnComp>);
         McConnectedComponent clientHandle = reinterpret_cast<McConnectedComponent>(patchConnComp.get());
-        ctxtPtr->connComps.emplace(clientHandle, std::move(patchConnComp));
-        McPatchConnComp* asPatchPtr = dynamic_cast<McPatchConnComp*>(ctxtPtr->connComps.at(clientHandle).get());
+        dispatchConnComps.emplace(clientHandle, std::move(patchConnComp));
+        McPatchConnComp* asPatchPtr = dynamic_cast<McPatchConnComp*>(dispatchConnComps.at(clientHandle).get());
         asPatchPtr->type = MC_CONNECTED_COMPONENT_TYPE_PATCH;
         asPatchPtr->patchLocation = MC_PATCH_LOCATION_OUTSIDE;
 
-        halfedgeMeshToIndexArrayMesh(ctxtPtr, asPatchPtr->indexArrayMesh, *it,
-            addedFpPartitioningVerticesOnSrcMesh, fpPartitionChildFaceToInputSrcMeshFace, addedFpPartitioningVerticesOnCutMeshOFFSETTED, fpPartitionChildFaceToInputCutMeshFaceOFFSETTED,
-            numSrcMeshVertices, numSrcMeshFaces, srcMeshInternal.number_of_vertices(), srcMeshInternal.number_of_faces());
+        asPatchPtr->kernelMesh = std::unique_ptr<mcut::output_mesh_info_t>(new mcut::output_mesh_info_t(std::move(*it)));
+        asPatchPtr->dataMaps = dataMaps;
     }
 
     // seam connected components
@@ -2864,13 +3766,12 @@ MCAPI_ATTR McResult MCAPI_CALL mcDispatch(
     if (backendOutput.seamed_src_mesh.mesh.number_of_faces() > 0) {
         std::unique_ptr<McConnCompBase, void (*)(McConnCompBase*)> srcMeshSeam = std::unique_ptr<McSeamConnComp, void (*)(McConnCompBase*)>(new McSeamConnComp, ccDeletorFunc<McSeamConnComp>);
         McConnectedComponent clientHandle = reinterpret_cast<McConnectedComponent>(srcMeshSeam.get());
-        ctxtPtr->connComps.emplace(clientHandle, std::move(srcMeshSeam));
-        McSeamConnComp* asSrcMeshSeamPtr = dynamic_cast<McSeamConnComp*>(ctxtPtr->connComps.at(clientHandle).get());
+        dispatchConnComps.emplace(clientHandle, std::move(srcMeshSeam));
+        McSeamConnComp* asSrcMeshSeamPtr = dynamic_cast<McSeamConnComp*>(dispatchConnComps.at(clientHandle).get());
         asSrcMeshSeamPtr->type = MC_CONNECTED_COMPONENT_TYPE_SEAM;
         asSrcMeshSeamPtr->origin = MC_SEAM_ORIGIN_SRCMESH;
-        halfedgeMeshToIndexArrayMesh(ctxtPtr, asSrcMeshSeamPtr->indexArrayMesh, backendOutput.seamed_src_mesh,
-            addedFpPartitioningVerticesOnSrcMesh, fpPartitionChildFaceToInputSrcMeshFace, addedFpPartitioningVerticesOnCutMeshOFFSETTED, fpPartitionChildFaceToInputCutMeshFaceOFFSETTED,
-            numSrcMeshVertices, numSrcMeshFaces, srcMeshInternal.number_of_vertices(), srcMeshInternal.number_of_faces());
+        asSrcMeshSeamPtr->kernelMesh = std::unique_ptr<mcut::output_mesh_info_t>(new mcut::output_mesh_info_t(std::move(backendOutput.seamed_src_mesh)));
+        asSrcMeshSeamPtr->dataMaps = dataMaps;
     }
 
     //  cut mesh
@@ -2878,14 +3779,13 @@ MCAPI_ATTR McResult MCAPI_CALL mcDispatch(
     if (backendOutput.seamed_cut_mesh.mesh.number_of_faces() > 0) {
         std::unique_ptr<McConnCompBase, void (*)(McConnCompBase*)> cutMeshSeam = std::unique_ptr<McSeamConnComp, void (*)(McConnCompBase*)>(new McSeamConnComp, ccDeletorFunc<McSeamConnComp>);
         McConnectedComponent clientHandle = reinterpret_cast<McConnectedComponent>(cutMeshSeam.get());
-        ctxtPtr->connComps.emplace(clientHandle, std::move(cutMeshSeam));
-        McSeamConnComp* asCutMeshSeamPtr = dynamic_cast<McSeamConnComp*>(ctxtPtr->connComps.at(clientHandle).get());
+        dispatchConnComps.emplace(clientHandle, std::move(cutMeshSeam));
+        McSeamConnComp* asCutMeshSeamPtr = dynamic_cast<McSeamConnComp*>(dispatchConnComps.at(clientHandle).get());
         asCutMeshSeamPtr->type = MC_CONNECTED_COMPONENT_TYPE_SEAM;
         asCutMeshSeamPtr->origin = MC_SEAM_ORIGIN_CUTMESH;
 
-        halfedgeMeshToIndexArrayMesh(ctxtPtr, asCutMeshSeamPtr->indexArrayMesh, backendOutput.seamed_cut_mesh,
-            addedFpPartitioningVerticesOnSrcMesh, fpPartitionChildFaceToInputSrcMeshFace, addedFpPartitioningVerticesOnCutMeshOFFSETTED, fpPartitionChildFaceToInputCutMeshFaceOFFSETTED,
-            numSrcMeshVertices, numSrcMeshFaces, srcMeshInternal.number_of_vertices(), srcMeshInternal.number_of_faces());
+        asCutMeshSeamPtr->kernelMesh = std::unique_ptr<mcut::output_mesh_info_t>(new mcut::output_mesh_info_t(std::move(backendOutput.seamed_cut_mesh)));
+        asCutMeshSeamPtr->dataMaps = dataMaps;
     }
 
     // input connected components
@@ -2895,65 +3795,72 @@ MCAPI_ATTR McResult MCAPI_CALL mcDispatch(
     {
         std::unique_ptr<McConnCompBase, void (*)(McConnCompBase*)> internalCutMesh = std::unique_ptr<McInputConnComp, void (*)(McConnCompBase*)>(new McInputConnComp, ccDeletorFunc<McInputConnComp>);
         McConnectedComponent clientHandle = reinterpret_cast<McConnectedComponent>(internalCutMesh.get());
-        ctxtPtr->connComps.emplace(clientHandle, std::move(internalCutMesh));
-        McInputConnComp* asCutMeshInputPtr = dynamic_cast<McInputConnComp*>(ctxtPtr->connComps.at(clientHandle).get());
+        dispatchConnComps.emplace(clientHandle, std::move(internalCutMesh));
+        McInputConnComp* asCutMeshInputPtr = dynamic_cast<McInputConnComp*>(dispatchConnComps.at(clientHandle).get());
         asCutMeshInputPtr->type = MC_CONNECTED_COMPONENT_TYPE_INPUT;
         asCutMeshInputPtr->origin = MC_INPUT_ORIGIN_CUTMESH;
 
-        mcut::output_mesh_info_t omi;
-        omi.mesh = cutMeshInternal; // naive copy (could use std::move)
+        asCutMeshInputPtr->kernelMesh = std::unique_ptr<mcut::output_mesh_info_t>(new mcut::output_mesh_info_t);
+        asCutMeshInputPtr->dataMaps = dataMaps;
+        mcut::output_mesh_info_t& internalCutMeshInfo = *asCutMeshInputPtr->kernelMesh;
+
+        internalCutMeshInfo.mesh = std::move(cutMeshInternal); // not used after this point
 
         // TODO: assume that re-adding elements (vertices and faces) e.g. prior to perturbation or partitioning is going to change the order
         // from the user-provided order. So we still need to fix the mapping, which may no longer
         // be one-to-one (even if with an sm offset ) as in the case when things do not change.
 
         if (backendInput.populate_vertex_maps) {
-            for (mcut::mesh_t::vertex_iterator_t i = cutMeshInternal.vertices_begin(); i != cutMeshInternal.vertices_end(); ++i) {
-                omi.data_maps.vertex_map[*i] = mcut::vd_t((*i) + srcMeshInternal.number_of_vertices()); // apply offset like kernel does
+            for (mcut::mesh_t::vertex_iterator_t i = internalCutMeshInfo.mesh.vertices_begin(); i != internalCutMeshInfo.mesh.vertices_end(); ++i) {
+                internalCutMeshInfo.data_maps.vertex_map[*i] = mcut::vd_t((*i) + srcMesh->mesh.number_of_vertices()); // apply offset like kernel does
             }
         }
 
         if (backendInput.populate_face_maps) {
-            for (mcut::mesh_t::face_iterator_t i = cutMeshInternal.faces_begin(); i != cutMeshInternal.faces_end(); ++i) {
-                omi.data_maps.face_map[*i] = mcut::fd_t((*i) + srcMeshInternal.number_of_faces()); // apply offset like kernel does
+            for (mcut::mesh_t::face_iterator_t i = internalCutMeshInfo.mesh.faces_begin(); i != internalCutMeshInfo.mesh.faces_end(); ++i) {
+                internalCutMeshInfo.data_maps.face_map[*i] = mcut::fd_t((*i) + srcMesh->mesh.number_of_faces()); // apply offset like kernel does
             }
         }
 
-        omi.seam_vertices = {}; // empty. an input connected component has no polygon intersection points
-
-        halfedgeMeshToIndexArrayMesh(ctxtPtr, asCutMeshInputPtr->indexArrayMesh, omi,
-            addedFpPartitioningVerticesOnSrcMesh, fpPartitionChildFaceToInputSrcMeshFace, addedFpPartitioningVerticesOnCutMeshOFFSETTED, fpPartitionChildFaceToInputCutMeshFaceOFFSETTED,
-            numSrcMeshVertices, numSrcMeshFaces, srcMeshInternal.number_of_vertices(), srcMeshInternal.number_of_faces());
+        internalCutMeshInfo.seam_vertices = {}; // empty. an input connected component has no polygon intersection points
     }
 
     // internal source-mesh (possibly with new faces and vertices)
     {
         std::unique_ptr<McConnCompBase, void (*)(McConnCompBase*)> internalSrcMesh = std::unique_ptr<McInputConnComp, void (*)(McConnCompBase*)>(new McInputConnComp, ccDeletorFunc<McInputConnComp>);
         McConnectedComponent clientHandle = reinterpret_cast<McConnectedComponent>(internalSrcMesh.get());
-        ctxtPtr->connComps.emplace(clientHandle, std::move(internalSrcMesh));
-        McInputConnComp* asSrcMeshInputPtr = dynamic_cast<McInputConnComp*>(ctxtPtr->connComps.at(clientHandle).get());
+        dispatchConnComps.emplace(clientHandle, std::move(internalSrcMesh));
+        McInputConnComp* asSrcMeshInputPtr = dynamic_cast<McInputConnComp*>(dispatchConnComps.at(clientHandle).get());
         asSrcMeshInputPtr->type = MC_CONNECTED_COMPONENT_TYPE_INPUT;
         asSrcMeshInputPtr->origin = MC_INPUT_ORIGIN_SRCMESH;
 
-        mcut::output_mesh_info_t omi;
-        omi.mesh = srcMeshInternal; // naive copy
+        asSrcMeshInputPtr->kernelMesh = std::unique_ptr<mcut::output_mesh_info_t>(new mcut::output_mesh_info_t);
+        asSrcMeshInputPtr->dataMaps = dataMaps;
+        mcut::output_mesh_info_t& internalSrcMeshInfo = *asSrcMeshInputPtr->kernelMesh;
+
+        internalSrcMeshInfo.mesh = srcMesh->mesh; // naive copy (the source mesh may be shared by the cuts of a batch)
         if (backendInput.populate_vertex_maps) {
-            for (mcut::mesh_t::vertex_iterator_t i = srcMeshInternal.vertices_begin(); i != srcMeshInternal.vertices_end(); ++i) {
-                omi.data_maps.vertex_map[*i] = *i; // one to one mapping
+            for (mcut::mesh_t::vertex_iterator_t i = srcMesh->mesh.vertices_begin(); i != srcMesh->mesh.vertices_end(); ++i) {
+                internalSrcMeshInfo.data_maps.vertex_map[*i] = *i; // one to one mapping
             }
         }
 
         if (backendInput.populate_face_maps) {
-            for (mcut::mesh_t::face_iterator_t i = srcMeshInternal.faces_begin(); i != srcMeshInternal.faces_end(); ++i) {
-                omi.data_maps.face_map[*i] = *i; // one to one mapping
+            for (mcut::mesh_t::face_iterator_t i = srcMesh->mesh.faces_begin(); i != srcMesh->mesh.faces_end(); ++i) {
+                internalSrcMeshInfo.data_maps.face_map[*i] = *i; // one to one mapping
             }
         }
 
-        omi.seam_vertices = {}; // empty. an input connected component has no polygon intersection points
+        internalSrcMeshInfo.seam_vertices = {}; // empty. an input connected component has no polygon intersection points
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(ctxtPtr->connCompsMutex);
 
-        halfedgeMeshToIndexArrayMesh(ctxtPtr, asSrcMeshInputPtr->indexArrayMesh, omi,
-            addedFpPartitioningVerticesOnSrcMesh, fpPartitionChildFaceToInputSrcMeshFace, addedFpPartitioningVerticesOnCutMeshOFFSETTED, fpPartitionChildFaceToInputCutMeshFaceOFFSETTED,
-            numSrcMeshVertices, numSrcMeshFaces, srcMeshInternal.number_of_vertices(), srcMeshInternal.number_of_faces());
+        for (std::map<McConnectedComponent, std::unique_ptr<McConnCompBase, void (*)(McConnCompBase*)>>::iterator i = dispatchConnComps.begin(); i != dispatchConnComps.end(); ++i) {
+            i->second->cutMeshIndex = cutMeshIndex;
+            ctxtPtr->connComps.emplace(i->first, std::move(i->second));
+        }
     }
 
 #if defined(MCUT_WITH_ARBITRARY_PRECISION_NUMBERS)
@@ -2964,227 +3871,1175 @@ MCAPI_ATTR McResult MCAPI_CALL mcDispatch(
     return result;
 }
 
-MCAPI_ATTR McResult MCAPI_CALL mcGetConnectedComponents(
+// the implementation of a dispatch call (see mcDispatch and mcEnqueueDispatch)
+McResult executeDispatch(
+    McDispatchContextInternal* ctxtPtr,
+    McFlags dispatchFlags,
+    const void* pSrcMeshVertices,
+    const uint32_t* pSrcMeshFaceIndices,
+    const uint32_t* pSrcMeshFaceSizes,
+    uint32_t numSrcMeshVertices,
+    uint32_t numSrcMeshFaces,
+    const void* pCutMeshVertices,
+    const uint32_t* pCutMeshFaceIndices,
+    const uint32_t* pCutMeshFaceSizes,
+    uint32_t numCutMeshVertices,
+    uint32_t numCutMeshFaces)
+{
+    DispatchSrcMesh srcMesh;
+    McResult result = prepareDispatchSrcMesh(ctxtPtr, srcMesh, dispatchFlags,
+        pSrcMeshVertices, pSrcMeshFaceIndices, pSrcMeshFaceSizes, numSrcMeshVertices, numSrcMeshFaces);
+
+    if (result != McResult::MC_NO_ERROR) {
+        return result;
+    }
+
+    result = cutDispatchSrcMesh(ctxtPtr, srcMesh,
+        pCutMeshVertices, pCutMeshFaceIndices, pCutMeshFaceSizes, numCutMeshVertices, numCutMeshFaces, 0);
+
+    return result;
+}
+
+MCAPI_ATTR McResult MCAPI_CALL mcDispatch(
     const McContext context,
-    const McConnectedComponentType connectedComponentType,
-    const uint32_t numEntries,
-    McConnectedComponent* pConnComps,
-    uint32_t* numConnComps)
+    McFlags dispatchFlags,
+    const void* pSrcMeshVertices,
+    const uint32_t* pSrcMeshFaceIndices,
+    const uint32_t* pSrcMeshFaceSizes,
+    uint32_t numSrcMeshVertices,
+    uint32_t numSrcMeshFaces,
+    const void* pCutMeshVertices,
+    const uint32_t* pCutMeshFaceIndices,
+    const uint32_t* pCutMeshFaceSizes,
+    uint32_t numCutMeshVertices,
+    uint32_t numCutMeshFaces)
 {
     McResult result = McResult::MC_NO_ERROR;
-    auto ctxtIter = gDispatchContexts.find(context);
+    McDispatchContextInternal* ctxtEntry = findDispatchContext(context);
 
-    if (ctxtIter == gDispatchContexts.cend()) {
-        std::fprintf(stderr, "err: context undefined\n");
+    // check context found
+    if (ctxtEntry == nullptr) {
+        fprintf(stderr, "err: context undefined\n");
         result = McResult::MC_INVALID_VALUE;
         return result;
     }
-    const std::unique_ptr<McDispatchContextInternal>& ctxtPtr = ctxtIter->second;
 
-    if (connectedComponentType == 0) {
-        ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "invalid type-parameter");
+    McDispatchContextInternal* ctxtPtr = ctxtEntry;
+
+    // execute after the dispatches that have been enqueued on the context
+    ctxtPtr->commands.finish();
+
+    result = executeDispatch(ctxtPtr, dispatchFlags,
+        pSrcMeshVertices, pSrcMeshFaceIndices, pSrcMeshFaceSizes, numSrcMeshVertices, numSrcMeshFaces,
+        pCutMeshVertices, pCutMeshFaceIndices, pCutMeshFaceSizes, numCutMeshVertices, numCutMeshFaces);
+
+    return result;
+}
+
+MCAPI_ATTR McResult MCAPI_CALL mcDispatchBatch(
+    const McContext context,
+    McFlags dispatchFlags,
+    const void* pSrcMeshVertices,
+    const uint32_t* pSrcMeshFaceIndices,
+    const uint32_t* pSrcMeshFaceSizes,
+    uint32_t numSrcMeshVertices,
+    uint32_t numSrcMeshFaces,
+    uint32_t numCutMeshes,
+    const void* const* ppCutMeshVertices,
+    const uint32_t* const* ppCutMeshFaceIndices,
+    const uint32_t* const* ppCutMeshFaceSizes,
+    const uint32_t* pNumCutMeshVertices,
+    const uint32_t* pNumCutMeshFaces)
+{
+    McResult result = McResult::MC_NO_ERROR;
+    McDispatchContextInternal* ctxtEntry = findDispatchContext(context);
+
+    // check context found
+    if (ctxtEntry == nullptr) {
+        fprintf(stderr, "err: context undefined\n");
         result = McResult::MC_INVALID_VALUE;
         return result;
     }
 
-    if (numConnComps == nullptr && pConnComps == nullptr) {
-        ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "null parameter");
+    McDispatchContextInternal* ctxtPtr = ctxtEntry;
+
+    if (numCutMeshes == 0 || ppCutMeshVertices == nullptr || ppCutMeshFaceIndices == nullptr || ppCutMeshFaceSizes == nullptr || pNumCutMeshVertices == nullptr || pNumCutMeshFaces == nullptr) {
+        ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "invalid cut-mesh arrays");
         result = McResult::MC_INVALID_VALUE;
         return result;
     }
 
-    if (numConnComps != nullptr) {
-        (*numConnComps) = 0;
-    }
+    // execute after the dispatches that have been enqueued on the context
+    ctxtPtr->commands.finish();
 
-    uint32_t gatheredConnCompCounter = 0;
+    DispatchSrcMesh srcMesh;
+    result = prepareDispatchSrcMesh(ctxtPtr, srcMesh, dispatchFlags,
+        pSrcMeshVertices, pSrcMeshFaceIndices, pSrcMeshFaceSizes, numSrcMeshVertices, numSrcMeshFaces);
 
-    for (std::map<McConnectedComponent, std::unique_ptr<McConnCompBase, void (*)(McConnCompBase*)>>::const_iterator i = ctxtPtr->connComps.cbegin();
-         i != ctxtPtr->connComps.cend();
-         ++i) {
+    if (result != McResult::MC_NO_ERROR) {
+        return result;
+    }
 
-        //connectedComponentType const auto& connCompHandle = i.first;
-        //if ((i->second->type & connectedComponentType)) {
+    std::vector<McResult> cutResults(numCutMeshes, McResult::MC_NO_ERROR);
 
-        bool includeConnComp = (i->second->type & connectedComponentType) != 0;
+    // NOTE: the cuts are independent of each other, so idle threads take the next cut-mesh. Each cut also
+    // uses the helper threads for its own parallel parts.
+    std::atomic<uint32_t> nextCutMesh(0);
 
-        if (includeConnComp) {
-            if (pConnComps == nullptr) // query number
-            {
-                (*numConnComps)++;
-            } else // populate pConnComps
-            {
-                pConnComps[gatheredConnCompCounter] = i->first;
-                gatheredConnCompCounter += 1;
-                if (gatheredConnCompCounter == numEntries) {
-                    break;
-                }
-            }
+    mcut::parallel_invoke(*ctxtPtr->scheduler, mcut::get_parallel_block_count(*ctxtPtr->scheduler, numCutMeshes, 1), [&](uint32_t /*thread*/) {
+        for (uint32_t i = nextCutMesh++; i < numCutMeshes; i = nextCutMesh++) {
+            cutResults[i] = cutDispatchSrcMesh(ctxtPtr, srcMesh,
+                ppCutMeshVertices[i], ppCutMeshFaceIndices[i], ppCutMeshFaceSizes[i], pNumCutMeshVertices[i], pNumCutMeshFaces[i], i);
+        }
+    });
+
+    for (uint32_t i = 0; i < numCutMeshes; ++i) {
+        if (cutResults[i] != McResult::MC_NO_ERROR) {
+            result = cutResults[i]; // first failure
+            break;
         }
-        //}
     }
 
     return result;
 }
 
-McResult MCAPI_CALL mcGetConnectedComponentData(
+// number of potentially-intersecting face pairs (found with the BVHs) that mcGetIntersectingFacePairs tests
+// exactly (in parallel) before checking whether it has found enough intersecting pairs to stop
+const uint32_t INTERSECTION_QUERY_BATCH_SIZE = 1 << 12;
+
+// whether a source-mesh face and a cut-mesh face intersect (see "compute_polygon_intersection_test")
+bool facesIntersect(const mcut::mesh_t& srcMesh, const mcut::fd_t srcMeshFace, const mcut::mesh_t& cutMesh, const mcut::fd_t cutMeshFace)
+{
+    const std::vector<mcut::vd_t> srcMeshFaceVertexDescriptors = srcMesh.get_vertices_around_face(srcMeshFace);
+    const std::vector<mcut::vd_t> cutMeshFaceVertexDescriptors = cutMesh.get_vertices_around_face(cutMeshFace);
+    std::vector<mcut::math::vec3> srcMeshFaceVertices;
+    std::vector<mcut::math::vec3> cutMeshFaceVertices;
+
+    srcMeshFaceVertices.reserve(srcMeshFaceVertexDescriptors.size());
+    cutMeshFaceVertices.reserve(cutMeshFaceVertexDescriptors.size());
+
+    for (std::vector<mcut::vd_t>::const_iterator v = srcMeshFaceVertexDescriptors.cbegin(); v != srcMeshFaceVertexDescriptors.cend(); ++v) {
+        srcMeshFaceVertices.push_back(srcMesh.vertex(*v));
+    }
+
+    for (std::vector<mcut::vd_t>::const_iterator v = cutMeshFaceVertexDescriptors.cbegin(); v != cutMeshFaceVertexDescriptors.cend(); ++v) {
+        cutMeshFaceVertices.push_back(cutMesh.vertex(*v));
+    }
+
+    return mcut::geom::compute_polygon_intersection_test(
+        srcMeshFaceVertices.data(), (int)srcMeshFaceVertices.size(),
+        cutMeshFaceVertices.data(), (int)cutMeshFaceVertices.size());
+}
+
+MCAPI_ATTR McResult MCAPI_CALL mcGetIntersectingFacePairs(
     const McContext context,
-    const McConnectedComponent connCompId,
-    McFlags queryFlags,
-    uint64_t bytes,
-    void* pMem,
-    uint64_t* pNumBytes)
+    McFlags flags,
+    const void* pSrcMeshVertices,
+    const uint32_t* pSrcMeshFaceIndices,
+    const uint32_t* pSrcMeshFaceSizes,
+    uint32_t numSrcMeshVertices,
+    uint32_t numSrcMeshFaces,
+    const void* pCutMeshVertices,
+    const uint32_t* pCutMeshFaceIndices,
+    const uint32_t* pCutMeshFaceSizes,
+    uint32_t numCutMeshVertices,
+    uint32_t numCutMeshFaces,
+    uint32_t numFacePairs,
+    uint32_t* pFacePairs,
+    uint32_t* pNumFacePairs)
 {
     McResult result = McResult::MC_NO_ERROR;
+    McDispatchContextInternal* ctxtEntry = findDispatchContext(context);
 
-    auto ctxtIter = gDispatchContexts.find(context);
-
-    if (ctxtIter == gDispatchContexts.cend()) {
-        std::fprintf(stderr, "err: context undefined\n");
+    if (ctxtEntry == nullptr) {
+        fprintf(stderr, "err: context undefined\n");
         result = McResult::MC_INVALID_VALUE;
         return result;
     }
 
-    const std::unique_ptr<McDispatchContextInternal>& ctxtPtr = ctxtIter->second;
+    McDispatchContextInternal* ctxtPtr = ctxtEntry;
 
-    if (bytes != 0 && pMem == nullptr) {
-        ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "null parameter");
+    if ((pFacePairs != nullptr && numFacePairs == 0) || (pFacePairs == nullptr && pNumFacePairs == nullptr)) {
+        ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "invalid face-pair array");
         result = McResult::MC_INVALID_VALUE;
         return result;
     }
 
-    auto ccRef = ctxtPtr->connComps.find(connCompId);
+    const McFlags vertexArrayFlags = flags & (MC_DISPATCH_VERTEX_ARRAY_FLOAT | MC_DISPATCH_VERTEX_ARRAY_DOUBLE);
 
-    if (ccRef == ctxtPtr->connComps.cend()) {
-        ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "invalid connected component id");
+    if (vertexArrayFlags != MC_DISPATCH_VERTEX_ARRAY_FLOAT && vertexArrayFlags != MC_DISPATCH_VERTEX_ARRAY_DOUBLE) {
+        ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "dispatch floating-point type unspecified");
         result = McResult::MC_INVALID_VALUE;
         return result;
     }
 
-    auto& ccData = ccRef->second;
+    // execute after the dispatches that have been enqueued on the context
+    ctxtPtr->commands.finish();
 
-    switch (queryFlags) {
-    case MC_CONNECTED_COMPONENT_DATA_VERTEX_COUNT: {
-        if (pMem == nullptr) {
-            *pNumBytes = sizeof(uint32_t);
-        } else {
-            if (bytes > sizeof(uint32_t)) {
-                ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "out of bounds memory access");
-                result = McResult::MC_INVALID_VALUE;
-                return result;
-            }
-            memcpy(pMem, reinterpret_cast<void*>(&ccData->indexArrayMesh.numVertices), bytes);
-        }
-    } break;
-    case MC_CONNECTED_COMPONENT_DATA_VERTEX_FLOAT: {
-        const uint64_t allocatedBytes = ccData->indexArrayMesh.numVertices * sizeof(float) * 3;
-        if (pMem == nullptr) {
-            *pNumBytes = allocatedBytes;
-        } else { // copy mem to client ptr
+    // NOTE: the meshes are built as for a dispatch call, but the dispatch flags of the context are unchanged
+    DispatchSrcMesh srcMesh;
+    result = buildDispatchSrcMesh(ctxtPtr, srcMesh, vertexArrayFlags,
+        pSrcMeshVertices, pSrcMeshFaceIndices, pSrcMeshFaceSizes, numSrcMeshVertices, numSrcMeshFaces);
 
-            if (bytes > allocatedBytes) {
-                ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "out of bounds memory access");
-                result = McResult::MC_INVALID_VALUE;
-                return result;
-            } // if
+    if (result != McResult::MC_NO_ERROR) {
+        return result;
+    }
 
-            uint64_t off = 0;
-            float* outPtr = reinterpret_cast<float*>(pMem);
-            uint64_t nelems = (uint64_t)(bytes / sizeof(float));
+    DispatchSrcMesh cutMesh;
+    result = buildDispatchSrcMesh(ctxtPtr, cutMesh, vertexArrayFlags,
+        pCutMeshVertices, pCutMeshFaceIndices, pCutMeshFaceSizes, numCutMeshVertices, numCutMeshFaces);
 
-            if (nelems % 3 != 0) {
-                ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "invalid number of bytes");
-                result = McResult::MC_INVALID_VALUE;
-                return result;
-            }
+    if (result != McResult::MC_NO_ERROR) {
+        return result;
+    }
 
-            for (uint32_t i = 0; i < nelems; ++i) {
-                const mcut::math::real_number_t& val = ccData->indexArrayMesh.pVertices[i];
-#if !defined(MCUT_WITH_ARBITRARY_PRECISION_NUMBERS)
-                const float val_ = static_cast<float>(val);
-#else
-                const float val_ = static_cast<float>(val.to_double());
-#endif
-                memcpy(outPtr + off, reinterpret_cast<const void*>(&val_), sizeof(float));
-                off += 1;
-            }
+    std::vector<std::pair<mcut::fd_t, mcut::fd_t>> candidateFacePairs;
+    intersectOIBVHs(*ctxtPtr->scheduler, candidateFacePairs, srcMesh.bvhAABBs, srcMesh.bvhLeafNodeFaces, cutMesh.bvhAABBs, cutMesh.bvhLeafNodeFaces, nullptr, true);
 
-            MCUT_ASSERT((off * sizeof(float)) == allocatedBytes);
-        }
-    } break;
-    case MC_CONNECTED_COMPONENT_DATA_VERTEX_DOUBLE: {
-        const uint64_t allocatedBytes = ccData->indexArrayMesh.numVertices * sizeof(double) * 3;
-        if (pMem == nullptr) {
-            *pNumBytes = allocatedBytes;
-        } else { // copy mem to client ptr
+    ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_OTHER, 0, McDebugSeverity::MC_DEBUG_SEVERITY_NOTIFICATION, "Polygon-pairs found = " + std::to_string(candidateFacePairs.size()));
 
-            if (bytes > allocatedBytes) {
-                ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "out of bounds memory access");
-                result = McResult::MC_INVALID_VALUE;
-                return result;
-            } // if
+    // test the candidate pairs exactly in batches (in their BVH traversal order), and stop
+    // once "numFacePairs" intersecting pairs have been found
+    const uint32_t numCandidateFacePairs = (uint32_t)candidateFacePairs.size();
+    std::vector<char> isIntersectingBatch;
+    uint32_t numFoundFacePairs = 0;
+    bool done = false;
 
-            uint64_t byteOffset = 0;
-            double* outPtr = reinterpret_cast<double*>(pMem);
+    for (uint32_t batchBegin = 0; batchBegin < numCandidateFacePairs && !done; batchBegin += INTERSECTION_QUERY_BATCH_SIZE) {
+        const uint32_t batchSize = std::min(numCandidateFacePairs - batchBegin, INTERSECTION_QUERY_BATCH_SIZE);
 
-            uint64_t nelems = (uint64_t)(bytes / sizeof(double));
+        isIntersectingBatch.assign(batchSize, 0);
 
-            if (nelems % 3 != 0) {
-                ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "invalid number of bytes");
-                result = McResult::MC_INVALID_VALUE;
-                return result;
+        mcut::parallel_for(*ctxtPtr->scheduler, batchSize, 256, [&](uint32_t begin, uint32_t end) {
+            for (uint32_t i = begin; i < end; ++i) {
+                const std::pair<mcut::fd_t, mcut::fd_t>& facePair = candidateFacePairs[batchBegin + i];
+                isIntersectingBatch[i] = facesIntersect(srcMesh.mesh, facePair.first, cutMesh.mesh, facePair.second);
             }
+        });
 
-            //uint32_t verticesToCopy = (uint32_t)(nelems / 3);
-
-            for (uint32_t i = 0; i < nelems; ++i) {
-                const mcut::math::real_number_t& val = ccData->indexArrayMesh.pVertices[i];
-#if !defined(MCUT_WITH_ARBITRARY_PRECISION_NUMBERS)
-                const double val_ = static_cast<double>(val);
-#else
-                const double val_ = static_cast<double>(val.to_double());
-#endif
-                memcpy(outPtr + byteOffset, reinterpret_cast<const void*>(&val_), sizeof(double));
-                byteOffset += 1;
+        for (uint32_t i = 0; i < batchSize && !done; ++i) {
+            if (!isIntersectingBatch[i]) {
+                continue;
             }
 
-            MCUT_ASSERT((byteOffset * sizeof(double)) == allocatedBytes);
-        }
-    } break;
-    case MC_CONNECTED_COMPONENT_DATA_FACE_COUNT: {
-        if (pMem == nullptr) {
-            *pNumBytes = sizeof(uint32_t);
-        } else {
-            if (bytes > sizeof(uint32_t)) {
-                ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "out of bounds memory access");
-                result = McResult::MC_INVALID_VALUE;
-                return result;
+            if (pFacePairs != nullptr) {
+                const std::pair<mcut::fd_t, mcut::fd_t>& facePair = candidateFacePairs[batchBegin + i];
+                pFacePairs[(numFoundFacePairs * 2) + 0] = (uint32_t)facePair.first;
+                pFacePairs[(numFoundFacePairs * 2) + 1] = (uint32_t)facePair.second;
             }
 
-            if (bytes % sizeof(uint32_t) != 0) {
-                ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "invalid number of bytes");
-                result = McResult::MC_INVALID_VALUE;
-                return result;
-            }
-            memcpy(pMem, reinterpret_cast<void*>(&ccData->indexArrayMesh.numFaces), bytes);
+            numFoundFacePairs++;
+            done = (numFacePairs != 0 && numFoundFacePairs == numFacePairs);
         }
-    } break;
-    case MC_CONNECTED_COMPONENT_DATA_FACE: {
-        if (pMem == nullptr) {
-            MCUT_ASSERT(ccData->indexArrayMesh.numFaceIndices > 0);
-            *pNumBytes = ccData->indexArrayMesh.numFaceIndices * sizeof(uint32_t);
-        } else {
-            if (bytes > ccData->indexArrayMesh.numFaceIndices * sizeof(uint32_t)) {
-                ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "out of bounds memory access");
-                result = McResult::MC_INVALID_VALUE;
-                return result;
-            }
+    }
 
-            if (bytes % sizeof(uint32_t) != 0) {
-                ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "invalid number of bytes");
-                result = McResult::MC_INVALID_VALUE;
-                return result;
-            }
+    if (pNumFacePairs != nullptr) {
+        *pNumFacePairs = numFoundFacePairs;
+    }
+
+    return result;
+}
+
+// validate the vertex type and arrays of a mesh that is passed to mcCreateMesh or mcUpdateMesh, and build it
+McResult createMeshInternal(
+    McDispatchContextInternal* ctxtPtr,
+    McMeshInternal& mesh,
+    McFlags flags,
+    const void* pVertices,
+    const uint32_t* pFaceIndices,
+    const uint32_t* pFaceSizes,
+    uint32_t numVertices,
+    uint32_t numFaces)
+{
+    McResult result = McResult::MC_NO_ERROR;
+
+    const McFlags vertexArrayFlags = flags & (MC_DISPATCH_VERTEX_ARRAY_FLOAT | MC_DISPATCH_VERTEX_ARRAY_DOUBLE);
+
+    if (vertexArrayFlags != MC_DISPATCH_VERTEX_ARRAY_FLOAT && vertexArrayFlags != MC_DISPATCH_VERTEX_ARRAY_DOUBLE) {
+        ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "mesh floating-point type unspecified");
+        result = McResult::MC_INVALID_VALUE;
+        return result;
+    }
+
+    std::shared_ptr<DispatchSrcMesh> newSrcMesh = std::make_shared<DispatchSrcMesh>();
+    result = buildDispatchSrcMesh(ctxtPtr, *newSrcMesh, vertexArrayFlags, pVertices, pFaceIndices, pFaceSizes, numVertices, numFaces);
+
+    if (result == McResult::MC_NO_ERROR) {
+        mesh.bvhBuildCost = getOIBVHCost(newSrcMesh->bvhAABBs, (int)numFaces);
+        mesh.srcMesh = std::move(newSrcMesh);
+        mesh.restVertices.clear(); // i.e. no transform
+        mesh.transformIsApplied = false;
+    }
+
+    return result;
+}
+
+MCAPI_ATTR McResult MCAPI_CALL mcCreateMesh(
+    const McContext context,
+    McFlags flags,
+    const void* pVertices,
+    const uint32_t* pFaceIndices,
+    const uint32_t* pFaceSizes,
+    uint32_t numVertices,
+    uint32_t numFaces,
+    McMesh* pMesh)
+{
+    McResult result = McResult::MC_NO_ERROR;
+    McDispatchContextInternal* ctxtEntry = findDispatchContext(context);
+
+    if (ctxtEntry == nullptr) {
+        fprintf(stderr, "err: context undefined\n");
+        result = McResult::MC_INVALID_VALUE;
+        return result;
+    }
+
+    McDispatchContextInternal* ctxtPtr = ctxtEntry;
+
+    if (pMesh == nullptr) {
+        ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "null parameter");
+        result = McResult::MC_INVALID_VALUE;
+        return result;
+    }
+
+    std::unique_ptr<McMeshInternal> mesh = std::unique_ptr<McMeshInternal>(new McMeshInternal);
+    result = createMeshInternal(ctxtPtr, *mesh, flags, pVertices, pFaceIndices, pFaceSizes, numVertices, numFaces);
+
+    if (result != McResult::MC_NO_ERROR) {
+        return result;
+    }
+
+    McMesh handle = reinterpret_cast<McMesh>(mesh.get());
+    ctxtPtr->meshes.emplace(handle, std::move(mesh));
+    *pMesh = handle;
+
+    return result;
+}
+
+MCAPI_ATTR McResult MCAPI_CALL mcUpdateMesh(
+    const McContext context,
+    McMesh mesh,
+    McFlags flags,
+    const void* pVertices,
+    const uint32_t* pFaceIndices,
+    const uint32_t* pFaceSizes,
+    uint32_t numVertices,
+    uint32_t numFaces)
+{
+    McResult result = McResult::MC_NO_ERROR;
+    McDispatchContextInternal* ctxtEntry = findDispatchContext(context);
+
+    if (ctxtEntry == nullptr) {
+        fprintf(stderr, "err: context undefined\n");
+        result = McResult::MC_INVALID_VALUE;
+        return result;
+    }
+
+    McDispatchContextInternal* ctxtPtr = ctxtEntry;
+
+    auto meshIter = ctxtPtr->meshes.find(mesh);
+
+    if (meshIter == ctxtPtr->meshes.end()) {
+        ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "invalid mesh id");
+        result = McResult::MC_INVALID_VALUE;
+        return result;
+    }
+
+    // execute after the dispatches that have been enqueued on the context
+    ctxtPtr->commands.finish();
+
+    // NOTE: the mesh is unchanged if the new arrays are invalid
+    result = createMeshInternal(ctxtPtr, *meshIter->second, flags, pVertices, pFaceIndices, pFaceSizes, numVertices, numFaces);
+
+    return result;
+}
+
+// move the vertices of a mesh (in the order that they were passed to mcCreateMesh) and refit its
+// BVH, which is rebuilt instead if refitting makes it too costly to traverse
+void moveMeshVertices(
+    McDispatchContextInternal* ctxtPtr,
+    McMeshInternal& mesh,
+    const std::vector<mcut::math::vec3>& vertices)
+{
+    DispatchSrcMesh& srcMesh = *mesh.srcMesh;
+
+    MCUT_ASSERT(vertices.size() == srcMesh.numInputVertices);
+
+    for (uint32_t i = 0; i < srcMesh.numInputVertices; ++i) {
+        srcMesh.mesh.set_vertex(mcut::vd_t(i), vertices[i]);
+    }
+
+    refitOIBVH(*ctxtPtr->scheduler, srcMesh.mesh, srcMesh.bvhAABBs, srcMesh.bvhLeafNodeFaces);
+
+    const double bvhCost = getOIBVHCost(srcMesh.bvhAABBs, (int)srcMesh.numInputFaces);
+
+    if (bvhCost > (mesh.bvhBuildCost * OIBVH_MAX_REFIT_COST_RATIO)) {
+        ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_OTHER, 0, McDebugSeverity::MC_DEBUG_SEVERITY_NOTIFICATION, "Rebuild source-mesh BVH (cost = " + std::to_string(bvhCost) + ")");
+
+        srcMesh.bvhAABBs.clear();
+        srcMesh.bvhLeafNodeFaces.clear();
+        constructOIBVH(*ctxtPtr->scheduler, srcMesh.mesh, srcMesh.bvhAABBs, srcMesh.bvhLeafNodeFaces);
+        mesh.bvhBuildCost = getOIBVHCost(srcMesh.bvhAABBs, (int)srcMesh.numInputFaces);
+    }
+}
+
+// move the vertices of a mesh by its transform, if this has not been done since the transform was set
+void applyMeshTransform(
+    McDispatchContextInternal* ctxtPtr,
+    McMeshInternal& mesh)
+{
+    if (mesh.restVertices.empty() || mesh.transformIsApplied) {
+        return;
+    }
+
+    const uint32_t numVertices = mesh.srcMesh->numInputVertices;
+    std::vector<mcut::math::vec3> vertices;
+    vertices.reserve(numVertices);
+
+    for (uint32_t i = 0; i < numVertices; ++i) {
+        vertices.push_back(transformMeshVertex(mesh.transform, mesh.restVertices[i]));
+    }
+
+    moveMeshVertices(ctxtPtr, mesh, vertices);
+    mesh.transformIsApplied = true;
+}
+
+MCAPI_ATTR McResult MCAPI_CALL mcRefitMesh(
+    const McContext context,
+    McMesh mesh,
+    McFlags flags,
+    const void* pVertices)
+{
+    McResult result = McResult::MC_NO_ERROR;
+    McDispatchContextInternal* ctxtEntry = findDispatchContext(context);
+
+    if (ctxtEntry == nullptr) {
+        fprintf(stderr, "err: context undefined\n");
+        result = McResult::MC_INVALID_VALUE;
+        return result;
+    }
+
+    McDispatchContextInternal* ctxtPtr = ctxtEntry;
+
+    auto meshIter = ctxtPtr->meshes.find(mesh);
+
+    if (meshIter == ctxtPtr->meshes.end()) {
+        ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "invalid mesh id");
+        result = McResult::MC_INVALID_VALUE;
+        return result;
+    }
+
+    if (pVertices == nullptr) {
+        ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "vertex array ptr undefined");
+        result = McResult::MC_INVALID_VALUE;
+        return result;
+    }
+
+    const McFlags vertexArrayFlags = flags & (MC_DISPATCH_VERTEX_ARRAY_FLOAT | MC_DISPATCH_VERTEX_ARRAY_DOUBLE);
+
+    if (vertexArrayFlags != MC_DISPATCH_VERTEX_ARRAY_FLOAT && vertexArrayFlags != MC_DISPATCH_VERTEX_ARRAY_DOUBLE) {
+        ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "mesh floating-point type unspecified");
+        result = McResult::MC_INVALID_VALUE;
+        return result;
+    }
+
+    // execute after the dispatches that have been enqueued on the context
+    ctxtPtr->commands.finish();
+
+    McMeshInternal& meshInternal = *meshIter->second;
+    const uint32_t numVertices = meshInternal.srcMesh->numInputVertices;
+    std::vector<mcut::math::vec3> vertices;
+    vertices.reserve(numVertices);
+
+    for (uint32_t i = 0; i < numVertices; ++i) {
+        if (vertexArrayFlags & MC_DISPATCH_VERTEX_ARRAY_FLOAT) {
+            const float* vptr = reinterpret_cast<const float*>(pVertices) + (i * 3);
+            vertices.emplace_back(vptr[0], vptr[1], vptr[2]);
+        } else {
+            const double* vptr = reinterpret_cast<const double*>(pVertices) + (i * 3);
+            vertices.emplace_back(vptr[0], vptr[1], vptr[2]);
+        }
+    }
+
+    if (!meshInternal.restVertices.empty()) { // the mesh has a transform
+        meshInternal.restVertices = vertices;
+
+        if (meshInternal.transformIsApplied) {
+            for (uint32_t i = 0; i < numVertices; ++i) {
+                vertices[i] = transformMeshVertex(meshInternal.transform, meshInternal.restVertices[i]);
+            }
+        }
+    }
+
+    moveMeshVertices(ctxtPtr, meshInternal, vertices);
+
+    return result;
+}
+
+MCAPI_ATTR McResult MCAPI_CALL mcSetMeshTransform(
+    const McContext context,
+    McMesh mesh,
+    const double* pTransform)
+{
+    McResult result = McResult::MC_NO_ERROR;
+    McDispatchContextInternal* ctxtEntry = findDispatchContext(context);
+
+    if (ctxtEntry == nullptr) {
+        fprintf(stderr, "err: context undefined\n");
+        result = McResult::MC_INVALID_VALUE;
+        return result;
+    }
+
+    McDispatchContextInternal* ctxtPtr = ctxtEntry;
+
+    auto meshIter = ctxtPtr->meshes.find(mesh);
+
+    if (meshIter == ctxtPtr->meshes.end()) {
+        ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "invalid mesh id");
+        result = McResult::MC_INVALID_VALUE;
+        return result;
+    }
+
+    if (pTransform != nullptr && !isAffineTransform(pTransform)) {
+        ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "transform is not affine");
+        result = McResult::MC_INVALID_VALUE;
+        return result;
+    }
+
+    // execute after the dispatches that have been enqueued on the context
+    ctxtPtr->commands.finish();
+
+    McMeshInternal& meshInternal = *meshIter->second;
+    const uint32_t numVertices = meshInternal.srcMesh->numInputVertices;
+
+    if (meshInternal.restVertices.empty() || !meshInternal.transformIsApplied) { // i.e. the current vertices are untransformed
+        if (pTransform == nullptr) {
+            meshInternal.restVertices.clear();
+            meshInternal.transformIsApplied = false;
+            return result;
+        }
+
+        if (meshInternal.restVertices.empty()) {
+            meshInternal.restVertices.reserve(numVertices);
+
+            for (uint32_t i = 0; i < numVertices; ++i) {
+                meshInternal.restVertices.push_back(meshInternal.srcMesh->mesh.vertex(mcut::vd_t(i)));
+            }
+        }
+
+        // NOTE: the vertices (and BVH) are only moved when the mesh is cut as a source-mesh, so
+        // that a mesh which is only used as a cut-mesh (e.g. a moving tool) is never refitted
+        std::copy(pTransform, pTransform + 16, meshInternal.transform);
+        meshInternal.transformIsApplied = false;
+        return result;
+    }
+
+    std::vector<mcut::math::vec3> vertices;
+
+    if (pTransform == nullptr) { // i.e. the identity
+        vertices.swap(meshInternal.restVertices);
+        meshInternal.transformIsApplied = false;
+    } else {
+        std::copy(pTransform, pTransform + 16, meshInternal.transform);
+        vertices.reserve(numVertices);
+
+        for (uint32_t i = 0; i < numVertices; ++i) {
+            vertices.push_back(transformMeshVertex(meshInternal.transform, meshInternal.restVertices[i]));
+        }
+    }
+
+    moveMeshVertices(ctxtPtr, meshInternal, vertices);
+
+    return result;
+}
+
+MCAPI_ATTR McResult MCAPI_CALL mcDispatchMesh(
+    const McContext context,
+    McFlags dispatchFlags,
+    McMesh srcMesh,
+    const void* pCutMeshVertices,
+    const uint32_t* pCutMeshFaceIndices,
+    const uint32_t* pCutMeshFaceSizes,
+    uint32_t numCutMeshVertices,
+    uint32_t numCutMeshFaces)
+{
+    McResult result = McResult::MC_NO_ERROR;
+    McDispatchContextInternal* ctxtEntry = findDispatchContext(context);
+
+    if (ctxtEntry == nullptr) {
+        fprintf(stderr, "err: context undefined\n");
+        result = McResult::MC_INVALID_VALUE;
+        return result;
+    }
+
+    McDispatchContextInternal* ctxtPtr = ctxtEntry;
+
+    auto meshIter = ctxtPtr->meshes.find(srcMesh);
+
+    if (meshIter == ctxtPtr->meshes.end()) {
+        ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "invalid mesh id");
+        result = McResult::MC_INVALID_VALUE;
+        return result;
+    }
+
+    // execute after the dispatches that have been enqueued on the context
+    ctxtPtr->commands.finish();
+
+    result = applyDispatchFlags(ctxtPtr, dispatchFlags);
+
+    if (result != McResult::MC_NO_ERROR) {
+        return result;
+    }
+
+    applyMeshTransform(ctxtPtr, *meshIter->second);
+
+    // NOTE: the source-mesh is already checked and built (with its BVH)
+    const std::shared_ptr<const DispatchSrcMesh> srcMeshInternal = meshIter->second->srcMesh;
+
+    result = cutDispatchSrcMesh(ctxtPtr, *srcMeshInternal,
+        pCutMeshVertices, pCutMeshFaceIndices, pCutMeshFaceSizes, numCutMeshVertices, numCutMeshFaces, 0);
+
+    return result;
+}
+
+MCAPI_ATTR McResult MCAPI_CALL mcDispatchMeshes(
+    const McContext context,
+    McFlags dispatchFlags,
+    McMesh srcMesh,
+    McMesh cutMesh,
+    const double* pCutMeshTransform)
+{
+    McResult result = McResult::MC_NO_ERROR;
+    McDispatchContextInternal* ctxtEntry = findDispatchContext(context);
+
+    if (ctxtEntry == nullptr) {
+        fprintf(stderr, "err: context undefined\n");
+        result = McResult::MC_INVALID_VALUE;
+        return result;
+    }
+
+    McDispatchContextInternal* ctxtPtr = ctxtEntry;
+
+    auto srcMeshIter = ctxtPtr->meshes.find(srcMesh);
+    auto cutMeshIter = ctxtPtr->meshes.find(cutMesh);
+
+    if (srcMeshIter == ctxtPtr->meshes.end() || cutMeshIter == ctxtPtr->meshes.end()) {
+        ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "invalid mesh id");
+        result = McResult::MC_INVALID_VALUE;
+        return result;
+    }
+
+    if (pCutMeshTransform != nullptr && !isAffineTransform(pCutMeshTransform)) {
+        ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "transform is not affine");
+        result = McResult::MC_INVALID_VALUE;
+        return result;
+    }
+
+    // execute after the dispatches that have been enqueued on the context
+    ctxtPtr->commands.finish();
+
+    // NOTE: the floating-point type flags are not required since there are no vertex arrays
+    result = applyDispatchFlags(ctxtPtr, dispatchFlags, false);
+
+    if (result != McResult::MC_NO_ERROR) {
+        return result;
+    }
+
+    applyMeshTransform(ctxtPtr, *srcMeshIter->second);
+
+    const McMeshInternal& cutMeshHandle = *cutMeshIter->second;
+    double cutMeshTransform[16];
+
+    // the transform of the cut-mesh is applied to its BVH (and its placed copy) with "pCutMeshTransform"
+    if (!cutMeshHandle.restVertices.empty() && !cutMeshHandle.transformIsApplied) {
+        if (pCutMeshTransform == nullptr) {
+            std::copy(cutMeshHandle.transform, cutMeshHandle.transform + 16, cutMeshTransform);
+        } else {
+            multiplyAffineTransforms(cutMeshTransform, pCutMeshTransform, cutMeshHandle.transform);
+        }
+
+        pCutMeshTransform = cutMeshTransform;
+    }
+
+    const std::shared_ptr<const DispatchSrcMesh> srcMeshInternal = srcMeshIter->second->srcMesh;
+    const std::shared_ptr<const DispatchSrcMesh> cutMeshInternal = cutMeshHandle.srcMesh;
+
+    result = cutDispatchSrcMesh(ctxtPtr, *srcMeshInternal, nullptr, nullptr, nullptr, 0, 0, 0, cutMeshInternal.get(), pCutMeshTransform);
+
+    return result;
+}
+
+MCAPI_ATTR McResult MCAPI_CALL mcReleaseMeshes(
+    const McContext context,
+    uint32_t numMeshes,
+    const McMesh* pMeshes)
+{
+    McResult result = McResult::MC_NO_ERROR;
+    McDispatchContextInternal* ctxtEntry = findDispatchContext(context);
+
+    if (ctxtEntry == nullptr) {
+        std::fprintf(stderr, "err: context undefined\n");
+        result = McResult::MC_INVALID_VALUE;
+        return result;
+    }
+
+    McDispatchContextInternal* ctxtPtr = ctxtEntry;
+
+    // the enqueued dispatches may refer to the meshes
+    ctxtPtr->commands.finish();
+
+    if ((numMeshes == 0) != (pMeshes == nullptr)) {
+        ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "invalid mesh list");
+        result = McResult::MC_INVALID_VALUE;
+        return result;
+    }
+
+    if (numMeshes == 0) { // i.e. all meshes
+        ctxtPtr->meshes.clear();
+        return result;
+    }
+
+    for (uint32_t i = 0; i < numMeshes; ++i) {
+        auto meshIter = ctxtPtr->meshes.find(pMeshes[i]);
+
+        if (meshIter == ctxtPtr->meshes.end()) {
+            ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "invalid mesh id");
+            result = McResult::MC_INVALID_VALUE;
+            return result;
+        }
+
+        ctxtPtr->meshes.erase(meshIter);
+    }
+
+    return result;
+}
+
+MCAPI_ATTR McResult MCAPI_CALL mcEnqueueDispatch(
+    const McContext context,
+    McFlags dispatchFlags,
+    const void* pSrcMeshVertices,
+    const uint32_t* pSrcMeshFaceIndices,
+    const uint32_t* pSrcMeshFaceSizes,
+    uint32_t numSrcMeshVertices,
+    uint32_t numSrcMeshFaces,
+    const void* pCutMeshVertices,
+    const uint32_t* pCutMeshFaceIndices,
+    const uint32_t* pCutMeshFaceSizes,
+    uint32_t numCutMeshVertices,
+    uint32_t numCutMeshFaces,
+    McEvent* pEvent)
+{
+    McResult result = McResult::MC_NO_ERROR;
+    McDispatchContextInternal* ctxtEntry = findDispatchContext(context);
+
+    // check context found
+    if (ctxtEntry == nullptr) {
+        fprintf(stderr, "err: context undefined\n");
+        result = McResult::MC_INVALID_VALUE;
+        return result;
+    }
+
+    std::shared_ptr<McEventInternal> event = std::make_shared<McEventInternal>();
+    event->context = context;
+
+    if (pEvent != nullptr) {
+        McEvent handle = reinterpret_cast<McEvent>(event.get());
+        {
+            std::lock_guard<std::mutex> lock(gEventsMutex);
+            gEvents.emplace(handle, event);
+        }
+        *pEvent = handle;
+    }
+
+    // NOTE: "ctxtEntry" remains valid while the command is pending because mcReleaseContext waits
+    // for pending commands before releasing the context
+    ctxtEntry->commands.enqueue([=]() {
+        event->setRunning();
+
+        McResult dispatchResult = McResult::MC_NO_ERROR;
+
+        // NOTE: an exception must not escape to the thread of the queue, since the event would never complete
+        try {
+            dispatchResult = executeDispatch(ctxtEntry, dispatchFlags,
+                pSrcMeshVertices, pSrcMeshFaceIndices, pSrcMeshFaceSizes, numSrcMeshVertices, numSrcMeshFaces,
+                pCutMeshVertices, pCutMeshFaceIndices, pCutMeshFaceSizes, numCutMeshVertices, numCutMeshFaces);
+        } catch (const std::bad_alloc&) {
+            ctxtEntry->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "enqueued dispatch ran out of memory");
+            dispatchResult = McResult::MC_OUT_OF_MEMORY;
+        } catch (...) {
+            ctxtEntry->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "enqueued dispatch failed with an exception");
+            dispatchResult = McResult::MC_INVALID_OPERATION;
+        }
+
+        event->setComplete(dispatchResult);
+    });
+
+    return result;
+}
+
+MCAPI_ATTR McResult MCAPI_CALL mcWaitForEvents(uint32_t numEvents, const McEvent* pEventList)
+{
+    McResult result = McResult::MC_NO_ERROR;
+
+    if (pEventList == nullptr || numEvents == 0) {
+        std::fprintf(stderr, "err: invalid event list\n");
+        result = McResult::MC_INVALID_VALUE;
+        return result;
+    }
+
+    std::vector<std::shared_ptr<McEventInternal>> events(numEvents);
+
+    for (uint32_t i = 0; i < numEvents; ++i) {
+        events[i] = findEvent(pEventList[i]);
+
+        if (events[i] == nullptr) {
+            std::fprintf(stderr, "err: event undefined\n");
+            result = McResult::MC_INVALID_VALUE;
+            return result;
+        }
+    }
+
+    for (uint32_t i = 0; i < numEvents; ++i) {
+        const McResult commandResult = events[i]->wait();
+
+        if (result == McResult::MC_NO_ERROR) {
+            result = commandResult; // first failure
+        }
+    }
+
+    return result;
+}
+
+MCAPI_ATTR McResult MCAPI_CALL mcGetEventInfo(const McEvent event, McFlags info, uint64_t bytes, void* pMem, uint64_t* pNumBytes)
+{
+    McResult result = McResult::MC_NO_ERROR;
+    std::shared_ptr<McEventInternal> eventPtr = findEvent(event);
+
+    if (eventPtr == nullptr) {
+        std::fprintf(stderr, "err: event undefined\n");
+        result = McResult::MC_INVALID_VALUE;
+        return result;
+    }
+
+    if ((pMem == nullptr && pNumBytes == nullptr) || (bytes != 0 && pMem == nullptr)) {
+        std::fprintf(stderr, "err: invalid output memory\n");
+        result = McResult::MC_INVALID_VALUE;
+        return result;
+    }
+
+    switch (info) {
+    case MC_EVENT_COMMAND_EXECUTION_STATUS: {
+        const McEventCommandExecStatus status = eventPtr->getCommandExecStatus();
+        if (pMem == nullptr) {
+            *pNumBytes = sizeof(status);
+        } else {
+            if (bytes > sizeof(status)) {
+                result = McResult::MC_INVALID_VALUE;
+                return result;
+            }
+            memcpy(pMem, reinterpret_cast<const void*>(&status), bytes);
+        }
+    } break;
+    case MC_EVENT_RUNTIME_EXECUTION_STATUS: {
+        const McResult runtimeStatus = eventPtr->getRuntimeExecStatus();
+        if (pMem == nullptr) {
+            *pNumBytes = sizeof(runtimeStatus);
+        } else {
+            if (bytes > sizeof(runtimeStatus)) {
+                result = McResult::MC_INVALID_VALUE;
+                return result;
+            }
+            memcpy(pMem, reinterpret_cast<const void*>(&runtimeStatus), bytes);
+        }
+    } break;
+    case MC_EVENT_CONTEXT: {
+        if (pMem == nullptr) {
+            *pNumBytes = sizeof(eventPtr->context);
+        } else {
+            if (bytes > sizeof(eventPtr->context)) {
+                result = McResult::MC_INVALID_VALUE;
+                return result;
+            }
+            memcpy(pMem, reinterpret_cast<const void*>(&eventPtr->context), bytes);
+        }
+    } break;
+    default:
+        std::fprintf(stderr, "err: unknown event info\n");
+        result = McResult::MC_INVALID_VALUE;
+        break;
+    }
+
+    return result;
+}
+
+MCAPI_ATTR McResult MCAPI_CALL mcSetEventCallback(McEvent event, pfn_McEvent_CALLBACK eventCallback, void* data)
+{
+    McResult result = McResult::MC_NO_ERROR;
+
+    if (eventCallback == nullptr) {
+        std::fprintf(stderr, "err: null callback parameter\n");
+        result = McResult::MC_INVALID_VALUE;
+        return result;
+    }
+
+    std::shared_ptr<McEventInternal> eventPtr = findEvent(event);
+
+    if (eventPtr == nullptr) {
+        std::fprintf(stderr, "err: event undefined\n");
+        result = McResult::MC_INVALID_VALUE;
+        return result;
+    }
+
+    eventPtr->addCallback(eventCallback, data);
+
+    return result;
+}
+
+MCAPI_ATTR McResult MCAPI_CALL mcReleaseEvents(uint32_t numEvents, const McEvent* pEvents)
+{
+    McResult result = McResult::MC_NO_ERROR;
+
+    if (pEvents == nullptr || numEvents == 0) {
+        std::fprintf(stderr, "err: invalid event list\n");
+        result = McResult::MC_INVALID_VALUE;
+        return result;
+    }
+
+    std::lock_guard<std::mutex> lock(gEventsMutex);
+
+    for (uint32_t i = 0; i < numEvents; ++i) {
+        auto eventIter = gEvents.find(pEvents[i]);
+
+        if (eventIter == gEvents.end()) {
+            std::fprintf(stderr, "err: event undefined\n");
+            result = McResult::MC_INVALID_VALUE;
+            return result;
+        }
+
+        gEvents.erase(eventIter); // the command keeps its reference until it is complete
+    }
+
+    return result;
+}
+
+MCAPI_ATTR McResult MCAPI_CALL mcGetConnectedComponents(
+    const McContext context,
+    const McConnectedComponentType connectedComponentType,
+    const uint32_t numEntries,
+    McConnectedComponent* pConnComps,
+    uint32_t* numConnComps)
+{
+    McResult result = McResult::MC_NO_ERROR;
+    McDispatchContextInternal* ctxtEntry = findDispatchContext(context);
+
+    if (ctxtEntry == nullptr) {
+        std::fprintf(stderr, "err: context undefined\n");
+        result = McResult::MC_INVALID_VALUE;
+        return result;
+    }
+    McDispatchContextInternal* ctxtPtr = ctxtEntry;
+
+    if (connectedComponentType == 0) {
+        ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "invalid type-parameter");
+        result = McResult::MC_INVALID_VALUE;
+        return result;
+    }
+
+    if (numConnComps == nullptr && pConnComps == nullptr) {
+        ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "null parameter");
+        result = McResult::MC_INVALID_VALUE;
+        return result;
+    }
+
+    if (numConnComps != nullptr) {
+        (*numConnComps) = 0;
+    }
+
+    uint32_t gatheredConnCompCounter = 0;
+
+    // NOTE: enqueued dispatches may add connected components while they are gathered
+    std::lock_guard<std::mutex> lock(ctxtPtr->connCompsMutex);
+
+    for (std::map<McConnectedComponent, std::unique_ptr<McConnCompBase, void (*)(McConnCompBase*)>>::const_iterator i = ctxtPtr->connComps.cbegin();
+         i != ctxtPtr->connComps.cend();
+         ++i) {
+
+        //connectedComponentType const auto& connCompHandle = i.first;
+        //if ((i->second->type & connectedComponentType)) {
+
+        bool includeConnComp = (i->second->type & connectedComponentType) != 0;
+
+        if (includeConnComp) {
+            if (pConnComps == nullptr) // query number
+            {
+                (*numConnComps)++;
+            } else // populate pConnComps
+            {
+                pConnComps[gatheredConnCompCounter] = i->first;
+                gatheredConnCompCounter += 1;
+                if (gatheredConnCompCounter == numEntries) {
+                    break;
+                }
+            }
+        }
+        //}
+    }
+
+    return result;
+}
+
+McResult MCAPI_CALL mcGetConnectedComponentData(
+    const McContext context,
+    const McConnectedComponent connCompId,
+    McFlags queryFlags,
+    uint64_t bytes,
+    void* pMem,
+    uint64_t* pNumBytes)
+{
+    McResult result = McResult::MC_NO_ERROR;
+
+    McDispatchContextInternal* ctxtEntry = findDispatchContext(context);
+
+    if (ctxtEntry == nullptr) {
+        std::fprintf(stderr, "err: context undefined\n");
+        result = McResult::MC_INVALID_VALUE;
+        return result;
+    }
+
+    McDispatchContextInternal* ctxtPtr = ctxtEntry;
+
+    if (bytes != 0 && pMem == nullptr) {
+        ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "null parameter");
+        result = McResult::MC_INVALID_VALUE;
+        return result;
+    }
+
+    McConnCompBase* ccData = ctxtPtr->findConnComp(connCompId);
+
+    if (ccData == nullptr) {
+        ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "invalid connected component id");
+        result = McResult::MC_INVALID_VALUE;
+        return result;
+    }
+
+    // NOTE: connected components are converted when they are first queried
+    result = convertConnComp(ctxtPtr, *ccData);
+
+    if (result != McResult::MC_NO_ERROR) {
+        return result;
+    }
+
+    switch (queryFlags) {
+    case MC_CONNECTED_COMPONENT_DATA_VERTEX_COUNT: {
+        if (pMem == nullptr) {
+            *pNumBytes = sizeof(uint32_t);
+        } else {
+            if (bytes > sizeof(uint32_t)) {
+                ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "out of bounds memory access");
+                result = McResult::MC_INVALID_VALUE;
+                return result;
+            }
+            memcpy(pMem, reinterpret_cast<void*>(&ccData->indexArrayMesh.numVertices), bytes);
+        }
+    } break;
+    case MC_CONNECTED_COMPONENT_DATA_VERTEX_FLOAT: {
+        const uint64_t allocatedBytes = ccData->indexArrayMesh.numVertices * sizeof(float) * 3;
+        if (pMem == nullptr) {
+            *pNumBytes = allocatedBytes;
+        } else { // copy mem to client ptr
+
+            if (bytes > allocatedBytes) {
+                ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "out of bounds memory access");
+                result = McResult::MC_INVALID_VALUE;
+                return result;
+            } // if
+
+            uint64_t off = 0;
+            float* outPtr = reinterpret_cast<float*>(pMem);
+            uint64_t nelems = (uint64_t)(bytes / sizeof(float));
+
+            if (nelems % 3 != 0) {
+                ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "invalid number of bytes");
+                result = McResult::MC_INVALID_VALUE;
+                return result;
+            }
+
+            for (uint32_t i = 0; i < nelems; ++i) {
+                const float val_ = getVertexCoordinate<float>(ccData->indexArrayMesh, i);
+                memcpy(outPtr + off, reinterpret_cast<const void*>(&val_), sizeof(float));
+                off += 1;
+            }
+
+            MCUT_ASSERT((off * sizeof(float)) == allocatedBytes);
+        }
+    } break;
+    case MC_CONNECTED_COMPONENT_DATA_VERTEX_DOUBLE: {
+        const uint64_t allocatedBytes = ccData->indexArrayMesh.numVertices * sizeof(double) * 3;
+        if (pMem == nullptr) {
+            *pNumBytes = allocatedBytes;
+        } else { // copy mem to client ptr
+
+            if (bytes > allocatedBytes) {
+                ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "out of bounds memory access");
+                result = McResult::MC_INVALID_VALUE;
+                return result;
+            } // if
+
+            uint64_t byteOffset = 0;
+            double* outPtr = reinterpret_cast<double*>(pMem);
+
+            uint64_t nelems = (uint64_t)(bytes / sizeof(double));
+
+            if (nelems % 3 != 0) {
+                ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "invalid number of bytes");
+                result = McResult::MC_INVALID_VALUE;
+                return result;
+            }
+
+            //uint32_t verticesToCopy = (uint32_t)(nelems / 3);
+
+            for (uint32_t i = 0; i < nelems; ++i) {
+                const double val_ = getVertexCoordinate<double>(ccData->indexArrayMesh, i);
+                memcpy(outPtr + byteOffset, reinterpret_cast<const void*>(&val_), sizeof(double));
+                byteOffset += 1;
+            }
+
+            MCUT_ASSERT((byteOffset * sizeof(double)) == allocatedBytes);
+        }
+    } break;
+    case MC_CONNECTED_COMPONENT_DATA_FACE_COUNT: {
+        if (pMem == nullptr) {
+            *pNumBytes = sizeof(uint32_t);
+        } else {
+            if (bytes > sizeof(uint32_t)) {
+                ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "out of bounds memory access");
+                result = McResult::MC_INVALID_VALUE;
+                return result;
+            }
+
+            if (bytes % sizeof(uint32_t) != 0) {
+                ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "invalid number of bytes");
+                result = McResult::MC_INVALID_VALUE;
+                return result;
+            }
+            memcpy(pMem, reinterpret_cast<void*>(&ccData->indexArrayMesh.numFaces), bytes);
+        }
+    } break;
+    case MC_CONNECTED_COMPONENT_DATA_FACE: {
+        if (pMem == nullptr) {
+            MCUT_ASSERT(ccData->indexArrayMesh.numFaceIndices > 0);
+            *pNumBytes = ccData->indexArrayMesh.numFaceIndices * sizeof(uint32_t);
+        } else {
+            if (bytes > ccData->indexArrayMesh.numFaceIndices * sizeof(uint32_t)) {
+                ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "out of bounds memory access");
+                result = McResult::MC_INVALID_VALUE;
+                return result;
+            }
+
+            if (bytes % sizeof(uint32_t) != 0) {
+                ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "invalid number of bytes");
+                result = McResult::MC_INVALID_VALUE;
+                return result;
+            }
 
             memcpy(pMem, reinterpret_cast<void*>(ccData->indexArrayMesh.pFaceIndices.get()), bytes);
         }
@@ -3285,7 +5140,7 @@ McResult MCAPI_CALL mcGetConnectedComponentData(
                 return result;
             }
 
-            McFragmentConnComp* fragPtr = dynamic_cast<McFragmentConnComp*>(ccData.get());
+            McFragmentConnComp* fragPtr = dynamic_cast<McFragmentConnComp*>(ccData);
             memcpy(pMem, reinterpret_cast<void*>(&fragPtr->fragmentLocation), bytes);
         }
     } break;
@@ -3314,10 +5169,10 @@ McResult MCAPI_CALL mcGetConnectedComponentData(
 
             const void* src = nullptr;
             if (ccData->type == MC_CONNECTED_COMPONENT_TYPE_FRAGMENT) {
-                src = reinterpret_cast<const void*>(&dynamic_cast<McFragmentConnComp*>(ccData.get())->patchLocation);
+                src = reinterpret_cast<const void*>(&dynamic_cast<McFragmentConnComp*>(ccData)->patchLocation);
             } else {
                 MCUT_ASSERT(ccData->type == MC_CONNECTED_COMPONENT_TYPE_PATCH);
-                src = reinterpret_cast<const void*>(&dynamic_cast<McPatchConnComp*>(ccData.get())->patchLocation);
+                src = reinterpret_cast<const void*>(&dynamic_cast<McPatchConnComp*>(ccData)->patchLocation);
             }
             memcpy(pMem, src, bytes);
         }
@@ -3343,9 +5198,21 @@ McResult MCAPI_CALL mcGetConnectedComponentData(
                 result = McResult::MC_INVALID_VALUE;
                 return result;
             }
-            McFragmentConnComp* fragPtr = dynamic_cast<McFragmentConnComp*>(ccData.get());
+            McFragmentConnComp* fragPtr = dynamic_cast<McFragmentConnComp*>(ccData);
             memcpy(pMem, reinterpret_cast<void*>(&fragPtr->srcMeshSealType), bytes);
         }
+    } break;
+    case MC_CONNECTED_COMPONENT_DATA_CUT_MESH_INDEX: {
+        if (pMem == nullptr) {
+            *pNumBytes = sizeof(uint32_t);
+        } else {
+            if (bytes > sizeof(uint32_t)) {
+                ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "out of bounds memory access");
+                result = McResult::MC_INVALID_VALUE;
+                return result;
+            }
+            memcpy(pMem, reinterpret_cast<void*>(&ccData->cutMeshIndex), bytes);
+        }
     } break;
         //
     case MC_CONNECTED_COMPONENT_DATA_ORIGIN: {
@@ -3360,38 +5227,85 @@ McResult MCAPI_CALL mcGetConnectedComponentData(
         if (pMem == nullptr) {
             *pNumBytes = nbytes;
         } else {
-            if (bytes > nbytes) {
+            if (bytes > nbytes) {
+                ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "out of bounds memory access");
+                result = McResult::MC_INVALID_VALUE;
+                return result;
+            }
+
+            if ((bytes % nbytes) != 0) {
+                ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "invalid number of bytes");
+                result = McResult::MC_INVALID_VALUE;
+                return result;
+            }
+
+            if (ccData->type == MC_CONNECTED_COMPONENT_TYPE_SEAM) {
+                McSeamConnComp* ptr = dynamic_cast<McSeamConnComp*>(ccData);
+                memcpy(pMem, reinterpret_cast<void*>(&ptr->origin), bytes);
+            } else {
+                McInputConnComp* ptr = dynamic_cast<McInputConnComp*>(ccData);
+                memcpy(pMem, reinterpret_cast<void*>(&ptr->origin), bytes);
+            }
+        }
+    } break;
+    case MC_CONNECTED_COMPONENT_DATA_SEAM_VERTEX: {
+        if (ccData->type == MC_CONNECTED_COMPONENT_TYPE_INPUT) {
+            ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "cannot query seam vertices on input connected component");
+            result = McResult::MC_INVALID_VALUE;
+            return result;
+        }
+
+        if (pMem == nullptr) {
+            *pNumBytes = ccData->indexArrayMesh.numSeamVertexIndices * sizeof(uint32_t); // each face has a size (num verts)
+        } else {
+            if (bytes > ccData->indexArrayMesh.numSeamVertexIndices * sizeof(uint32_t)) {
+                ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "out of bounds memory access");
+                result = McResult::MC_INVALID_VALUE;
+                return result;
+            }
+
+            if (bytes % (sizeof(uint32_t)) != 0) {
+                ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "invalid number of bytes");
+                result = McResult::MC_INVALID_VALUE;
+                return result;
+            }
+            memcpy(pMem, reinterpret_cast<void*>(ccData->indexArrayMesh.pSeamVertexIndices.get()), bytes);
+        }
+    } break;
+    case MC_CONNECTED_COMPONENT_DATA_VERTEX_MAP: {
+        if ((ctxtPtr->dispatchFlags & MC_DISPATCH_INCLUDE_VERTEX_MAP) == 0) {
+            ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_MEDIUM, "dispatch flags not set");
+            result = McResult::MC_INVALID_VALUE;
+            return result;
+        }
+        if (pMem == nullptr) {
+            *pNumBytes = ccData->indexArrayMesh.numVertices * sizeof(uint32_t); // each each vertex has a map value (intersection point == uint_max)
+        } else {
+            if (bytes > ccData->indexArrayMesh.numVertices * sizeof(uint32_t)) {
                 ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "out of bounds memory access");
                 result = McResult::MC_INVALID_VALUE;
                 return result;
             }
 
-            if ((bytes % nbytes) != 0) {
+            if (bytes % (sizeof(uint32_t)) != 0) {
                 ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "invalid number of bytes");
                 result = McResult::MC_INVALID_VALUE;
                 return result;
             }
-
-            if (ccData->type == MC_CONNECTED_COMPONENT_TYPE_SEAM) {
-                McSeamConnComp* ptr = dynamic_cast<McSeamConnComp*>(ccData.get());
-                memcpy(pMem, reinterpret_cast<void*>(&ptr->origin), bytes);
-            } else {
-                McInputConnComp* ptr = dynamic_cast<McInputConnComp*>(ccData.get());
-                memcpy(pMem, reinterpret_cast<void*>(&ptr->origin), bytes);
-            }
+            memcpy(pMem, reinterpret_cast<void*>(ccData->indexArrayMesh.pVertexMapIndices.get()), bytes);
         }
     } break;
-    case MC_CONNECTED_COMPONENT_DATA_SEAM_VERTEX: {
-        if (ccData->type == MC_CONNECTED_COMPONENT_TYPE_INPUT) {
-            ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "cannot query seam vertices on input connected component");
+    case MC_CONNECTED_COMPONENT_DATA_FACE_MAP: {
+        if ((ctxtPtr->dispatchFlags & MC_DISPATCH_INCLUDE_FACE_MAP) == 0) {
+            ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_MEDIUM, "dispatch flags not set");
             result = McResult::MC_INVALID_VALUE;
             return result;
         }
 
         if (pMem == nullptr) {
-            *pNumBytes = ccData->indexArrayMesh.numSeamVertexIndices * sizeof(uint32_t); // each face has a size (num verts)
+            *pNumBytes = ccData->indexArrayMesh.numFaces * sizeof(uint32_t); // each each vertex has a map value (intersection point == uint_max)
         } else {
-            if (bytes > ccData->indexArrayMesh.numSeamVertexIndices * sizeof(uint32_t)) {
+            if (bytes > ccData->indexArrayMesh.numFaces * sizeof(uint32_t)) {
                 ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "out of bounds memory access");
                 result = McResult::MC_INVALID_VALUE;
                 return result;
@@ -3402,19 +5316,20 @@ McResult MCAPI_CALL mcGetConnectedComponentData(
                 result = McResult::MC_INVALID_VALUE;
                 return result;
             }
-            memcpy(pMem, reinterpret_cast<void*>(ccData->indexArrayMesh.pSeamVertexIndices.get()), bytes);
+            memcpy(pMem, reinterpret_cast<void*>(ccData->indexArrayMesh.pFaceMapIndices.get()), bytes);
         }
     } break;
-    case MC_CONNECTED_COMPONENT_DATA_VERTEX_MAP: {
-        if ((ctxtPtr->dispatchFlags & MC_DISPATCH_INCLUDE_VERTEX_MAP) == 0) {
-            ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_MEDIUM, "dispatch flags not set");
-            result = McResult::MC_INVALID_VALUE;
+    case MC_CONNECTED_COMPONENT_DATA_FACE_TRIANGULATION: {
+        result = triangulateConnComp(ctxtPtr, *ccData);
+
+        if (result != McResult::MC_NO_ERROR) {
             return result;
         }
+
         if (pMem == nullptr) {
-            *pNumBytes = ccData->indexArrayMesh.numVertices * sizeof(uint32_t); // each each vertex has a map value (intersection point == uint_max)
+            *pNumBytes = ccData->indexArrayMesh.numFaceTriangulationIndices * sizeof(uint32_t);
         } else {
-            if (bytes > ccData->indexArrayMesh.numVertices * sizeof(uint32_t)) {
+            if (bytes > ccData->indexArrayMesh.numFaceTriangulationIndices * sizeof(uint32_t)) {
                 ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "out of bounds memory access");
                 result = McResult::MC_INVALID_VALUE;
                 return result;
@@ -3425,20 +5340,28 @@ McResult MCAPI_CALL mcGetConnectedComponentData(
                 result = McResult::MC_INVALID_VALUE;
                 return result;
             }
-            memcpy(pMem, reinterpret_cast<void*>(ccData->indexArrayMesh.pVertexMapIndices.get()), bytes);
+            memcpy(pMem, reinterpret_cast<void*>(ccData->indexArrayMesh.pFaceTriangulation.get()), bytes);
         }
     } break;
-    case MC_CONNECTED_COMPONENT_DATA_FACE_MAP: {
+    case MC_CONNECTED_COMPONENT_DATA_FACE_TRIANGULATION_MAP: {
         if ((ctxtPtr->dispatchFlags & MC_DISPATCH_INCLUDE_FACE_MAP) == 0) {
             ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_MEDIUM, "dispatch flags not set");
             result = McResult::MC_INVALID_VALUE;
             return result;
         }
 
+        result = triangulateConnComp(ctxtPtr, *ccData);
+
+        if (result != McResult::MC_NO_ERROR) {
+            return result;
+        }
+
+        const uint32_t numTriangles = ccData->indexArrayMesh.numFaceTriangulationIndices / 3;
+
         if (pMem == nullptr) {
-            *pNumBytes = ccData->indexArrayMesh.numFaces * sizeof(uint32_t); // each each vertex has a map value (intersection point == uint_max)
+            *pNumBytes = numTriangles * sizeof(uint32_t);
         } else {
-            if (bytes > ccData->indexArrayMesh.numFaces * sizeof(uint32_t)) {
+            if (bytes > numTriangles * sizeof(uint32_t)) {
                 ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "out of bounds memory access");
                 result = McResult::MC_INVALID_VALUE;
                 return result;
@@ -3449,7 +5372,7 @@ McResult MCAPI_CALL mcGetConnectedComponentData(
                 result = McResult::MC_INVALID_VALUE;
                 return result;
             }
-            memcpy(pMem, reinterpret_cast<void*>(ccData->indexArrayMesh.pFaceMapIndices.get()), bytes);
+            memcpy(pMem, reinterpret_cast<void*>(ccData->indexArrayMesh.pFaceTriangulationMap.get()), bytes);
         }
     } break;
     default:
@@ -3460,21 +5383,396 @@ McResult MCAPI_CALL mcGetConnectedComponentData(
     return result;
 }
 
+// convert the internal vertex array of a connected component to floating-point type "T"
+template <typename T>
+McResult mapConnCompVertices(
+    McDispatchContextInternal* ctxtPtr,
+    McConnCompBase& connComp,
+    OutputArray<T>& mappedVertices)
+{
+    McResult result = McResult::MC_NO_ERROR;
+
+    std::lock_guard<std::mutex> lock(connComp.conversionMutex);
+
+    if (mappedVertices != nullptr) {
+        return result; // already mapped
+    }
+
+    const size_t nelems = (size_t)connComp.indexArrayMesh.numVertices * 3u;
+
+    try {
+        mappedVertices = allocateOutputArray<T>(ctxtPtr->connCompAllocator, nelems);
+    } catch (const std::bad_alloc&) {
+        ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "failed to allocate connected component data");
+        result = McResult::MC_OUT_OF_MEMORY;
+        return result;
+    }
+
+    for (size_t i = 0; i < nelems; ++i) {
+        mappedVertices[i] = getVertexCoordinate<T>(connComp.indexArrayMesh, i);
+    }
+
+    return result;
+}
+
+// get a pointer to the data of a (converted) connected component, see mcMapConnectedComponentData
+McResult mapConnCompData(
+    McDispatchContextInternal* ctxtPtr,
+    McConnCompBase& ccData,
+    McFlags queryFlags,
+    const void** ppMem,
+    uint64_t* pNumBytes)
+{
+    McResult result = McResult::MC_NO_ERROR;
+
+    const IndexArrayMesh& indexArrayMesh = ccData.indexArrayMesh;
+    const void* pMem = nullptr;
+    uint64_t numBytes = 0;
+
+    switch (queryFlags) {
+    case MC_CONNECTED_COMPONENT_DATA_VERTEX_FLOAT: {
+        if (indexArrayMesh.pVerticesFloat != nullptr) {
+            pMem = indexArrayMesh.pVerticesFloat.get(); // already an array of floats
+        } else {
+            result = mapConnCompVertices(ctxtPtr, ccData, ccData.mappedVerticesFloat);
+            pMem = ccData.mappedVerticesFloat.get();
+        }
+        numBytes = (uint64_t)indexArrayMesh.numVertices * sizeof(float) * 3;
+    } break;
+    case MC_CONNECTED_COMPONENT_DATA_VERTEX_DOUBLE: {
+#if !defined(MCUT_WITH_ARBITRARY_PRECISION_NUMBERS)
+        if (indexArrayMesh.pVertices != nullptr) {
+            pMem = indexArrayMesh.pVertices.get(); // already an array of doubles
+        } else
+#endif // #if !defined(MCUT_WITH_ARBITRARY_PRECISION_NUMBERS)
+        {
+            result = mapConnCompVertices(ctxtPtr, ccData, ccData.mappedVerticesDouble);
+            pMem = ccData.mappedVerticesDouble.get();
+        }
+        numBytes = (uint64_t)indexArrayMesh.numVertices * sizeof(double) * 3;
+    } break;
+    case MC_CONNECTED_COMPONENT_DATA_FACE: {
+        pMem = indexArrayMesh.pFaceIndices.get();
+        numBytes = (uint64_t)indexArrayMesh.numFaceIndices * sizeof(uint32_t);
+    } break;
+    case MC_CONNECTED_COMPONENT_DATA_FACE_SIZE: {
+        pMem = indexArrayMesh.pFaceSizes.get();
+        numBytes = (uint64_t)indexArrayMesh.numFaces * sizeof(uint32_t);
+    } break;
+    case MC_CONNECTED_COMPONENT_DATA_EDGE: {
+        pMem = indexArrayMesh.pEdges.get();
+        numBytes = (uint64_t)indexArrayMesh.numEdgeIndices * sizeof(uint32_t);
+    } break;
+    case MC_CONNECTED_COMPONENT_DATA_SEAM_VERTEX: {
+        if (ccData.type == MC_CONNECTED_COMPONENT_TYPE_INPUT) {
+            ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "cannot query seam vertices on input connected component");
+            result = McResult::MC_INVALID_VALUE;
+            return result;
+        }
+        pMem = indexArrayMesh.pSeamVertexIndices.get();
+        numBytes = (uint64_t)indexArrayMesh.numSeamVertexIndices * sizeof(uint32_t);
+    } break;
+    case MC_CONNECTED_COMPONENT_DATA_VERTEX_MAP: {
+        if ((ctxtPtr->dispatchFlags & MC_DISPATCH_INCLUDE_VERTEX_MAP) == 0) {
+            ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_MEDIUM, "dispatch flags not set");
+            result = McResult::MC_INVALID_VALUE;
+            return result;
+        }
+        pMem = indexArrayMesh.pVertexMapIndices.get();
+        numBytes = (uint64_t)indexArrayMesh.numVertices * sizeof(uint32_t);
+    } break;
+    case MC_CONNECTED_COMPONENT_DATA_FACE_MAP: {
+        if ((ctxtPtr->dispatchFlags & MC_DISPATCH_INCLUDE_FACE_MAP) == 0) {
+            ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_MEDIUM, "dispatch flags not set");
+            result = McResult::MC_INVALID_VALUE;
+            return result;
+        }
+        pMem = indexArrayMesh.pFaceMapIndices.get();
+        numBytes = (uint64_t)indexArrayMesh.numFaces * sizeof(uint32_t);
+    } break;
+    case MC_CONNECTED_COMPONENT_DATA_FACE_TRIANGULATION: {
+        result = triangulateConnComp(ctxtPtr, ccData);
+        pMem = indexArrayMesh.pFaceTriangulation.get();
+        numBytes = (uint64_t)indexArrayMesh.numFaceTriangulationIndices * sizeof(uint32_t);
+    } break;
+    case MC_CONNECTED_COMPONENT_DATA_FACE_TRIANGULATION_MAP: {
+        if ((ctxtPtr->dispatchFlags & MC_DISPATCH_INCLUDE_FACE_MAP) == 0) {
+            ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_MEDIUM, "dispatch flags not set");
+            result = McResult::MC_INVALID_VALUE;
+            return result;
+        }
+        result = triangulateConnComp(ctxtPtr, ccData);
+        pMem = indexArrayMesh.pFaceTriangulationMap.get();
+        numBytes = (uint64_t)(indexArrayMesh.numFaceTriangulationIndices / 3) * sizeof(uint32_t);
+    } break;
+    default:
+        ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "invalid enum flag (cannot be mapped)");
+        result = McResult::MC_INVALID_VALUE;
+        return result;
+    }
+
+    if (result != McResult::MC_NO_ERROR) {
+        return result;
+    }
+
+    *ppMem = (numBytes > 0) ? pMem : nullptr;
+
+    if (pNumBytes != nullptr) {
+        *pNumBytes = numBytes;
+    }
+
+    return result;
+}
+
+MCAPI_ATTR McResult MCAPI_CALL mcMapConnectedComponentData(
+    const McContext context,
+    const McConnectedComponent connCompId,
+    McFlags queryFlags,
+    const void** ppMem,
+    uint64_t* pNumBytes)
+{
+    McResult result = McResult::MC_NO_ERROR;
+
+    McDispatchContextInternal* ctxtEntry = findDispatchContext(context);
+
+    if (ctxtEntry == nullptr) {
+        std::fprintf(stderr, "err: context undefined\n");
+        result = McResult::MC_INVALID_VALUE;
+        return result;
+    }
+
+    McDispatchContextInternal* ctxtPtr = ctxtEntry;
+
+    if (ppMem == nullptr) {
+        ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "null parameter");
+        result = McResult::MC_INVALID_VALUE;
+        return result;
+    }
+
+    McConnCompBase* ccPtr = ctxtPtr->findConnComp(connCompId);
+
+    if (ccPtr == nullptr) {
+        ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "invalid connected component id");
+        result = McResult::MC_INVALID_VALUE;
+        return result;
+    }
+
+    McConnCompBase& ccData = *ccPtr;
+
+    result = convertConnComp(ctxtPtr, ccData);
+
+    if (result != McResult::MC_NO_ERROR) {
+        return result;
+    }
+
+    return mapConnCompData(ctxtPtr, ccData, queryFlags, ppMem, pNumBytes);
+}
+
+MCAPI_ATTR McResult MCAPI_CALL mcGetConnectedComponentsData(
+    const McContext context,
+    uint32_t numConnComps,
+    const McConnectedComponent* pConnComps,
+    McFlags queryFlags,
+    McConnectedComponentDataDesc* pDescs)
+{
+    McResult result = McResult::MC_NO_ERROR;
+
+    McDispatchContextInternal* ctxtEntry = findDispatchContext(context);
+
+    if (ctxtEntry == nullptr) {
+        std::fprintf(stderr, "err: context undefined\n");
+        result = McResult::MC_INVALID_VALUE;
+        return result;
+    }
+
+    McDispatchContextInternal* ctxtPtr = ctxtEntry;
+
+    if (numConnComps > 0 && (pConnComps == nullptr || pDescs == nullptr)) {
+        ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "null parameter");
+        result = McResult::MC_INVALID_VALUE;
+        return result;
+    }
+
+    // the counts are always returned
+    const McFlags countFlags = MC_CONNECTED_COMPONENT_DATA_VERTEX_COUNT | MC_CONNECTED_COMPONENT_DATA_FACE_COUNT | MC_CONNECTED_COMPONENT_DATA_EDGE_COUNT;
+    const McFlags arrayFlags = MC_CONNECTED_COMPONENT_DATA_VERTEX_FLOAT | MC_CONNECTED_COMPONENT_DATA_VERTEX_DOUBLE | MC_CONNECTED_COMPONENT_DATA_FACE | //
+        MC_CONNECTED_COMPONENT_DATA_FACE_SIZE | MC_CONNECTED_COMPONENT_DATA_EDGE | MC_CONNECTED_COMPONENT_DATA_SEAM_VERTEX | //
+        MC_CONNECTED_COMPONENT_DATA_VERTEX_MAP | MC_CONNECTED_COMPONENT_DATA_FACE_MAP | MC_CONNECTED_COMPONENT_DATA_FACE_TRIANGULATION | //
+        MC_CONNECTED_COMPONENT_DATA_FACE_TRIANGULATION_MAP;
+
+    if ((queryFlags & ~(countFlags | arrayFlags)) != 0) {
+        ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "invalid enum flag (cannot be mapped)");
+        result = McResult::MC_INVALID_VALUE;
+        return result;
+    }
+
+    std::vector<McConnCompBase*> connComps(numConnComps);
+
+    for (uint32_t i = 0; i < numConnComps; ++i) {
+        connComps[i] = ctxtPtr->findConnComp(pConnComps[i]);
+
+        if (connComps[i] == nullptr) {
+            ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "invalid connected component id");
+            result = McResult::MC_INVALID_VALUE;
+            return result;
+        }
+    }
+
+    // NOTE: the conversions are independent of each other, so idle threads take the next unconverted connected component
+    std::vector<McResult> conversionResults(numConnComps, McResult::MC_NO_ERROR);
+    std::atomic<uint32_t> nextConnComp(0);
+
+    mcut::parallel_invoke(*ctxtPtr->scheduler, mcut::get_parallel_block_count(*ctxtPtr->scheduler, numConnComps, 1), [&](uint32_t /*thread*/) {
+        for (uint32_t i = nextConnComp++; i < numConnComps; i = nextConnComp++) {
+            conversionResults[i] = convertConnComp(ctxtPtr, *connComps[i]);
+        }
+    });
+
+    for (uint32_t i = 0; i < numConnComps; ++i) {
+        if (conversionResults[i] != McResult::MC_NO_ERROR) {
+            result = conversionResults[i];
+            return result;
+        }
+
+        McConnCompBase& ccData = *connComps[i];
+        McConnectedComponentDataDesc& desc = pDescs[i];
+
+        desc = McConnectedComponentDataDesc();
+        desc.type = ccData.type;
+        desc.cutMeshIndex = ccData.cutMeshIndex;
+        desc.numVertices = ccData.indexArrayMesh.numVertices;
+        desc.numFaces = ccData.indexArrayMesh.numFaces;
+        desc.numFaceIndices = ccData.indexArrayMesh.numFaceIndices;
+        desc.numEdges = ccData.indexArrayMesh.numEdgeIndices / 2;
+        desc.numSeamVertices = 0;
+
+        // the mapped arrays, in the order of the flag bits
+        const void** ppMems[] = {
+            reinterpret_cast<const void**>(&desc.pVerticesFloat),
+            reinterpret_cast<const void**>(&desc.pVerticesDouble),
+            reinterpret_cast<const void**>(&desc.pFaceIndices),
+            reinterpret_cast<const void**>(&desc.pFaceSizes),
+            reinterpret_cast<const void**>(&desc.pEdges),
+            reinterpret_cast<const void**>(&desc.pSeamVertexIndices),
+            reinterpret_cast<const void**>(&desc.pVertexMap),
+            reinterpret_cast<const void**>(&desc.pFaceMap),
+            reinterpret_cast<const void**>(&desc.pFaceTriangulation),
+            reinterpret_cast<const void**>(&desc.pFaceTriangulationMap)
+        };
+        const McConnectedComponentData mappedFlags[] = {
+            MC_CONNECTED_COMPONENT_DATA_VERTEX_FLOAT,
+            MC_CONNECTED_COMPONENT_DATA_VERTEX_DOUBLE,
+            MC_CONNECTED_COMPONENT_DATA_FACE,
+            MC_CONNECTED_COMPONENT_DATA_FACE_SIZE,
+            MC_CONNECTED_COMPONENT_DATA_EDGE,
+            MC_CONNECTED_COMPONENT_DATA_SEAM_VERTEX,
+            MC_CONNECTED_COMPONENT_DATA_VERTEX_MAP,
+            MC_CONNECTED_COMPONENT_DATA_FACE_MAP,
+            MC_CONNECTED_COMPONENT_DATA_FACE_TRIANGULATION,
+            MC_CONNECTED_COMPONENT_DATA_FACE_TRIANGULATION_MAP
+        };
+
+        for (uint32_t j = 0; j < (uint32_t)(sizeof(mappedFlags) / sizeof(mappedFlags[0])); ++j) {
+            if ((queryFlags & mappedFlags[j]) == 0) {
+                continue;
+            }
+
+            if (mappedFlags[j] == MC_CONNECTED_COMPONENT_DATA_SEAM_VERTEX && ccData.type == MC_CONNECTED_COMPONENT_TYPE_INPUT) {
+                continue; // input connected components have no seam vertices
+            }
+
+            result = mapConnCompData(ctxtPtr, ccData, mappedFlags[j], ppMems[j], nullptr);
+
+            if (result != McResult::MC_NO_ERROR) {
+                return result;
+            }
+        }
+
+        if (desc.pSeamVertexIndices != nullptr) {
+            desc.numSeamVertices = ccData.indexArrayMesh.numSeamVertexIndices;
+        }
+
+        if ((queryFlags & (MC_CONNECTED_COMPONENT_DATA_FACE_TRIANGULATION | MC_CONNECTED_COMPONENT_DATA_FACE_TRIANGULATION_MAP)) != 0) {
+            desc.numTriangles = ccData.indexArrayMesh.numFaceTriangulationIndices / 3;
+        }
+    }
+
+    return result;
+}
+
+MCAPI_ATTR McResult MCAPI_CALL mcUnmapConnectedComponentData(
+    const McContext context,
+    const McConnectedComponent connCompId,
+    McFlags queryFlags)
+{
+    McResult result = McResult::MC_NO_ERROR;
+
+    McDispatchContextInternal* ctxtEntry = findDispatchContext(context);
+
+    if (ctxtEntry == nullptr) {
+        std::fprintf(stderr, "err: context undefined\n");
+        result = McResult::MC_INVALID_VALUE;
+        return result;
+    }
+
+    McDispatchContextInternal* ctxtPtr = ctxtEntry;
+
+    McConnCompBase* ccPtr = ctxtPtr->findConnComp(connCompId);
+
+    if (ccPtr == nullptr) {
+        ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "invalid connected component id");
+        result = McResult::MC_INVALID_VALUE;
+        return result;
+    }
+
+    McConnCompBase& ccData = *ccPtr;
+
+    switch (queryFlags) {
+    case MC_CONNECTED_COMPONENT_DATA_VERTEX_FLOAT: {
+        std::lock_guard<std::mutex> lock(ccData.conversionMutex);
+        ccData.mappedVerticesFloat.reset();
+    } break;
+    case MC_CONNECTED_COMPONENT_DATA_VERTEX_DOUBLE: {
+        std::lock_guard<std::mutex> lock(ccData.conversionMutex);
+        ccData.mappedVerticesDouble.reset();
+    } break;
+    case MC_CONNECTED_COMPONENT_DATA_FACE:
+    case MC_CONNECTED_COMPONENT_DATA_FACE_SIZE:
+    case MC_CONNECTED_COMPONENT_DATA_EDGE:
+    case MC_CONNECTED_COMPONENT_DATA_SEAM_VERTEX:
+    case MC_CONNECTED_COMPONENT_DATA_VERTEX_MAP:
+    case MC_CONNECTED_COMPONENT_DATA_FACE_MAP:
+    case MC_CONNECTED_COMPONENT_DATA_FACE_TRIANGULATION:
+    case MC_CONNECTED_COMPONENT_DATA_FACE_TRIANGULATION_MAP:
+        // the internal arrays are mapped directly and freed when the connected component is released
+        break;
+    default:
+        ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "invalid enum flag (cannot be mapped)");
+        result = McResult::MC_INVALID_VALUE;
+        return result;
+    }
+
+    return result;
+}
+
 McResult MCAPI_CALL mcReleaseConnectedComponents(
     const McContext context,
     uint32_t numConnComps,
     const McConnectedComponent* pConnComps)
 {
     McResult result = McResult::MC_NO_ERROR;
-    auto ctxtIter = gDispatchContexts.find(context);
+    McDispatchContextInternal* ctxtEntry = findDispatchContext(context);
 
-    if (ctxtIter == gDispatchContexts.cend()) {
+    if (ctxtEntry == nullptr) {
         std::fprintf(stderr, "err: context undefined\n");
         result = McResult::MC_INVALID_VALUE;
         return result;
     }
 
-    const std::unique_ptr<McDispatchContextInternal>& ctxtPtr = ctxtIter->second;
+    McDispatchContextInternal* ctxtPtr = ctxtEntry;
+
+    // the enqueued dispatches write to the connected components
+    ctxtPtr->commands.finish();
 
     if (numConnComps > (uint32_t)ctxtPtr->connComps.size()) {
         ctxtPtr->log(McDebugSource::MC_DEBUG_SOURCE_API, McDebugType::MC_DEBUG_TYPE_ERROR, 0, McDebugSeverity::MC_DEBUG_SEVERITY_HIGH, "invalid number of connected components");
@@ -3518,14 +5816,35 @@ McResult MCAPI_CALL mcReleaseConnectedComponents(
 MCAPI_ATTR McResult MCAPI_CALL mcReleaseContext(const McContext context)
 {
     McResult result = McResult::MC_NO_ERROR;
-    auto ctxtIter = gDispatchContexts.find(context);
+    McDispatchContextInternal* ctxtEntry = findDispatchContext(context);
 
-    if (ctxtIter == gDispatchContexts.cend()) {
+    if (ctxtEntry == nullptr) {
         std::fprintf(stderr, "err: context undefined\n");
         result = McResult::MC_INVALID_VALUE;
         return result;
     }
 
-    gDispatchContexts.erase(ctxtIter);
+    // the pending commands reference the state of the context
+    ctxtEntry->commands.finish();
+
+    std::unique_ptr<McDispatchContextInternal> ctxt;
+
+    {
+        std::lock_guard<mcut::shared_mutex> lock(gDispatchContextsMutex);
+        auto ctxtIter = gDispatchContexts.find(context);
+
+        if (ctxtIter == gDispatchContexts.cend()) {
+            std::fprintf(stderr, "err: context undefined\n");
+            result = McResult::MC_INVALID_VALUE;
+            return result;
+        }
+
+        ctxt = std::move(ctxtIter->second);
+        gDispatchContexts.erase(ctxtIter);
+    }
+
+    // destroyed without holding the lock (this joins the helper threads of the context)
+    ctxt.reset();
+
     return result;
 }
@@ -0,0 +1,231 @@
+/**
+ * Copyright (c) 2020-2021 CutDigital Ltd.
+ * All rights reserved.
+ * 
+ * NOTE: This file is licensed under GPL-3.0-or-later (default). 
+ * A commercial license can be purchased from CutDigital Ltd. 
+ *  
+ * License details:
+ * 
+ * (A)  GNU General Public License ("GPL"); a copy of which you should have 
+ *      recieved with this file.
+ * 	    - see also: <http://www.gnu.org/licenses/>
+ * (B)  Commercial license.
+ *      - email: contact@cut-digital.com
+ * 
+ * The commercial license options is for users that wish to use MCUT in 
+ * their products for comercial purposes but do not wish to release their 
+ * software products under the GPL license. 
+ * 
+ * Author(s)     : Floyd M. Chitalu
+ */
+
+#include "mcut/internal/parallel.h"
+
+namespace mcut {
+
+thread_pool::thread_pool(uint32_t helper_thread_count)
+#if defined(MCUT_MULTI_THREADED_IMPL)
+    : m_terminate(false)
+    , m_helper_thread_count(helper_thread_count)
+{
+    m_threads.reserve(helper_thread_count);
+
+    for (uint32_t i = 0; i < helper_thread_count; ++i) {
+        m_threads.emplace_back(&thread_pool::helper_thread_main, this);
+    }
+}
+#else
+    : m_helper_thread_count(0)
+{
+    (void)helper_thread_count;
+}
+#endif // #if defined(MCUT_MULTI_THREADED_IMPL)
+
+thread_pool::~thread_pool()
+{
+#if defined(MCUT_MULTI_THREADED_IMPL)
+    {
+        std::lock_guard<std::mutex> lock(m_queue_mutex);
+        m_terminate = true;
+    }
+
+    m_queue_not_empty.notify_all();
+
+    for (std::vector<std::thread>::iterator t = m_threads.begin(); t != m_threads.end(); ++t) {
+        t->join();
+    }
+#endif // #if defined(MCUT_MULTI_THREADED_IMPL)
+}
+
+uint32_t thread_pool::get_default_helper_thread_count()
+{
+#if defined(MCUT_MULTI_THREADED_IMPL)
+    // the calling thread is also a worker
+    const uint32_t hardware_threads = std::thread::hardware_concurrency();
+    return hardware_threads > 1 ? (hardware_threads - 1) : 0;
+#else
+    return 0;
+#endif // #if defined(MCUT_MULTI_THREADED_IMPL)
+}
+
+#if defined(MCUT_MULTI_THREADED_IMPL)
+bool thread_pool::run_pending_task()
+{
+    std::function<void()> task;
+
+    {
+        std::lock_guard<std::mutex> lock(m_queue_mutex);
+
+        if (m_queue.empty()) {
+            return false;
+        }
+
+        task = std::move(m_queue.front());
+        m_queue.pop_front();
+    }
+
+    task();
+
+    return true;
+}
+
+void thread_pool::wait(task_group_t& group)
+{
+    for (;;) {
+        {
+            std::lock_guard<std::mutex> lock(group.mutex);
+            if (group.remaining == 0) {
+                return;
+            }
+        }
+
+        // NOTE: this is what allows a task to call "run" without deadlocking the pool
+        if (!run_pending_task()) {
+            // all tasks of the group have been taken by other threads
+            std::unique_lock<std::mutex> lock(group.mutex);
+            group.all_done.wait(lock, [&]() { return group.remaining == 0; });
+            return;
+        }
+    }
+}
+
+void thread_pool::helper_thread_main()
+{
+    for (;;) {
+        std::function<void()> task;
+
+        {
+            std::unique_lock<std::mutex> lock(m_queue_mutex);
+            m_queue_not_empty.wait(lock, [&]() { return m_terminate || !m_queue.empty(); });
+
+            if (m_queue.empty()) { // i.e. terminating
+                return;
+            }
+
+            task = std::move(m_queue.front());
+            m_queue.pop_front();
+        }
+
+        task();
+    }
+}
+#endif // #if defined(MCUT_MULTI_THREADED_IMPL)
+
+#if defined(MCUT_MULTI_THREADED_IMPL)
+command_queue::command_queue()
+    : m_busy(false)
+    , m_terminate(false)
+{
+}
+#else
+command_queue::command_queue()
+{
+}
+#endif // #if defined(MCUT_MULTI_THREADED_IMPL)
+
+command_queue::~command_queue()
+{
+#if defined(MCUT_MULTI_THREADED_IMPL)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_terminate = true;
+    }
+
+    m_queue_not_empty.notify_all();
+
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+#endif // #if defined(MCUT_MULTI_THREADED_IMPL)
+}
+
+void command_queue::enqueue(const std::function<void()>& fn)
+{
+#if defined(MCUT_MULTI_THREADED_IMPL)
+    const thread_numerical_settings_t numerical_settings; // of the submitting thread
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (!m_thread.joinable()) {
+            m_thread = std::thread(&command_queue::worker_thread_main, this);
+        }
+
+        m_queue.emplace_back([fn, numerical_settings]() {
+            numerical_settings.apply();
+            fn();
+        });
+    }
+
+    m_queue_not_empty.notify_one();
+#else
+    fn();
+#endif // #if defined(MCUT_MULTI_THREADED_IMPL)
+}
+
+void command_queue::finish()
+{
+#if defined(MCUT_MULTI_THREADED_IMPL)
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_idle.wait(lock, [&]() { return m_queue.empty() && !m_busy; });
+#endif // #if defined(MCUT_MULTI_THREADED_IMPL)
+}
+
+#if defined(MCUT_MULTI_THREADED_IMPL)
+void command_queue::worker_thread_main()
+{
+    for (;;) {
+        std::function<void()> fn;
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_queue_not_empty.wait(lock, [&]() { return m_terminate || !m_queue.empty(); });
+
+            if (m_queue.empty()) { // i.e. terminating
+                return;
+            }
+
+            fn = std::move(m_queue.front());
+            m_queue.pop_front();
+            m_busy = true;
+        }
+
+        // NOTE: the submitted functions report their own errors. An exception is dropped here so that
+        // it does not terminate the process, and so that "finish" still returns
+        try {
+            fn();
+        } catch (...) {
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_busy = false;
+        }
+
+        m_idle.notify_all();
+    }
+}
+#endif // #if defined(MCUT_MULTI_THREADED_IMPL)
+
+} // namespace mcut {
@@ -0,0 +1,54 @@
+#ifndef BENCHMARK_PAIR_H_
+#define BENCHMARK_PAIR_H_
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string>
+
+#include "off.h"
+
+// a source-mesh and a cut-mesh that are read from the benchmark meshes (see loadBenchmarkPair)
+struct BenchmarkPair {
+    float* pSrcMeshVertices = NULL;
+    uint32_t* pSrcMeshFaceIndices = NULL;
+    uint32_t* pSrcMeshFaceSizes = NULL;
+    uint32_t numSrcMeshVertices = 0;
+    uint32_t numSrcMeshFaces = 0;
+
+    float* pCutMeshVertices = NULL;
+    uint32_t* pCutMeshFaceIndices = NULL;
+    uint32_t* pCutMeshFaceSizes = NULL;
+    uint32_t numCutMeshVertices = 0;
+    uint32_t numCutMeshFaces = 0;
+};
+
+// read the files (e.g. "src-mesh014.off" and "cut-mesh014.off") in "MESHES_DIR/benchmarks",
+// and return whether both meshes have at least one face
+inline bool loadBenchmarkPair(BenchmarkPair& pair, const char* srcMeshFile, const char* cutMeshFile)
+{
+    const std::string srcMeshPath = std::string(MESHES_DIR) + "/benchmarks/" + srcMeshFile;
+
+    readOFF(srcMeshPath.c_str(), &pair.pSrcMeshVertices, &pair.pSrcMeshFaceIndices, &pair.pSrcMeshFaceSizes, &pair.numSrcMeshVertices, &pair.numSrcMeshFaces);
+
+    const std::string cutMeshPath = std::string(MESHES_DIR) + "/benchmarks/" + cutMeshFile;
+
+    readOFF(cutMeshPath.c_str(), &pair.pCutMeshVertices, &pair.pCutMeshFaceIndices, &pair.pCutMeshFaceSizes, &pair.numCutMeshVertices, &pair.numCutMeshFaces);
+
+    return pair.pSrcMeshVertices != NULL && pair.numSrcMeshVertices > 2 && pair.numSrcMeshFaces > 0 && //
+        pair.pCutMeshVertices != NULL && pair.numCutMeshVertices > 2 && pair.numCutMeshFaces > 0;
+}
+
+// free the arrays that are allocated by loadBenchmarkPair
+inline void freeBenchmarkPair(BenchmarkPair& pair)
+{
+    free(pair.pSrcMeshVertices);
+    free(pair.pSrcMeshFaceIndices);
+    free(pair.pSrcMeshFaceSizes);
+    free(pair.pCutMeshVertices);
+    free(pair.pCutMeshFaceIndices);
+    free(pair.pCutMeshFaceSizes);
+
+    pair = BenchmarkPair();
+}
+
+#endif
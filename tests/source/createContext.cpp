@@ -17,6 +17,35 @@ UTEST(ContextCreationTest, debugFlag)
     EXPECT_EQ(err, MC_NO_ERROR);
 }
 
+UTEST(CreateContext, helperThreads)
+{
+    McContext context;
+    McResult err = mcCreateContextWithHelpers(&context, 0, 2);
+    EXPECT_TRUE(context != nullptr);
+    EXPECT_EQ(err, MC_NO_ERROR);
+
+    uint64_t bytes = 0;
+    uint32_t helperThreadCount = ~0u;
+    EXPECT_EQ(mcGetInfo(context, MC_CONTEXT_HELPER_THREAD_COUNT, 0, nullptr, &bytes), MC_NO_ERROR);
+    EXPECT_EQ(bytes, sizeof(uint32_t));
+    EXPECT_EQ(mcGetInfo(context, MC_CONTEXT_HELPER_THREAD_COUNT, bytes, &helperThreadCount, nullptr), MC_NO_ERROR);
+    ASSERT_LE(helperThreadCount, 2u); // zero if MCUT is built without threads
+
+    EXPECT_EQ(mcReleaseContext(context), MC_NO_ERROR);
+}
+
+UTEST(CreateContext, releasedHandle)
+{
+    McContext context;
+    EXPECT_EQ(mcCreateContext(&context, 0), MC_NO_ERROR);
+    EXPECT_EQ(mcReleaseContext(context), MC_NO_ERROR);
+
+    // the handle is not an existing context anymore
+    uint64_t bytes = 0;
+    EXPECT_EQ(mcGetInfo(context, MC_CONTEXT_HELPER_THREAD_COUNT, 0, nullptr, &bytes), MC_INVALID_VALUE);
+    EXPECT_EQ(mcReleaseContext(context), MC_INVALID_VALUE);
+}
+
 // :::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
 struct DebugContextConfig {
     McContext context_;
@@ -76,4 +76,34 @@ UTEST_F(DegenerateInput, faceVertexIntersection)
         MC_INVALID_OPERATION);
 }
 
+// A source mesh with an edge that is shared by three triangles (i.e. a non-manifold edge).
+UTEST_F(DegenerateInput, nonManifoldEdge)
+{
+    std::vector<float> srcMeshVertices = {
+        0.f, 0.f, 0.f,
+        1.f, 0.f, 0.f,
+        0.f, 1.f, 0.f,
+        0.f, -1.f, 0.f,
+        0.f, 0.f, 1.f
+    };
+
+    // edge (0, 1) is used by all three faces
+    std::vector<uint32_t> srcMeshFaceIndices = { 0, 1, 2, 1, 0, 3, 0, 1, 4 };
+    std::vector<uint32_t> srcMeshFaceSizes = { 3, 3, 3 };
+
+    std::vector<float> cutMeshVertices = {
+        0.5f, -2.f, -2.f,
+        0.5f, 2.f, -2.f,
+        0.5f, 0.f, 2.f
+    };
+
+    std::vector<uint32_t> cutMeshFaceIndices = { 0, 1, 2 };
+    uint32_t cutMeshFaceSizes = 3; // array of one
+
+    ASSERT_EQ(mcDispatch(utest_fixture->myContext, MC_DISPATCH_VERTEX_ARRAY_FLOAT, //
+                  &srcMeshVertices[0], &srcMeshFaceIndices[0], &srcMeshFaceSizes[0], 5, 3, //
+                  &cutMeshVertices[0], &cutMeshFaceIndices[0], &cutMeshFaceSizes, 3, 1),
+        MC_INVALID_VALUE);
+}
+
 // TODO: add vertex-edge and vertex-vertex intersection tests
@@ -0,0 +1,95 @@
+#include "utest.h"
+#include <mcut/mcut.h>
+#include <string>
+#include <vector>
+
+#include "benchmarkPair.h"
+
+#ifdef _WIN32
+#pragma warning(disable : 26812) // Unscoped enums from mcut.h
+#endif // _WIN32
+
+struct DispatchBatch : BenchmarkPair {
+    McContext context_ = MC_NULL_HANDLE;
+};
+
+UTEST_F_SETUP(DispatchBatch)
+{
+    McResult err = mcCreateContext(&utest_fixture->context_, 0);
+    EXPECT_TRUE(utest_fixture->context_ != NULL);
+    EXPECT_EQ(err, MC_NO_ERROR);
+
+    EXPECT_TRUE(loadBenchmarkPair(*utest_fixture, "src-mesh014.off", "cut-mesh014.off"));
+}
+
+UTEST_F_TEARDOWN(DispatchBatch)
+{
+    // also releases the connected components
+    EXPECT_EQ(mcReleaseContext(utest_fixture->context_), MC_NO_ERROR);
+
+    freeBenchmarkPair(*utest_fixture);
+}
+
+UTEST_F(DispatchBatch, sameAsSeparateDispatches)
+{
+    // cut the source mesh twice with the same cut mesh
+    const void* ppCutMeshVertices[2] = { utest_fixture->pCutMeshVertices, utest_fixture->pCutMeshVertices };
+    const uint32_t* ppCutMeshFaceIndices[2] = { utest_fixture->pCutMeshFaceIndices, utest_fixture->pCutMeshFaceIndices };
+    const uint32_t* ppCutMeshFaceSizes[2] = { utest_fixture->pCutMeshFaceSizes, utest_fixture->pCutMeshFaceSizes };
+    const uint32_t pNumCutMeshVertices[2] = { utest_fixture->numCutMeshVertices, utest_fixture->numCutMeshVertices };
+    const uint32_t pNumCutMeshFaces[2] = { utest_fixture->numCutMeshFaces, utest_fixture->numCutMeshFaces };
+
+    ASSERT_EQ(mcDispatchBatch(
+                  utest_fixture->context_,
+                  MC_DISPATCH_VERTEX_ARRAY_FLOAT,
+                  utest_fixture->pSrcMeshVertices,
+                  utest_fixture->pSrcMeshFaceIndices,
+                  utest_fixture->pSrcMeshFaceSizes,
+                  utest_fixture->numSrcMeshVertices,
+                  utest_fixture->numSrcMeshFaces,
+                  2,
+                  ppCutMeshVertices,
+                  ppCutMeshFaceIndices,
+                  ppCutMeshFaceSizes,
+                  pNumCutMeshVertices,
+                  pNumCutMeshFaces),
+        MC_NO_ERROR);
+
+    uint32_t numConnectedComponents = 0;
+    ASSERT_EQ(mcGetConnectedComponents(utest_fixture->context_, MC_CONNECTED_COMPONENT_TYPE_ALL, 0, NULL, &numConnectedComponents), MC_NO_ERROR);
+    ASSERT_EQ(numConnectedComponents, 24); // 12 per equivalent "mcDispatch" call
+
+    std::vector<McConnectedComponent> connComps(numConnectedComponents, MC_NULL_HANDLE);
+    ASSERT_EQ(mcGetConnectedComponents(utest_fixture->context_, MC_CONNECTED_COMPONENT_TYPE_ALL, (uint32_t)connComps.size(), &connComps[0], NULL), MC_NO_ERROR);
+
+    uint32_t numPerCutMesh[2] = { 0, 0 };
+
+    for (uint32_t i = 0; i < numConnectedComponents; ++i) {
+        uint32_t cutMeshIndex = 0;
+        ASSERT_EQ(mcGetConnectedComponentData(utest_fixture->context_, connComps[i], MC_CONNECTED_COMPONENT_DATA_CUT_MESH_INDEX, sizeof(uint32_t), &cutMeshIndex, NULL), MC_NO_ERROR);
+        ASSERT_LT(cutMeshIndex, 2u);
+        numPerCutMesh[cutMeshIndex]++;
+    }
+
+    ASSERT_EQ(numPerCutMesh[0], 12u);
+    ASSERT_EQ(numPerCutMesh[1], 12u);
+}
+
+UTEST_F(DispatchBatch, noCutMeshes)
+{
+    ASSERT_EQ(mcDispatchBatch(
+                  utest_fixture->context_,
+                  MC_DISPATCH_VERTEX_ARRAY_FLOAT,
+                  utest_fixture->pSrcMeshVertices,
+                  utest_fixture->pSrcMeshFaceIndices,
+                  utest_fixture->pSrcMeshFaceSizes,
+                  utest_fixture->numSrcMeshVertices,
+                  utest_fixture->numSrcMeshFaces,
+                  0,
+                  NULL,
+                  NULL,
+                  NULL,
+                  NULL,
+                  NULL),
+        MC_INVALID_VALUE);
+}
@@ -0,0 +1,229 @@
+#include "utest.h"
+#include <mcut/mcut.h>
+#include <string>
+#include <vector>
+
+#include "benchmarkPair.h"
+
+#ifdef _WIN32
+#pragma warning(disable : 26812) // Unscoped enums from mcut.h
+#endif // _WIN32
+
+struct EnqueueDispatch : BenchmarkPair {
+    McContext context_ = MC_NULL_HANDLE;
+    McEvent event_ = MC_NULL_HANDLE;
+};
+
+UTEST_F_SETUP(EnqueueDispatch)
+{
+    McResult err = mcCreateContext(&utest_fixture->context_, 0);
+    EXPECT_TRUE(utest_fixture->context_ != NULL);
+    EXPECT_EQ(err, MC_NO_ERROR);
+
+    EXPECT_TRUE(loadBenchmarkPair(*utest_fixture, "src-mesh014.off", "cut-mesh014.off"));
+}
+
+UTEST_F_TEARDOWN(EnqueueDispatch)
+{
+    if (utest_fixture->event_ != MC_NULL_HANDLE) {
+        EXPECT_EQ(mcReleaseEvents(1, &utest_fixture->event_), MC_NO_ERROR);
+    }
+
+    // also releases the connected components
+    EXPECT_EQ(mcReleaseContext(utest_fixture->context_), MC_NO_ERROR);
+
+    freeBenchmarkPair(*utest_fixture);
+}
+
+UTEST_F(EnqueueDispatch, waitForEvent)
+{
+    ASSERT_EQ(mcEnqueueDispatch(
+                  utest_fixture->context_,
+                  MC_DISPATCH_VERTEX_ARRAY_FLOAT,
+                  utest_fixture->pSrcMeshVertices,
+                  utest_fixture->pSrcMeshFaceIndices,
+                  utest_fixture->pSrcMeshFaceSizes,
+                  utest_fixture->numSrcMeshVertices,
+                  utest_fixture->numSrcMeshFaces,
+                  utest_fixture->pCutMeshVertices,
+                  utest_fixture->pCutMeshFaceIndices,
+                  utest_fixture->pCutMeshFaceSizes,
+                  utest_fixture->numCutMeshVertices,
+                  utest_fixture->numCutMeshFaces,
+                  &utest_fixture->event_),
+        MC_NO_ERROR);
+
+    ASSERT_TRUE(utest_fixture->event_ != MC_NULL_HANDLE);
+    ASSERT_EQ(mcWaitForEvents(1, &utest_fixture->event_), MC_NO_ERROR);
+
+    McEventCommandExecStatus status = MC_SUBMITTED;
+    ASSERT_EQ(mcGetEventInfo(utest_fixture->event_, MC_EVENT_COMMAND_EXECUTION_STATUS, sizeof(McEventCommandExecStatus), &status, NULL), MC_NO_ERROR);
+    ASSERT_EQ(status, MC_COMPLETE);
+
+    McContext context = MC_NULL_HANDLE;
+    ASSERT_EQ(mcGetEventInfo(utest_fixture->event_, MC_EVENT_CONTEXT, sizeof(McContext), &context, NULL), MC_NO_ERROR);
+    ASSERT_TRUE(context == utest_fixture->context_);
+
+    uint32_t numConnectedComponents = 0;
+    ASSERT_EQ(mcGetConnectedComponents(utest_fixture->context_, MC_CONNECTED_COMPONENT_TYPE_ALL, 0, NULL, &numConnectedComponents), MC_NO_ERROR);
+    ASSERT_EQ(numConnectedComponents, 12); // same as the equivalent "mcDispatch" call
+}
+
+static void countEventCallback(McEvent event, void* data)
+{
+    McResult runtimeStatus = MC_RESULT_MAX_ENUM;
+    mcGetEventInfo(event, MC_EVENT_RUNTIME_EXECUTION_STATUS, sizeof(McResult), &runtimeStatus, NULL);
+
+    if (runtimeStatus == MC_INVALID_VALUE) {
+        (*reinterpret_cast<int*>(data))++;
+    }
+}
+
+UTEST_F(EnqueueDispatch, failedDispatchCallback)
+{
+    int numCallbacks = 0;
+
+    // the floating-point type of the vertex arrays is not specified
+    ASSERT_EQ(mcEnqueueDispatch(
+                  utest_fixture->context_,
+                  0,
+                  utest_fixture->pSrcMeshVertices,
+                  utest_fixture->pSrcMeshFaceIndices,
+                  utest_fixture->pSrcMeshFaceSizes,
+                  utest_fixture->numSrcMeshVertices,
+                  utest_fixture->numSrcMeshFaces,
+                  utest_fixture->pCutMeshVertices,
+                  utest_fixture->pCutMeshFaceIndices,
+                  utest_fixture->pCutMeshFaceSizes,
+                  utest_fixture->numCutMeshVertices,
+                  utest_fixture->numCutMeshFaces,
+                  &utest_fixture->event_),
+        MC_NO_ERROR);
+
+    ASSERT_EQ(mcSetEventCallback(utest_fixture->event_, countEventCallback, &numCallbacks), MC_NO_ERROR);
+    ASSERT_EQ(mcWaitForEvents(1, &utest_fixture->event_), MC_INVALID_VALUE);
+    ASSERT_EQ(numCallbacks, 1);
+
+    // called immediately since the dispatch is complete
+    ASSERT_EQ(mcSetEventCallback(utest_fixture->event_, countEventCallback, &numCallbacks), MC_NO_ERROR);
+    ASSERT_EQ(numCallbacks, 2);
+}
+
+UTEST_F(EnqueueDispatch, dispatchAfterEnqueue)
+{
+    // no event. The next (blocking) dispatch executes after this one
+    ASSERT_EQ(mcEnqueueDispatch(
+                  utest_fixture->context_,
+                  MC_DISPATCH_VERTEX_ARRAY_FLOAT | MC_DISPATCH_FILTER_SEAM_SRCMESH,
+                  utest_fixture->pSrcMeshVertices,
+                  utest_fixture->pSrcMeshFaceIndices,
+                  utest_fixture->pSrcMeshFaceSizes,
+                  utest_fixture->numSrcMeshVertices,
+                  utest_fixture->numSrcMeshFaces,
+                  utest_fixture->pCutMeshVertices,
+                  utest_fixture->pCutMeshFaceIndices,
+                  utest_fixture->pCutMeshFaceSizes,
+                  utest_fixture->numCutMeshVertices,
+                  utest_fixture->numCutMeshFaces,
+                  NULL),
+        MC_NO_ERROR);
+
+    ASSERT_EQ(mcDispatch(
+                  utest_fixture->context_,
+                  MC_DISPATCH_VERTEX_ARRAY_FLOAT,
+                  utest_fixture->pSrcMeshVertices,
+                  utest_fixture->pSrcMeshFaceIndices,
+                  utest_fixture->pSrcMeshFaceSizes,
+                  utest_fixture->numSrcMeshVertices,
+                  utest_fixture->numSrcMeshFaces,
+                  utest_fixture->pCutMeshVertices,
+                  utest_fixture->pCutMeshFaceIndices,
+                  utest_fixture->pCutMeshFaceSizes,
+                  utest_fixture->numCutMeshVertices,
+                  utest_fixture->numCutMeshFaces),
+        MC_NO_ERROR);
+
+    uint32_t numConnectedComponents = 0;
+    ASSERT_EQ(mcGetConnectedComponents(utest_fixture->context_, MC_CONNECTED_COMPONENT_TYPE_ALL, 0, NULL, &numConnectedComponents), MC_NO_ERROR);
+    ASSERT_GT(numConnectedComponents, 12u); // the outputs of both dispatches
+}
+
+UTEST_F(EnqueueDispatch, releaseAfterEnqueue)
+{
+    ASSERT_EQ(mcEnqueueDispatch(
+                  utest_fixture->context_,
+                  MC_DISPATCH_VERTEX_ARRAY_FLOAT,
+                  utest_fixture->pSrcMeshVertices,
+                  utest_fixture->pSrcMeshFaceIndices,
+                  utest_fixture->pSrcMeshFaceSizes,
+                  utest_fixture->numSrcMeshVertices,
+                  utest_fixture->numSrcMeshFaces,
+                  utest_fixture->pCutMeshVertices,
+                  utest_fixture->pCutMeshFaceIndices,
+                  utest_fixture->pCutMeshFaceSizes,
+                  utest_fixture->numCutMeshVertices,
+                  utest_fixture->numCutMeshFaces,
+                  &utest_fixture->event_),
+        MC_NO_ERROR);
+
+    // waits for the enqueued dispatch before changing the state that it uses
+    ASSERT_EQ(mcSetRoundingMode(utest_fixture->context_, MC_ROUNDING_MODE_TO_NEAREST), MC_NO_ERROR);
+
+    McEventCommandExecStatus status = MC_SUBMITTED;
+    ASSERT_EQ(mcGetEventInfo(utest_fixture->event_, MC_EVENT_COMMAND_EXECUTION_STATUS, sizeof(McEventCommandExecStatus), &status, NULL), MC_NO_ERROR);
+    ASSERT_EQ(status, MC_COMPLETE);
+
+    // ... and so releases the connected components which it has created
+    ASSERT_EQ(mcReleaseConnectedComponents(utest_fixture->context_, 0, NULL), MC_NO_ERROR);
+
+    uint32_t numConnectedComponents = 0;
+    ASSERT_EQ(mcGetConnectedComponents(utest_fixture->context_, MC_CONNECTED_COMPONENT_TYPE_ALL, 0, NULL, &numConnectedComponents), MC_NO_ERROR);
+    ASSERT_EQ(numConnectedComponents, 0u);
+}
+
+UTEST_F(EnqueueDispatch, queryWhileEnqueued)
+{
+    McEvent events[2] = { MC_NULL_HANDLE, MC_NULL_HANDLE };
+
+    for (int i = 0; i < 2; ++i) {
+        ASSERT_EQ(mcEnqueueDispatch(
+                      utest_fixture->context_,
+                      MC_DISPATCH_VERTEX_ARRAY_FLOAT,
+                      utest_fixture->pSrcMeshVertices,
+                      utest_fixture->pSrcMeshFaceIndices,
+                      utest_fixture->pSrcMeshFaceSizes,
+                      utest_fixture->numSrcMeshVertices,
+                      utest_fixture->numSrcMeshFaces,
+                      utest_fixture->pCutMeshVertices,
+                      utest_fixture->pCutMeshFaceIndices,
+                      utest_fixture->pCutMeshFaceSizes,
+                      utest_fixture->numCutMeshVertices,
+                      utest_fixture->numCutMeshFaces,
+                      &events[i]),
+            MC_NO_ERROR);
+
+        if (i == 0) {
+            ASSERT_EQ(mcWaitForEvents(1, &events[0]), MC_NO_ERROR);
+        }
+    }
+
+    // the connected components of the first dispatch are queried while the second one may still run
+    uint32_t numConnectedComponents = 0;
+    ASSERT_EQ(mcGetConnectedComponents(utest_fixture->context_, MC_CONNECTED_COMPONENT_TYPE_ALL, 0, NULL, &numConnectedComponents), MC_NO_ERROR);
+    ASSERT_GE(numConnectedComponents, 12u);
+
+    std::vector<McConnectedComponent> connComps(numConnectedComponents);
+    ASSERT_EQ(mcGetConnectedComponents(utest_fixture->context_, MC_CONNECTED_COMPONENT_TYPE_ALL, numConnectedComponents, &connComps[0], NULL), MC_NO_ERROR);
+
+    for (uint32_t i = 0; i < numConnectedComponents; ++i) {
+        uint64_t numBytes = 0;
+        ASSERT_EQ(mcGetConnectedComponentData(utest_fixture->context_, connComps[i], MC_CONNECTED_COMPONENT_DATA_VERTEX_DOUBLE, 0, NULL, &numBytes), MC_NO_ERROR);
+        ASSERT_GT(numBytes, 0u);
+    }
+
+    ASSERT_EQ(mcWaitForEvents(1, &events[1]), MC_NO_ERROR);
+    ASSERT_EQ(mcGetConnectedComponents(utest_fixture->context_, MC_CONNECTED_COMPONENT_TYPE_ALL, 0, NULL, &numConnectedComponents), MC_NO_ERROR);
+    ASSERT_EQ(numConnectedComponents, 24u);
+
+    ASSERT_EQ(mcReleaseEvents(2, events), MC_NO_ERROR);
+}
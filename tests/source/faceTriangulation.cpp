@@ -0,0 +1,326 @@
+#include "utest.h"
+#include <cmath>
+#include <mcut/mcut.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "benchmarkPair.h"
+
+#ifdef _WIN32
+#pragma warning(disable : 26812) // Unscoped enums from mcut.h
+#endif // _WIN32
+
+struct FaceTriangulation : BenchmarkPair {
+    McContext context_ = MC_NULL_HANDLE;
+
+    std::vector<McConnectedComponent> connComps_;
+};
+
+UTEST_F_SETUP(FaceTriangulation)
+{
+    McResult err = mcCreateContext(&utest_fixture->context_, 0);
+    EXPECT_TRUE(utest_fixture->context_ != NULL);
+    EXPECT_EQ(err, MC_NO_ERROR);
+
+    EXPECT_TRUE(loadBenchmarkPair(*utest_fixture, "src-mesh014.off", "cut-mesh014.off"));
+}
+
+// dispatch and get all connected components
+static McResult dispatchAndGetConnComps(FaceTriangulation* fixture, McFlags dispatchFlags)
+{
+    McResult err = mcDispatch(
+        fixture->context_,
+        MC_DISPATCH_VERTEX_ARRAY_FLOAT | dispatchFlags,
+        fixture->pSrcMeshVertices,
+        fixture->pSrcMeshFaceIndices,
+        fixture->pSrcMeshFaceSizes,
+        fixture->numSrcMeshVertices,
+        fixture->numSrcMeshFaces,
+        fixture->pCutMeshVertices,
+        fixture->pCutMeshFaceIndices,
+        fixture->pCutMeshFaceSizes,
+        fixture->numCutMeshVertices,
+        fixture->numCutMeshFaces);
+
+    if (err != MC_NO_ERROR) {
+        return err;
+    }
+
+    uint32_t numConnComps = 0;
+    err = mcGetConnectedComponents(fixture->context_, MC_CONNECTED_COMPONENT_TYPE_ALL, 0, NULL, &numConnComps);
+
+    if (err != MC_NO_ERROR || numConnComps == 0) {
+        return err;
+    }
+
+    fixture->connComps_.resize(numConnComps);
+    return mcGetConnectedComponents(fixture->context_, MC_CONNECTED_COMPONENT_TYPE_ALL, numConnComps, &fixture->connComps_[0], NULL);
+}
+
+// twice the area of the polygon (Newell's method)
+static double polygonArea2(const double* pVertices, const uint32_t* pPolygon, uint32_t numPolygonVertices)
+{
+    double n[3] = { 0.0, 0.0, 0.0 };
+
+    for (uint32_t i = 0; i < numPolygonVertices; ++i) {
+        const double* a = pVertices + pPolygon[i] * 3;
+        const double* b = pVertices + pPolygon[(i + 1) % numPolygonVertices] * 3;
+        n[0] += (a[1] - b[1]) * (a[2] + b[2]);
+        n[1] += (a[2] - b[2]) * (a[0] + b[0]);
+        n[2] += (a[0] - b[0]) * (a[1] + b[1]);
+    }
+
+    return std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+}
+
+UTEST_F_TEARDOWN(FaceTriangulation)
+{
+    EXPECT_EQ(mcReleaseContext(utest_fixture->context_), MC_NO_ERROR);
+
+    freeBenchmarkPair(*utest_fixture);
+}
+
+UTEST_F(FaceTriangulation, trianglesCoverFaces)
+{
+    ASSERT_EQ(dispatchAndGetConnComps(utest_fixture, MC_DISPATCH_INCLUDE_FACE_MAP), MC_NO_ERROR);
+    ASSERT_GT(utest_fixture->connComps_.size(), (size_t)0);
+
+    const McFlags queryFlags = MC_CONNECTED_COMPONENT_DATA_VERTEX_DOUBLE | MC_CONNECTED_COMPONENT_DATA_FACE | MC_CONNECTED_COMPONENT_DATA_FACE_SIZE | //
+        MC_CONNECTED_COMPONENT_DATA_FACE_MAP | MC_CONNECTED_COMPONENT_DATA_FACE_TRIANGULATION | MC_CONNECTED_COMPONENT_DATA_FACE_TRIANGULATION_MAP;
+
+    std::vector<McConnectedComponentDataDesc> descs(utest_fixture->connComps_.size());
+    ASSERT_EQ(mcGetConnectedComponentsData(utest_fixture->context_, (uint32_t)descs.size(), &utest_fixture->connComps_[0], queryFlags, &descs[0]), MC_NO_ERROR);
+
+    for (uint32_t i = 0; i < (uint32_t)descs.size(); ++i) {
+        const McConnectedComponentDataDesc& desc = descs[i];
+
+        ASSERT_EQ(desc.numTriangles, desc.numFaceIndices - 2 * desc.numFaces);
+        ASSERT_TRUE(desc.pFaceTriangulation != NULL);
+        ASSERT_TRUE(desc.pFaceTriangulationMap != NULL);
+
+        // the same data is returned by the copying query
+        uint64_t numBytes = 0;
+        ASSERT_EQ(mcGetConnectedComponentData(utest_fixture->context_, utest_fixture->connComps_[i], MC_CONNECTED_COMPONENT_DATA_FACE_TRIANGULATION, 0, NULL, &numBytes), MC_NO_ERROR);
+        ASSERT_EQ(numBytes, (uint64_t)desc.numTriangles * 3 * sizeof(uint32_t));
+
+        std::vector<uint32_t> triangles(desc.numTriangles * 3);
+        ASSERT_EQ(mcGetConnectedComponentData(utest_fixture->context_, utest_fixture->connComps_[i], MC_CONNECTED_COMPONENT_DATA_FACE_TRIANGULATION, numBytes, &triangles[0], NULL), MC_NO_ERROR);
+
+        uint32_t faceIndexOffset = 0;
+        uint32_t triangleOffset = 0;
+
+        for (uint32_t f = 0; f < desc.numFaces; ++f) {
+            const uint32_t faceSize = desc.pFaceSizes[f];
+            const double faceArea2 = polygonArea2(desc.pVerticesDouble, desc.pFaceIndices + faceIndexOffset, faceSize);
+            double trianglesArea2 = 0.0;
+
+            for (uint32_t t = triangleOffset; t < triangleOffset + (faceSize - 2); ++t) {
+                const uint32_t* pTriangle = desc.pFaceTriangulation + t * 3;
+
+                for (uint32_t v = 0; v < 3; ++v) {
+                    ASSERT_LT(pTriangle[v], desc.numVertices);
+                    ASSERT_EQ(pTriangle[v], triangles[t * 3 + v]);
+                }
+
+                ASSERT_EQ(desc.pFaceTriangulationMap[t], desc.pFaceMap[f]);
+
+                trianglesArea2 += polygonArea2(desc.pVerticesDouble, pTriangle, 3);
+            }
+
+            // the triangles do not overlap, so their total area is that of the face
+            ASSERT_LT(std::fabs(trianglesArea2 - faceArea2), 1e-6 * (faceArea2 + 1.0));
+
+            faceIndexOffset += faceSize;
+            triangleOffset += faceSize - 2;
+        }
+    }
+}
+
+UTEST_F(FaceTriangulation, mapRequiresDispatchFlag)
+{
+    ASSERT_EQ(dispatchAndGetConnComps(utest_fixture, 0), MC_NO_ERROR);
+    ASSERT_GT(utest_fixture->connComps_.size(), (size_t)0);
+
+    uint64_t numBytes = 0;
+    ASSERT_EQ(mcGetConnectedComponentData(utest_fixture->context_, utest_fixture->connComps_[0], MC_CONNECTED_COMPONENT_DATA_FACE_TRIANGULATION, 0, NULL, &numBytes), MC_NO_ERROR);
+    ASSERT_GT(numBytes, (uint64_t)0);
+    ASSERT_EQ(mcGetConnectedComponentData(utest_fixture->context_, utest_fixture->connComps_[0], MC_CONNECTED_COMPONENT_DATA_FACE_TRIANGULATION_MAP, 0, NULL, &numBytes), MC_INVALID_VALUE);
+}
+
+// whether the triangles of each face have the winding order of the face and cover it without overlapping
+static bool trianglesCoverFaces(const McConnectedComponentDataDesc& desc)
+{
+    uint32_t faceIndexOffset = 0;
+    uint32_t triangleOffset = 0;
+
+    for (uint32_t f = 0; f < desc.numFaces; ++f) {
+        const uint32_t faceSize = desc.pFaceSizes[f];
+        const uint32_t* pFace = desc.pFaceIndices + faceIndexOffset;
+        double faceNormal[3] = { 0.0, 0.0, 0.0 }; // Newell's method
+
+        for (uint32_t i = 0; i < faceSize; ++i) {
+            const double* a = desc.pVerticesDouble + pFace[i] * 3;
+            const double* b = desc.pVerticesDouble + pFace[(i + 1) % faceSize] * 3;
+            faceNormal[0] += (a[1] - b[1]) * (a[2] + b[2]);
+            faceNormal[1] += (a[2] - b[2]) * (a[0] + b[0]);
+            faceNormal[2] += (a[0] - b[0]) * (a[1] + b[1]);
+        }
+
+        const double faceArea2 = polygonArea2(desc.pVerticesDouble, pFace, faceSize);
+        double trianglesArea2 = 0.0;
+
+        for (uint32_t t = triangleOffset; t < triangleOffset + (faceSize - 2); ++t) {
+            const uint32_t* pTriangle = desc.pFaceTriangulation + t * 3;
+            const double* a = desc.pVerticesDouble + pTriangle[0] * 3;
+            const double* b = desc.pVerticesDouble + pTriangle[1] * 3;
+            const double* c = desc.pVerticesDouble + pTriangle[2] * 3;
+            const double u[3] = { b[0] - a[0], b[1] - a[1], b[2] - a[2] };
+            const double v[3] = { c[0] - a[0], c[1] - a[1], c[2] - a[2] };
+            const double n[3] = { u[1] * v[2] - u[2] * v[1], u[2] * v[0] - u[0] * v[2], u[0] * v[1] - u[1] * v[0] };
+
+            // an inverted triangle overlaps the others
+            if (n[0] * faceNormal[0] + n[1] * faceNormal[1] + n[2] * faceNormal[2] < -1e-9) {
+                return false;
+            }
+
+            trianglesArea2 += polygonArea2(desc.pVerticesDouble, pTriangle, 3);
+        }
+
+        if (std::fabs(trianglesArea2 - faceArea2) > 1e-6 * (faceArea2 + 1.0)) {
+            return false;
+        }
+
+        faceIndexOffset += faceSize;
+        triangleOffset += faceSize - 2;
+    }
+
+    return true;
+}
+
+// cut an L-shaped prism (whose faces are concave) in half, so that the sealed faces are concave too
+static McResult dispatchLShapedPrism(FaceTriangulation* fixture, const std::vector<double>& srcMeshVertices, const std::vector<uint32_t>& srcMeshFaceIndices, const std::vector<uint32_t>& srcMeshFaceSizes)
+{
+    const double cutMeshVertices[] = {
+        -1.0, -1.0, 1.0, //
+        3.0, -1.0, 1.0, //
+        3.0, 3.0, 1.0, //
+        -1.0, 3.0, 1.0
+    };
+    const uint32_t cutMeshFaceIndices[] = { 0, 1, 2, 3 };
+    const uint32_t cutMeshFaceSizes[] = { 4 };
+
+    McResult err = mcDispatch(
+        fixture->context_,
+        MC_DISPATCH_VERTEX_ARRAY_DOUBLE,
+        &srcMeshVertices[0],
+        &srcMeshFaceIndices[0],
+        &srcMeshFaceSizes[0],
+        (uint32_t)(srcMeshVertices.size() / 3),
+        (uint32_t)srcMeshFaceSizes.size(),
+        cutMeshVertices,
+        cutMeshFaceIndices,
+        cutMeshFaceSizes,
+        4,
+        1);
+
+    if (err != MC_NO_ERROR) {
+        return err;
+    }
+
+    uint32_t numConnComps = 0;
+    err = mcGetConnectedComponents(fixture->context_, MC_CONNECTED_COMPONENT_TYPE_ALL, 0, NULL, &numConnComps);
+
+    if (err != MC_NO_ERROR || numConnComps == 0) {
+        return err;
+    }
+
+    fixture->connComps_.resize(numConnComps);
+    return mcGetConnectedComponents(fixture->context_, MC_CONNECTED_COMPONENT_TYPE_ALL, numConnComps, &fixture->connComps_[0], NULL);
+}
+
+// the prism over the polygon "ring" (counter-clockwise) from z=0 to z=2
+static void makePrism(const std::vector<double>& ring, std::vector<double>& vertices, std::vector<uint32_t>& faceIndices, std::vector<uint32_t>& faceSizes)
+{
+    const uint32_t n = (uint32_t)(ring.size() / 2);
+
+    for (uint32_t z = 0; z < 2; ++z) {
+        for (uint32_t i = 0; i < n; ++i) {
+            vertices.push_back(ring[i * 2 + 0]);
+            vertices.push_back(ring[i * 2 + 1]);
+            vertices.push_back(2.0 * z);
+        }
+    }
+
+    for (uint32_t i = 0; i < n; ++i) { // bottom
+        faceIndices.push_back(n - 1 - i);
+    }
+    faceSizes.push_back(n);
+
+    for (uint32_t i = 0; i < n; ++i) { // top
+        faceIndices.push_back(n + i);
+    }
+    faceSizes.push_back(n);
+
+    for (uint32_t i = 0; i < n; ++i) { // sides
+        const uint32_t j = (i + 1) % n;
+        faceIndices.push_back(i);
+        faceIndices.push_back(j);
+        faceIndices.push_back(n + j);
+        faceIndices.push_back(n + i);
+        faceSizes.push_back(4);
+    }
+}
+
+UTEST_F(FaceTriangulation, concaveFaces)
+{
+    const std::vector<double> ring = { 0.0, 0.0, 2.0, 0.0, 2.0, 1.0, 1.0, 1.0, 1.0, 2.0, 0.0, 2.0 };
+    std::vector<double> vertices;
+    std::vector<uint32_t> faceIndices;
+    std::vector<uint32_t> faceSizes;
+    makePrism(ring, vertices, faceIndices, faceSizes);
+
+    ASSERT_EQ(dispatchLShapedPrism(utest_fixture, vertices, faceIndices, faceSizes), MC_NO_ERROR);
+    ASSERT_GT(utest_fixture->connComps_.size(), (size_t)0);
+
+    const McFlags queryFlags = MC_CONNECTED_COMPONENT_DATA_VERTEX_DOUBLE | MC_CONNECTED_COMPONENT_DATA_FACE | MC_CONNECTED_COMPONENT_DATA_FACE_SIZE | MC_CONNECTED_COMPONENT_DATA_FACE_TRIANGULATION;
+
+    std::vector<McConnectedComponentDataDesc> descs(utest_fixture->connComps_.size());
+    ASSERT_EQ(mcGetConnectedComponentsData(utest_fixture->context_, (uint32_t)descs.size(), &utest_fixture->connComps_[0], queryFlags, &descs[0]), MC_NO_ERROR);
+
+    for (uint32_t i = 0; i < (uint32_t)descs.size(); ++i) {
+        ASSERT_EQ(descs[i].numTriangles, descs[i].numFaceIndices - 2 * descs[i].numFaces);
+        ASSERT_TRUE(trianglesCoverFaces(descs[i]));
+    }
+}
+
+UTEST_F(FaceTriangulation, collinearVertices)
+{
+    // the L-shape with a vertex in the middle of two of its edges
+    const std::vector<double> ring = { 0.0, 0.0, 1.0, 0.0, 2.0, 0.0, 2.0, 1.0, 1.0, 1.0, 1.0, 2.0, 0.0, 2.0, 0.0, 1.0 };
+    std::vector<double> vertices;
+    std::vector<uint32_t> faceIndices;
+    std::vector<uint32_t> faceSizes;
+    makePrism(ring, vertices, faceIndices, faceSizes);
+
+    ASSERT_EQ(dispatchLShapedPrism(utest_fixture, vertices, faceIndices, faceSizes), MC_NO_ERROR);
+    ASSERT_GT(utest_fixture->connComps_.size(), (size_t)0);
+
+    const McFlags queryFlags = MC_CONNECTED_COMPONENT_DATA_VERTEX_DOUBLE | MC_CONNECTED_COMPONENT_DATA_FACE | MC_CONNECTED_COMPONENT_DATA_FACE_SIZE | MC_CONNECTED_COMPONENT_DATA_FACE_TRIANGULATION;
+
+    std::vector<McConnectedComponentDataDesc> descs(utest_fixture->connComps_.size());
+    ASSERT_EQ(mcGetConnectedComponentsData(utest_fixture->context_, (uint32_t)descs.size(), &utest_fixture->connComps_[0], queryFlags, &descs[0]), MC_NO_ERROR);
+
+    bool hasCollinearFace = false;
+
+    for (uint32_t i = 0; i < (uint32_t)descs.size(); ++i) {
+        ASSERT_EQ(descs[i].numTriangles, descs[i].numFaceIndices - 2 * descs[i].numFaces);
+        ASSERT_TRUE(trianglesCoverFaces(descs[i]));
+
+        for (uint32_t f = 0; f < descs[i].numFaces; ++f) {
+            hasCollinearFace = hasCollinearFace || descs[i].pFaceSizes[f] == 8;
+        }
+    }
+
+    ASSERT_TRUE(hasCollinearFace);
+}
@@ -0,0 +1,110 @@
+#include "utest.h"
+#include <mcut/mcut.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "benchmarkPair.h"
+
+#ifdef _WIN32
+#pragma warning(disable : 26812) // Unscoped enums from mcut.h
+#endif // _WIN32
+
+struct IntersectingFacePairs : BenchmarkPair {
+    McContext context_ = MC_NULL_HANDLE;
+};
+
+UTEST_F_SETUP(IntersectingFacePairs)
+{
+    McResult err = mcCreateContext(&utest_fixture->context_, 0);
+    EXPECT_TRUE(utest_fixture->context_ != NULL);
+    EXPECT_EQ(err, MC_NO_ERROR);
+
+    EXPECT_TRUE(loadBenchmarkPair(*utest_fixture, "src-mesh014.off", "cut-mesh014.off"));
+}
+
+UTEST_F_TEARDOWN(IntersectingFacePairs)
+{
+    EXPECT_EQ(mcReleaseContext(utest_fixture->context_), MC_NO_ERROR);
+
+    freeBenchmarkPair(*utest_fixture);
+}
+
+UTEST_F(IntersectingFacePairs, allPairs)
+{
+    uint32_t numFacePairs = 0;
+    ASSERT_EQ(mcGetIntersectingFacePairs(utest_fixture->context_, MC_DISPATCH_VERTEX_ARRAY_FLOAT,
+                  utest_fixture->pSrcMeshVertices, utest_fixture->pSrcMeshFaceIndices, utest_fixture->pSrcMeshFaceSizes, utest_fixture->numSrcMeshVertices, utest_fixture->numSrcMeshFaces,
+                  utest_fixture->pCutMeshVertices, utest_fixture->pCutMeshFaceIndices, utest_fixture->pCutMeshFaceSizes, utest_fixture->numCutMeshVertices, utest_fixture->numCutMeshFaces,
+                  0, NULL, &numFacePairs),
+        MC_NO_ERROR);
+    ASSERT_GT(numFacePairs, (uint32_t)0);
+
+    std::vector<uint32_t> facePairs(numFacePairs * 2);
+    uint32_t numFoundFacePairs = 0;
+    ASSERT_EQ(mcGetIntersectingFacePairs(utest_fixture->context_, MC_DISPATCH_VERTEX_ARRAY_FLOAT,
+                  utest_fixture->pSrcMeshVertices, utest_fixture->pSrcMeshFaceIndices, utest_fixture->pSrcMeshFaceSizes, utest_fixture->numSrcMeshVertices, utest_fixture->numSrcMeshFaces,
+                  utest_fixture->pCutMeshVertices, utest_fixture->pCutMeshFaceIndices, utest_fixture->pCutMeshFaceSizes, utest_fixture->numCutMeshVertices, utest_fixture->numCutMeshFaces,
+                  numFacePairs, &facePairs[0], &numFoundFacePairs),
+        MC_NO_ERROR);
+    ASSERT_EQ(numFoundFacePairs, numFacePairs);
+
+    for (uint32_t i = 0; i < numFacePairs; ++i) {
+        ASSERT_LT(facePairs[(i * 2) + 0], utest_fixture->numSrcMeshFaces);
+        ASSERT_LT(facePairs[(i * 2) + 1], utest_fixture->numCutMeshFaces);
+    }
+
+    // the search stops at the first intersecting pair
+    uint32_t firstFacePair[2] = { 0, 0 };
+    ASSERT_EQ(mcGetIntersectingFacePairs(utest_fixture->context_, MC_DISPATCH_VERTEX_ARRAY_FLOAT,
+                  utest_fixture->pSrcMeshVertices, utest_fixture->pSrcMeshFaceIndices, utest_fixture->pSrcMeshFaceSizes, utest_fixture->numSrcMeshVertices, utest_fixture->numSrcMeshFaces,
+                  utest_fixture->pCutMeshVertices, utest_fixture->pCutMeshFaceIndices, utest_fixture->pCutMeshFaceSizes, utest_fixture->numCutMeshVertices, utest_fixture->numCutMeshFaces,
+                  1, firstFacePair, &numFoundFacePairs),
+        MC_NO_ERROR);
+    ASSERT_EQ(numFoundFacePairs, (uint32_t)1);
+    ASSERT_EQ(firstFacePair[0], facePairs[0]);
+    ASSERT_EQ(firstFacePair[1], facePairs[1]);
+
+    // no connected components are created
+    uint32_t numConnComps = 0;
+    ASSERT_EQ(mcGetConnectedComponents(utest_fixture->context_, MC_CONNECTED_COMPONENT_TYPE_ALL, 0, NULL, &numConnComps), MC_NO_ERROR);
+    ASSERT_EQ(numConnComps, (uint32_t)0);
+}
+
+UTEST_F(IntersectingFacePairs, separatedMeshes)
+{
+    std::vector<float> cutMeshVertices(utest_fixture->pCutMeshVertices, utest_fixture->pCutMeshVertices + (utest_fixture->numCutMeshVertices * 3));
+
+    for (uint32_t i = 0; i < utest_fixture->numCutMeshVertices; ++i) {
+        cutMeshVertices[(i * 3) + 1] += 1024.f;
+    }
+
+    uint32_t numFacePairs = 1;
+    ASSERT_EQ(mcGetIntersectingFacePairs(utest_fixture->context_, MC_DISPATCH_VERTEX_ARRAY_FLOAT,
+                  utest_fixture->pSrcMeshVertices, utest_fixture->pSrcMeshFaceIndices, utest_fixture->pSrcMeshFaceSizes, utest_fixture->numSrcMeshVertices, utest_fixture->numSrcMeshFaces,
+                  &cutMeshVertices[0], utest_fixture->pCutMeshFaceIndices, utest_fixture->pCutMeshFaceSizes, utest_fixture->numCutMeshVertices, utest_fixture->numCutMeshFaces,
+                  0, NULL, &numFacePairs),
+        MC_NO_ERROR);
+    ASSERT_EQ(numFacePairs, (uint32_t)0);
+}
+
+UTEST_F(IntersectingFacePairs, invalidArguments)
+{
+    uint32_t facePair[2] = { 0, 0 };
+
+    ASSERT_EQ(mcGetIntersectingFacePairs(utest_fixture->context_, MC_DISPATCH_VERTEX_ARRAY_FLOAT,
+                  utest_fixture->pSrcMeshVertices, utest_fixture->pSrcMeshFaceIndices, utest_fixture->pSrcMeshFaceSizes, utest_fixture->numSrcMeshVertices, utest_fixture->numSrcMeshFaces,
+                  utest_fixture->pCutMeshVertices, utest_fixture->pCutMeshFaceIndices, utest_fixture->pCutMeshFaceSizes, utest_fixture->numCutMeshVertices, utest_fixture->numCutMeshFaces,
+                  0, facePair, NULL),
+        MC_INVALID_VALUE);
+    ASSERT_EQ(mcGetIntersectingFacePairs(utest_fixture->context_, MC_DISPATCH_VERTEX_ARRAY_FLOAT,
+                  utest_fixture->pSrcMeshVertices, utest_fixture->pSrcMeshFaceIndices, utest_fixture->pSrcMeshFaceSizes, utest_fixture->numSrcMeshVertices, utest_fixture->numSrcMeshFaces,
+                  utest_fixture->pCutMeshVertices, utest_fixture->pCutMeshFaceIndices, utest_fixture->pCutMeshFaceSizes, utest_fixture->numCutMeshVertices, utest_fixture->numCutMeshFaces,
+                  1, NULL, NULL),
+        MC_INVALID_VALUE);
+    ASSERT_EQ(mcGetIntersectingFacePairs(utest_fixture->context_, 0,
+                  utest_fixture->pSrcMeshVertices, utest_fixture->pSrcMeshFaceIndices, utest_fixture->pSrcMeshFaceSizes, utest_fixture->numSrcMeshVertices, utest_fixture->numSrcMeshFaces,
+                  utest_fixture->pCutMeshVertices, utest_fixture->pCutMeshFaceIndices, utest_fixture->pCutMeshFaceSizes, utest_fixture->numCutMeshVertices, utest_fixture->numCutMeshFaces,
+                  1, facePair, NULL),
+        MC_INVALID_VALUE);
+}
@@ -0,0 +1,268 @@
+#include "utest.h"
+#include <mcut/mcut.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "benchmarkPair.h"
+
+#ifdef _WIN32
+#pragma warning(disable : 26812) // Unscoped enums from mcut.h
+#endif // _WIN32
+
+struct MapConnectedComponentData : BenchmarkPair {
+    McContext context_ = MC_NULL_HANDLE;
+
+    std::vector<McConnectedComponent> connComps_;
+};
+
+UTEST_F_SETUP(MapConnectedComponentData)
+{
+    McResult err = mcCreateContext(&utest_fixture->context_, 0);
+    EXPECT_TRUE(utest_fixture->context_ != NULL);
+    EXPECT_EQ(err, MC_NO_ERROR);
+
+    EXPECT_TRUE(loadBenchmarkPair(*utest_fixture, "src-mesh014.off", "cut-mesh014.off"));
+}
+
+// dispatch and get the fragments
+static McResult dispatchAndGetFragments(MapConnectedComponentData* fixture, McFlags dispatchFlags = 0)
+{
+    McResult err = mcDispatch(
+        fixture->context_,
+        MC_DISPATCH_VERTEX_ARRAY_FLOAT | dispatchFlags,
+        fixture->pSrcMeshVertices,
+        fixture->pSrcMeshFaceIndices,
+        fixture->pSrcMeshFaceSizes,
+        fixture->numSrcMeshVertices,
+        fixture->numSrcMeshFaces,
+        fixture->pCutMeshVertices,
+        fixture->pCutMeshFaceIndices,
+        fixture->pCutMeshFaceSizes,
+        fixture->numCutMeshVertices,
+        fixture->numCutMeshFaces);
+
+    if (err != MC_NO_ERROR) {
+        return err;
+    }
+
+    uint32_t numConnComps = 0;
+    err = mcGetConnectedComponents(fixture->context_, MC_CONNECTED_COMPONENT_TYPE_FRAGMENT, 0, NULL, &numConnComps);
+
+    if (err != MC_NO_ERROR || numConnComps == 0) {
+        return err;
+    }
+
+    fixture->connComps_.resize(numConnComps);
+    return mcGetConnectedComponents(fixture->context_, MC_CONNECTED_COMPONENT_TYPE_FRAGMENT, numConnComps, &fixture->connComps_[0], NULL);
+}
+
+UTEST_F_TEARDOWN(MapConnectedComponentData)
+{
+    // also releases the connected components
+    EXPECT_EQ(mcReleaseContext(utest_fixture->context_), MC_NO_ERROR);
+
+    freeBenchmarkPair(*utest_fixture);
+}
+
+UTEST_F(MapConnectedComponentData, sameAsCopiedData)
+{
+    ASSERT_EQ(dispatchAndGetFragments(utest_fixture), MC_NO_ERROR);
+    ASSERT_GT(utest_fixture->connComps_.size(), (size_t)0);
+
+    const McFlags queryFlags[] = {
+        MC_CONNECTED_COMPONENT_DATA_VERTEX_FLOAT,
+        MC_CONNECTED_COMPONENT_DATA_VERTEX_DOUBLE,
+        MC_CONNECTED_COMPONENT_DATA_FACE,
+        MC_CONNECTED_COMPONENT_DATA_FACE_SIZE,
+        MC_CONNECTED_COMPONENT_DATA_EDGE,
+        MC_CONNECTED_COMPONENT_DATA_SEAM_VERTEX
+    };
+
+    for (uint32_t i = 0; i < (uint32_t)utest_fixture->connComps_.size(); ++i) {
+        const McConnectedComponent cc = utest_fixture->connComps_[i];
+
+        for (uint32_t j = 0; j < sizeof(queryFlags) / sizeof(queryFlags[0]); ++j) {
+            uint64_t numBytes = 0;
+            ASSERT_EQ(mcGetConnectedComponentData(utest_fixture->context_, cc, queryFlags[j], 0, NULL, &numBytes), MC_NO_ERROR);
+
+            std::vector<char> copied((size_t)numBytes);
+            if (numBytes > 0) {
+                ASSERT_EQ(mcGetConnectedComponentData(utest_fixture->context_, cc, queryFlags[j], numBytes, &copied[0], NULL), MC_NO_ERROR);
+            }
+
+            const void* pMapped = NULL;
+            uint64_t numMappedBytes = 0;
+            ASSERT_EQ(mcMapConnectedComponentData(utest_fixture->context_, cc, queryFlags[j], &pMapped, &numMappedBytes), MC_NO_ERROR);
+            ASSERT_EQ(numMappedBytes, numBytes);
+
+            if (numBytes > 0) {
+                ASSERT_TRUE(pMapped != NULL);
+                ASSERT_EQ(memcmp(pMapped, &copied[0], (size_t)numBytes), 0);
+            }
+
+            ASSERT_EQ(mcUnmapConnectedComponentData(utest_fixture->context_, cc, queryFlags[j]), MC_NO_ERROR);
+        }
+    }
+}
+
+UTEST_F(MapConnectedComponentData, invalidFlag)
+{
+    ASSERT_EQ(dispatchAndGetFragments(utest_fixture), MC_NO_ERROR);
+    ASSERT_GT(utest_fixture->connComps_.size(), (size_t)0);
+
+    const void* pMapped = NULL;
+    ASSERT_EQ(mcMapConnectedComponentData(utest_fixture->context_, utest_fixture->connComps_[0], MC_CONNECTED_COMPONENT_DATA_VERTEX_COUNT, &pMapped, NULL), MC_INVALID_VALUE);
+    ASSERT_EQ(mcMapConnectedComponentData(utest_fixture->context_, utest_fixture->connComps_[0], MC_CONNECTED_COMPONENT_DATA_FACE, NULL, NULL), MC_INVALID_VALUE);
+}
+
+UTEST_F(MapConnectedComponentData, floatOutputVertices)
+{
+    ASSERT_EQ(dispatchAndGetFragments(utest_fixture), MC_NO_ERROR);
+    ASSERT_GT(utest_fixture->connComps_.size(), (size_t)0);
+
+    std::vector<std::vector<double>> vertices(utest_fixture->connComps_.size());
+
+    for (uint32_t i = 0; i < (uint32_t)utest_fixture->connComps_.size(); ++i) {
+        uint64_t numBytes = 0;
+        ASSERT_EQ(mcGetConnectedComponentData(utest_fixture->context_, utest_fixture->connComps_[i], MC_CONNECTED_COMPONENT_DATA_VERTEX_DOUBLE, 0, NULL, &numBytes), MC_NO_ERROR);
+        vertices[i].resize((size_t)(numBytes / sizeof(double)));
+        ASSERT_EQ(mcGetConnectedComponentData(utest_fixture->context_, utest_fixture->connComps_[i], MC_CONNECTED_COMPONENT_DATA_VERTEX_DOUBLE, numBytes, &vertices[i][0], NULL), MC_NO_ERROR);
+    }
+
+    ASSERT_EQ(mcReleaseConnectedComponents(utest_fixture->context_, 0, NULL), MC_NO_ERROR);
+
+    // same cut, but the output vertices are stored as floats
+    ASSERT_EQ(dispatchAndGetFragments(utest_fixture, MC_DISPATCH_OUTPUT_VERTEX_ARRAY_FLOAT), MC_NO_ERROR);
+    ASSERT_EQ(utest_fixture->connComps_.size(), vertices.size());
+
+    // NOTE: the order of the connected components may differ between dispatches
+    std::vector<bool> matched(vertices.size(), false);
+
+    for (uint32_t i = 0; i < (uint32_t)utest_fixture->connComps_.size(); ++i) {
+        const McConnectedComponent cc = utest_fixture->connComps_[i];
+
+        const void* pMapped = NULL;
+        uint64_t numMappedBytes = 0;
+        ASSERT_EQ(mcMapConnectedComponentData(utest_fixture->context_, cc, MC_CONNECTED_COMPONENT_DATA_VERTEX_FLOAT, &pMapped, &numMappedBytes), MC_NO_ERROR);
+
+        const size_t numCoords = (size_t)(numMappedBytes / sizeof(float));
+        std::vector<double> copied(numCoords);
+        ASSERT_EQ(mcGetConnectedComponentData(utest_fixture->context_, cc, MC_CONNECTED_COMPONENT_DATA_VERTEX_DOUBLE, numCoords * sizeof(double), &copied[0], NULL), MC_NO_ERROR);
+
+        bool found = false;
+
+        for (size_t k = 0; k < vertices.size() && !found; ++k) {
+            if (matched[k] || vertices[k].size() != numCoords) {
+                continue;
+            }
+
+            found = true;
+
+            for (size_t j = 0; j < numCoords && found; ++j) {
+                found = ((const float*)pMapped)[j] == (float)vertices[k][j] && copied[j] == (double)(float)vertices[k][j];
+            }
+
+            matched[k] = found;
+        }
+
+        ASSERT_TRUE(found);
+        ASSERT_EQ(mcUnmapConnectedComponentData(utest_fixture->context_, cc, MC_CONNECTED_COMPONENT_DATA_VERTEX_FLOAT), MC_NO_ERROR);
+    }
+}
+
+struct AllocatorStats {
+    int numAllocations = 0;
+    int numFrees = 0;
+};
+
+static void* countingAllocate(uint64_t numBytes, uint64_t alignment, const void* userParam)
+{
+    (void)alignment; // malloc is suitably aligned for all types
+    AllocatorStats* stats = (AllocatorStats*)userParam;
+    stats->numAllocations++;
+    return malloc((size_t)numBytes);
+}
+
+static void countingFree(void* pMem, const void* userParam)
+{
+    AllocatorStats* stats = (AllocatorStats*)userParam;
+    stats->numFrees++;
+    free(pMem);
+}
+
+UTEST_F(MapConnectedComponentData, userAllocator)
+{
+    AllocatorStats stats;
+
+    // must be set together
+    ASSERT_EQ(mcSetConnectedComponentAllocator(utest_fixture->context_, countingAllocate, NULL, &stats), MC_INVALID_VALUE);
+    ASSERT_EQ(mcSetConnectedComponentAllocator(utest_fixture->context_, countingAllocate, countingFree, &stats), MC_NO_ERROR);
+
+    ASSERT_EQ(dispatchAndGetFragments(utest_fixture), MC_NO_ERROR);
+    ASSERT_GT(utest_fixture->connComps_.size(), (size_t)0);
+
+    ASSERT_EQ(stats.numAllocations, 0); // nothing is converted until queried
+
+    const void* pMapped = NULL;
+    uint64_t numBytes = 0;
+    ASSERT_EQ(mcMapConnectedComponentData(utest_fixture->context_, utest_fixture->connComps_[0], MC_CONNECTED_COMPONENT_DATA_FACE, &pMapped, &numBytes), MC_NO_ERROR);
+    ASSERT_TRUE(pMapped != NULL);
+    ASSERT_GT(stats.numAllocations, 0);
+
+    const int numConversionAllocations = stats.numAllocations;
+
+    ASSERT_EQ(mcMapConnectedComponentData(utest_fixture->context_, utest_fixture->connComps_[0], MC_CONNECTED_COMPONENT_DATA_VERTEX_FLOAT, &pMapped, &numBytes), MC_NO_ERROR);
+    ASSERT_EQ(stats.numAllocations, numConversionAllocations + 1);
+    ASSERT_EQ(mcUnmapConnectedComponentData(utest_fixture->context_, utest_fixture->connComps_[0], MC_CONNECTED_COMPONENT_DATA_VERTEX_FLOAT), MC_NO_ERROR);
+    ASSERT_EQ(stats.numFrees, 1);
+
+    ASSERT_EQ(mcReleaseConnectedComponents(utest_fixture->context_, 0, NULL), MC_NO_ERROR);
+    ASSERT_EQ(stats.numFrees, stats.numAllocations);
+}
+
+UTEST_F(MapConnectedComponentData, bulkQuery)
+{
+    ASSERT_EQ(dispatchAndGetFragments(utest_fixture), MC_NO_ERROR);
+    ASSERT_GT(utest_fixture->connComps_.size(), (size_t)0);
+
+    const uint32_t numConnComps = (uint32_t)utest_fixture->connComps_.size();
+    std::vector<McConnectedComponentDataDesc> descs(numConnComps);
+
+    ASSERT_EQ(mcGetConnectedComponentsData(
+                  utest_fixture->context_,
+                  numConnComps,
+                  &utest_fixture->connComps_[0],
+                  MC_CONNECTED_COMPONENT_DATA_VERTEX_DOUBLE | MC_CONNECTED_COMPONENT_DATA_FACE | MC_CONNECTED_COMPONENT_DATA_FACE_SIZE,
+                  &descs[0]),
+        MC_NO_ERROR);
+
+    for (uint32_t i = 0; i < numConnComps; ++i) {
+        const McConnectedComponent cc = utest_fixture->connComps_[i];
+        const McConnectedComponentDataDesc& desc = descs[i];
+
+        ASSERT_EQ(desc.type, MC_CONNECTED_COMPONENT_TYPE_FRAGMENT);
+
+        uint32_t numVertices = 0;
+        ASSERT_EQ(mcGetConnectedComponentData(utest_fixture->context_, cc, MC_CONNECTED_COMPONENT_DATA_VERTEX_COUNT, sizeof(uint32_t), &numVertices, NULL), MC_NO_ERROR);
+        ASSERT_EQ(desc.numVertices, numVertices);
+
+        uint32_t numFaces = 0;
+        ASSERT_EQ(mcGetConnectedComponentData(utest_fixture->context_, cc, MC_CONNECTED_COMPONENT_DATA_FACE_COUNT, sizeof(uint32_t), &numFaces, NULL), MC_NO_ERROR);
+        ASSERT_EQ(desc.numFaces, numFaces);
+
+        // the same arrays as those that are mapped individually
+        const void* pMapped = NULL;
+        ASSERT_EQ(mcMapConnectedComponentData(utest_fixture->context_, cc, MC_CONNECTED_COMPONENT_DATA_VERTEX_DOUBLE, &pMapped, NULL), MC_NO_ERROR);
+        ASSERT_TRUE(pMapped == (const void*)desc.pVerticesDouble);
+        ASSERT_EQ(mcMapConnectedComponentData(utest_fixture->context_, cc, MC_CONNECTED_COMPONENT_DATA_FACE, &pMapped, NULL), MC_NO_ERROR);
+        ASSERT_TRUE(pMapped == (const void*)desc.pFaceIndices);
+        ASSERT_EQ(mcMapConnectedComponentData(utest_fixture->context_, cc, MC_CONNECTED_COMPONENT_DATA_FACE_SIZE, &pMapped, NULL), MC_NO_ERROR);
+        ASSERT_TRUE(pMapped == (const void*)desc.pFaceSizes);
+
+        // not requested
+        ASSERT_TRUE(desc.pVerticesFloat == NULL);
+        ASSERT_TRUE(desc.pEdges == NULL);
+    }
+}
@@ -0,0 +1,403 @@
+#include "utest.h"
+#include <algorithm>
+#include <mcut/mcut.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "benchmarkPair.h"
+
+#ifdef _WIN32
+#pragma warning(disable : 26812) // Unscoped enums from mcut.h
+#endif // _WIN32
+
+struct MeshHandle : BenchmarkPair {
+    McContext context_ = MC_NULL_HANDLE;
+};
+
+UTEST_F_SETUP(MeshHandle)
+{
+    McResult err = mcCreateContext(&utest_fixture->context_, 0);
+    EXPECT_TRUE(utest_fixture->context_ != NULL);
+    EXPECT_EQ(err, MC_NO_ERROR);
+
+    EXPECT_TRUE(loadBenchmarkPair(*utest_fixture, "src-mesh014.off", "cut-mesh014.off"));
+}
+
+UTEST_F_TEARDOWN(MeshHandle)
+{
+    // also releases the meshes
+    EXPECT_EQ(mcReleaseContext(utest_fixture->context_), MC_NO_ERROR);
+
+    freeBenchmarkPair(*utest_fixture);
+}
+
+// get the vertices of all connected components in the context (sorted, since the order of the
+// connected components is unspecified) and then release the connected components
+static McResult getAndReleaseConnComps(McContext context, std::vector<std::vector<double>>& connCompVertices)
+{
+    connCompVertices.clear();
+
+    uint32_t numConnComps = 0;
+    McResult err = mcGetConnectedComponents(context, MC_CONNECTED_COMPONENT_TYPE_ALL, 0, NULL, &numConnComps);
+
+    if (err != MC_NO_ERROR || numConnComps == 0) {
+        return err;
+    }
+
+    std::vector<McConnectedComponent> connComps(numConnComps);
+    err = mcGetConnectedComponents(context, MC_CONNECTED_COMPONENT_TYPE_ALL, numConnComps, &connComps[0], NULL);
+
+    if (err != MC_NO_ERROR) {
+        return err;
+    }
+
+    std::vector<McConnectedComponentDataDesc> descs(numConnComps);
+    err = mcGetConnectedComponentsData(context, numConnComps, &connComps[0], MC_CONNECTED_COMPONENT_DATA_VERTEX_DOUBLE, &descs[0]);
+
+    if (err != MC_NO_ERROR) {
+        return err;
+    }
+
+    for (uint32_t i = 0; i < numConnComps; ++i) {
+        connCompVertices.emplace_back(descs[i].pVerticesDouble, descs[i].pVerticesDouble + descs[i].numVertices * 3);
+    }
+
+    std::sort(connCompVertices.begin(), connCompVertices.end());
+
+    return mcReleaseConnectedComponents(context, 0, NULL);
+}
+
+UTEST_F(MeshHandle, sameAsDispatch)
+{
+    ASSERT_EQ(mcDispatch(utest_fixture->context_, MC_DISPATCH_VERTEX_ARRAY_FLOAT,
+                  utest_fixture->pSrcMeshVertices, utest_fixture->pSrcMeshFaceIndices, utest_fixture->pSrcMeshFaceSizes, utest_fixture->numSrcMeshVertices, utest_fixture->numSrcMeshFaces,
+                  utest_fixture->pCutMeshVertices, utest_fixture->pCutMeshFaceIndices, utest_fixture->pCutMeshFaceSizes, utest_fixture->numCutMeshVertices, utest_fixture->numCutMeshFaces),
+        MC_NO_ERROR);
+
+    std::vector<std::vector<double>> expected;
+    ASSERT_EQ(getAndReleaseConnComps(utest_fixture->context_, expected), MC_NO_ERROR);
+    ASSERT_GT(expected.size(), (size_t)0);
+
+    McMesh srcMesh = MC_NULL_HANDLE;
+    ASSERT_EQ(mcCreateMesh(utest_fixture->context_, MC_DISPATCH_VERTEX_ARRAY_FLOAT,
+                  utest_fixture->pSrcMeshVertices, utest_fixture->pSrcMeshFaceIndices, utest_fixture->pSrcMeshFaceSizes, utest_fixture->numSrcMeshVertices, utest_fixture->numSrcMeshFaces, &srcMesh),
+        MC_NO_ERROR);
+    ASSERT_TRUE(srcMesh != MC_NULL_HANDLE);
+
+    // the same mesh is cut repeatedly
+    for (int i = 0; i < 2; ++i) {
+        ASSERT_EQ(mcDispatchMesh(utest_fixture->context_, MC_DISPATCH_VERTEX_ARRAY_FLOAT, srcMesh,
+                      utest_fixture->pCutMeshVertices, utest_fixture->pCutMeshFaceIndices, utest_fixture->pCutMeshFaceSizes, utest_fixture->numCutMeshVertices, utest_fixture->numCutMeshFaces),
+            MC_NO_ERROR);
+
+        std::vector<std::vector<double>> result;
+        ASSERT_EQ(getAndReleaseConnComps(utest_fixture->context_, result), MC_NO_ERROR);
+        ASSERT_TRUE(result == expected);
+    }
+
+    ASSERT_EQ(mcReleaseMeshes(utest_fixture->context_, 1, &srcMesh), MC_NO_ERROR);
+    ASSERT_EQ(mcDispatchMesh(utest_fixture->context_, MC_DISPATCH_VERTEX_ARRAY_FLOAT, srcMesh,
+                  utest_fixture->pCutMeshVertices, utest_fixture->pCutMeshFaceIndices, utest_fixture->pCutMeshFaceSizes, utest_fixture->numCutMeshVertices, utest_fixture->numCutMeshFaces),
+        MC_INVALID_VALUE);
+}
+
+UTEST_F(MeshHandle, updateMesh)
+{
+    ASSERT_EQ(mcDispatch(utest_fixture->context_, MC_DISPATCH_VERTEX_ARRAY_FLOAT,
+                  utest_fixture->pSrcMeshVertices, utest_fixture->pSrcMeshFaceIndices, utest_fixture->pSrcMeshFaceSizes, utest_fixture->numSrcMeshVertices, utest_fixture->numSrcMeshFaces,
+                  utest_fixture->pCutMeshVertices, utest_fixture->pCutMeshFaceIndices, utest_fixture->pCutMeshFaceSizes, utest_fixture->numCutMeshVertices, utest_fixture->numCutMeshFaces),
+        MC_NO_ERROR);
+
+    std::vector<std::vector<double>> expected;
+    ASSERT_EQ(getAndReleaseConnComps(utest_fixture->context_, expected), MC_NO_ERROR);
+
+    // created with other geometry
+    McMesh srcMesh = MC_NULL_HANDLE;
+    ASSERT_EQ(mcCreateMesh(utest_fixture->context_, MC_DISPATCH_VERTEX_ARRAY_FLOAT,
+                  utest_fixture->pCutMeshVertices, utest_fixture->pCutMeshFaceIndices, utest_fixture->pCutMeshFaceSizes, utest_fixture->numCutMeshVertices, utest_fixture->numCutMeshFaces, &srcMesh),
+        MC_NO_ERROR);
+
+    ASSERT_EQ(mcUpdateMesh(utest_fixture->context_, srcMesh, MC_DISPATCH_VERTEX_ARRAY_FLOAT,
+                  utest_fixture->pSrcMeshVertices, utest_fixture->pSrcMeshFaceIndices, utest_fixture->pSrcMeshFaceSizes, utest_fixture->numSrcMeshVertices, utest_fixture->numSrcMeshFaces),
+        MC_NO_ERROR);
+
+    // invalid geometry leaves the mesh unchanged
+    ASSERT_EQ(mcUpdateMesh(utest_fixture->context_, srcMesh, MC_DISPATCH_VERTEX_ARRAY_FLOAT,
+                  utest_fixture->pSrcMeshVertices, utest_fixture->pSrcMeshFaceIndices, utest_fixture->pSrcMeshFaceSizes, 0, utest_fixture->numSrcMeshFaces),
+        MC_INVALID_VALUE);
+
+    ASSERT_EQ(mcDispatchMesh(utest_fixture->context_, MC_DISPATCH_VERTEX_ARRAY_FLOAT, srcMesh,
+                  utest_fixture->pCutMeshVertices, utest_fixture->pCutMeshFaceIndices, utest_fixture->pCutMeshFaceSizes, utest_fixture->numCutMeshVertices, utest_fixture->numCutMeshFaces),
+        MC_NO_ERROR);
+
+    std::vector<std::vector<double>> result;
+    ASSERT_EQ(getAndReleaseConnComps(utest_fixture->context_, result), MC_NO_ERROR);
+    ASSERT_TRUE(result == expected);
+}
+
+UTEST_F(MeshHandle, refitMesh)
+{
+    ASSERT_EQ(mcDispatch(utest_fixture->context_, MC_DISPATCH_VERTEX_ARRAY_FLOAT,
+                  utest_fixture->pSrcMeshVertices, utest_fixture->pSrcMeshFaceIndices, utest_fixture->pSrcMeshFaceSizes, utest_fixture->numSrcMeshVertices, utest_fixture->numSrcMeshFaces,
+                  utest_fixture->pCutMeshVertices, utest_fixture->pCutMeshFaceIndices, utest_fixture->pCutMeshFaceSizes, utest_fixture->numCutMeshVertices, utest_fixture->numCutMeshFaces),
+        MC_NO_ERROR);
+
+    std::vector<std::vector<double>> expected;
+    ASSERT_EQ(getAndReleaseConnComps(utest_fixture->context_, expected), MC_NO_ERROR);
+
+    McMesh srcMesh = MC_NULL_HANDLE;
+    ASSERT_EQ(mcCreateMesh(utest_fixture->context_, MC_DISPATCH_VERTEX_ARRAY_FLOAT,
+                  utest_fixture->pSrcMeshVertices, utest_fixture->pSrcMeshFaceIndices, utest_fixture->pSrcMeshFaceSizes, utest_fixture->numSrcMeshVertices, utest_fixture->numSrcMeshFaces, &srcMesh),
+        MC_NO_ERROR);
+
+    // scramble the vertices (which degrades the BVH enough for it to be rebuilt), and then move them back
+    const uint32_t numVertices = utest_fixture->numSrcMeshVertices;
+    std::vector<double> scrambledVertices(numVertices * 3);
+
+    for (uint32_t i = 0; i < numVertices; ++i) {
+        const float* vertex = utest_fixture->pSrcMeshVertices + ((numVertices - 1 - i) * 3);
+        std::copy(vertex, vertex + 3, &scrambledVertices[i * 3]);
+    }
+
+    ASSERT_EQ(mcRefitMesh(utest_fixture->context_, srcMesh, MC_DISPATCH_VERTEX_ARRAY_DOUBLE, &scrambledVertices[0]), MC_NO_ERROR);
+    ASSERT_EQ(mcRefitMesh(utest_fixture->context_, srcMesh, MC_DISPATCH_VERTEX_ARRAY_FLOAT, utest_fixture->pSrcMeshVertices), MC_NO_ERROR);
+
+    ASSERT_EQ(mcDispatchMesh(utest_fixture->context_, MC_DISPATCH_VERTEX_ARRAY_FLOAT, srcMesh,
+                  utest_fixture->pCutMeshVertices, utest_fixture->pCutMeshFaceIndices, utest_fixture->pCutMeshFaceSizes, utest_fixture->numCutMeshVertices, utest_fixture->numCutMeshFaces),
+        MC_NO_ERROR);
+
+    std::vector<std::vector<double>> result;
+    ASSERT_EQ(getAndReleaseConnComps(utest_fixture->context_, result), MC_NO_ERROR);
+    ASSERT_TRUE(result == expected);
+
+    ASSERT_EQ(mcRefitMesh(utest_fixture->context_, srcMesh, 0, utest_fixture->pSrcMeshVertices), MC_INVALID_VALUE);
+    ASSERT_EQ(mcRefitMesh(utest_fixture->context_, srcMesh, MC_DISPATCH_VERTEX_ARRAY_FLOAT, NULL), MC_INVALID_VALUE);
+}
+
+UTEST_F(MeshHandle, setMeshTransform)
+{
+    ASSERT_EQ(mcDispatch(utest_fixture->context_, MC_DISPATCH_VERTEX_ARRAY_FLOAT,
+                  utest_fixture->pSrcMeshVertices, utest_fixture->pSrcMeshFaceIndices, utest_fixture->pSrcMeshFaceSizes, utest_fixture->numSrcMeshVertices, utest_fixture->numSrcMeshFaces,
+                  utest_fixture->pCutMeshVertices, utest_fixture->pCutMeshFaceIndices, utest_fixture->pCutMeshFaceSizes, utest_fixture->numCutMeshVertices, utest_fixture->numCutMeshFaces),
+        MC_NO_ERROR);
+
+    std::vector<std::vector<double>> expected;
+    ASSERT_EQ(getAndReleaseConnComps(utest_fixture->context_, expected), MC_NO_ERROR);
+
+    // the mesh is created away from the cut-mesh, and moved back by its transform
+    // NOTE: the offset is a power of two so that the translations are exact
+    const double offset = 64.0;
+    std::vector<double> translatedVertices(utest_fixture->pSrcMeshVertices, utest_fixture->pSrcMeshVertices + (utest_fixture->numSrcMeshVertices * 3));
+
+    for (uint32_t i = 0; i < utest_fixture->numSrcMeshVertices; ++i) {
+        translatedVertices[i * 3] += offset;
+    }
+
+    McMesh srcMesh = MC_NULL_HANDLE;
+    ASSERT_EQ(mcCreateMesh(utest_fixture->context_, MC_DISPATCH_VERTEX_ARRAY_DOUBLE,
+                  &translatedVertices[0], utest_fixture->pSrcMeshFaceIndices, utest_fixture->pSrcMeshFaceSizes, utest_fixture->numSrcMeshVertices, utest_fixture->numSrcMeshFaces, &srcMesh),
+        MC_NO_ERROR);
+
+    const double transform[16] = {
+        1, 0, 0, -offset,
+        0, 1, 0, 0,
+        0, 0, 1, 0,
+        0, 0, 0, 1
+    };
+
+    ASSERT_EQ(mcSetMeshTransform(utest_fixture->context_, srcMesh, transform), MC_NO_ERROR);
+
+    // transforms are not accumulated, and also apply to refitted vertices
+    for (int i = 0; i < 2; ++i) {
+        if (i == 1) {
+            ASSERT_EQ(mcSetMeshTransform(utest_fixture->context_, srcMesh, transform), MC_NO_ERROR);
+            ASSERT_EQ(mcRefitMesh(utest_fixture->context_, srcMesh, MC_DISPATCH_VERTEX_ARRAY_DOUBLE, &translatedVertices[0]), MC_NO_ERROR);
+        }
+
+        ASSERT_EQ(mcDispatchMesh(utest_fixture->context_, MC_DISPATCH_VERTEX_ARRAY_FLOAT, srcMesh,
+                      utest_fixture->pCutMeshVertices, utest_fixture->pCutMeshFaceIndices, utest_fixture->pCutMeshFaceSizes, utest_fixture->numCutMeshVertices, utest_fixture->numCutMeshFaces),
+            MC_NO_ERROR);
+
+        std::vector<std::vector<double>> result;
+        ASSERT_EQ(getAndReleaseConnComps(utest_fixture->context_, result), MC_NO_ERROR);
+        ASSERT_TRUE(result == expected);
+    }
+
+    // back to the identity, where the meshes do not intersect
+    ASSERT_EQ(mcSetMeshTransform(utest_fixture->context_, srcMesh, NULL), MC_NO_ERROR);
+    ASSERT_EQ(mcDispatchMesh(utest_fixture->context_, MC_DISPATCH_VERTEX_ARRAY_FLOAT, srcMesh,
+                  utest_fixture->pCutMeshVertices, utest_fixture->pCutMeshFaceIndices, utest_fixture->pCutMeshFaceSizes, utest_fixture->numCutMeshVertices, utest_fixture->numCutMeshFaces),
+        MC_NO_ERROR);
+
+    std::vector<std::vector<double>> result;
+    ASSERT_EQ(getAndReleaseConnComps(utest_fixture->context_, result), MC_NO_ERROR);
+    ASSERT_TRUE(result != expected);
+
+    const double projection[16] = {
+        1, 0, 0, 0,
+        0, 1, 0, 0,
+        0, 0, 1, 0,
+        0, 0, 1, 0
+    };
+
+    ASSERT_EQ(mcSetMeshTransform(utest_fixture->context_, srcMesh, projection), MC_INVALID_VALUE);
+}
+
+UTEST_F(MeshHandle, dispatchMeshesWithTransform)
+{
+    // rotation by 90 degrees about the z-axis, and a translation
+    // NOTE: the coefficients are chosen so that the transformed vertices are exact
+    const double transform[16] = {
+        0, -1, 0, 0.5,
+        1, 0, 0, 0,
+        0, 0, 1, -0.25,
+        0, 0, 0, 1
+    };
+
+    std::vector<double> srcMeshVertices(utest_fixture->pSrcMeshVertices, utest_fixture->pSrcMeshVertices + (utest_fixture->numSrcMeshVertices * 3));
+    std::vector<double> transformedCutMeshVertices(utest_fixture->numCutMeshVertices * 3);
+
+    for (uint32_t i = 0; i < utest_fixture->numCutMeshVertices; ++i) {
+        const float* v = utest_fixture->pCutMeshVertices + (i * 3);
+
+        for (uint32_t j = 0; j < 3; ++j) {
+            const double* row = transform + (j * 4);
+            transformedCutMeshVertices[(i * 3) + j] = (v[0] * row[0]) + (v[1] * row[1]) + (v[2] * row[2]) + row[3];
+        }
+    }
+
+    ASSERT_EQ(mcDispatch(utest_fixture->context_, MC_DISPATCH_VERTEX_ARRAY_DOUBLE,
+                  &srcMeshVertices[0], utest_fixture->pSrcMeshFaceIndices, utest_fixture->pSrcMeshFaceSizes, utest_fixture->numSrcMeshVertices, utest_fixture->numSrcMeshFaces,
+                  &transformedCutMeshVertices[0], utest_fixture->pCutMeshFaceIndices, utest_fixture->pCutMeshFaceSizes, utest_fixture->numCutMeshVertices, utest_fixture->numCutMeshFaces),
+        MC_NO_ERROR);
+
+    std::vector<std::vector<double>> expected;
+    ASSERT_EQ(getAndReleaseConnComps(utest_fixture->context_, expected), MC_NO_ERROR);
+    ASSERT_GT(expected.size(), (size_t)0);
+
+    McMesh meshes[2] = { MC_NULL_HANDLE, MC_NULL_HANDLE };
+    ASSERT_EQ(mcCreateMesh(utest_fixture->context_, MC_DISPATCH_VERTEX_ARRAY_FLOAT,
+                  utest_fixture->pSrcMeshVertices, utest_fixture->pSrcMeshFaceIndices, utest_fixture->pSrcMeshFaceSizes, utest_fixture->numSrcMeshVertices, utest_fixture->numSrcMeshFaces, &meshes[0]),
+        MC_NO_ERROR);
+    ASSERT_EQ(mcCreateMesh(utest_fixture->context_, MC_DISPATCH_VERTEX_ARRAY_FLOAT,
+                  utest_fixture->pCutMeshVertices, utest_fixture->pCutMeshFaceIndices, utest_fixture->pCutMeshFaceSizes, utest_fixture->numCutMeshVertices, utest_fixture->numCutMeshFaces, &meshes[1]),
+        MC_NO_ERROR);
+
+    // the same cut-mesh is used at many poses
+    for (int i = 0; i < 2; ++i) {
+        ASSERT_EQ(mcDispatchMeshes(utest_fixture->context_, 0, meshes[0], meshes[1], transform), MC_NO_ERROR);
+
+        std::vector<std::vector<double>> result;
+        ASSERT_EQ(getAndReleaseConnComps(utest_fixture->context_, result), MC_NO_ERROR);
+        ASSERT_TRUE(result == expected);
+    }
+
+    // the cut-mesh is moved away from the source-mesh
+    double translation[16] = {
+        1, 0, 0, 1024,
+        0, 1, 0, 0,
+        0, 0, 1, 0,
+        0, 0, 0, 1
+    };
+
+    ASSERT_EQ(mcDispatchMeshes(utest_fixture->context_, 0, meshes[0], meshes[1], translation), MC_NO_ERROR);
+
+    uint32_t numConnComps = 0;
+    ASSERT_EQ(mcGetConnectedComponents(utest_fixture->context_, MC_CONNECTED_COMPONENT_TYPE_ALL, 0, NULL, &numConnComps), MC_NO_ERROR);
+    ASSERT_EQ(numConnComps, (uint32_t)0);
+
+    translation[15] = 2;
+    ASSERT_EQ(mcDispatchMeshes(utest_fixture->context_, 0, meshes[0], meshes[1], translation), MC_INVALID_VALUE);
+    ASSERT_EQ(mcDispatchMeshes(utest_fixture->context_, 0, meshes[0], MC_NULL_HANDLE, NULL), MC_INVALID_VALUE);
+}
+
+UTEST_F(MeshHandle, setCutMeshTransform)
+{
+    // the same pose as in "dispatchMeshesWithTransform", which is split into the transform of the
+    // cut-mesh (a rotation) followed by the transform of the dispatch (a translation)
+    const double rotation[16] = {
+        0, -1, 0, 0,
+        1, 0, 0, 0,
+        0, 0, 1, 0,
+        0, 0, 0, 1
+    };
+
+    const double translation[16] = {
+        1, 0, 0, 0.5,
+        0, 1, 0, 0,
+        0, 0, 1, -0.25,
+        0, 0, 0, 1
+    };
+
+    std::vector<double> srcMeshVertices(utest_fixture->pSrcMeshVertices, utest_fixture->pSrcMeshVertices + (utest_fixture->numSrcMeshVertices * 3));
+    std::vector<double> transformedCutMeshVertices(utest_fixture->numCutMeshVertices * 3);
+
+    for (uint32_t i = 0; i < utest_fixture->numCutMeshVertices; ++i) {
+        const float* v = utest_fixture->pCutMeshVertices + (i * 3);
+        transformedCutMeshVertices[(i * 3) + 0] = -v[1] + 0.5;
+        transformedCutMeshVertices[(i * 3) + 1] = v[0];
+        transformedCutMeshVertices[(i * 3) + 2] = v[2] - 0.25;
+    }
+
+    ASSERT_EQ(mcDispatch(utest_fixture->context_, MC_DISPATCH_VERTEX_ARRAY_DOUBLE,
+                  &srcMeshVertices[0], utest_fixture->pSrcMeshFaceIndices, utest_fixture->pSrcMeshFaceSizes, utest_fixture->numSrcMeshVertices, utest_fixture->numSrcMeshFaces,
+                  &transformedCutMeshVertices[0], utest_fixture->pCutMeshFaceIndices, utest_fixture->pCutMeshFaceSizes, utest_fixture->numCutMeshVertices, utest_fixture->numCutMeshFaces),
+        MC_NO_ERROR);
+
+    std::vector<std::vector<double>> expected;
+    ASSERT_EQ(getAndReleaseConnComps(utest_fixture->context_, expected), MC_NO_ERROR);
+    ASSERT_GT(expected.size(), (size_t)0);
+
+    McMesh meshes[2] = { MC_NULL_HANDLE, MC_NULL_HANDLE };
+    ASSERT_EQ(mcCreateMesh(utest_fixture->context_, MC_DISPATCH_VERTEX_ARRAY_FLOAT,
+                  utest_fixture->pSrcMeshVertices, utest_fixture->pSrcMeshFaceIndices, utest_fixture->pSrcMeshFaceSizes, utest_fixture->numSrcMeshVertices, utest_fixture->numSrcMeshFaces, &meshes[0]),
+        MC_NO_ERROR);
+    ASSERT_EQ(mcCreateMesh(utest_fixture->context_, MC_DISPATCH_VERTEX_ARRAY_FLOAT,
+                  utest_fixture->pCutMeshVertices, utest_fixture->pCutMeshFaceIndices, utest_fixture->pCutMeshFaceSizes, utest_fixture->numCutMeshVertices, utest_fixture->numCutMeshFaces, &meshes[1]),
+        MC_NO_ERROR);
+
+    // the transform of the cut-mesh is applied before the transform of the dispatch
+    ASSERT_EQ(mcSetMeshTransform(utest_fixture->context_, meshes[1], rotation), MC_NO_ERROR);
+    ASSERT_EQ(mcDispatchMeshes(utest_fixture->context_, 0, meshes[0], meshes[1], translation), MC_NO_ERROR);
+
+    std::vector<std::vector<double>> result;
+    ASSERT_EQ(getAndReleaseConnComps(utest_fixture->context_, result), MC_NO_ERROR);
+    ASSERT_TRUE(result == expected);
+
+    // ... and is the only transform if the dispatch has none
+    double pose[16] = {
+        0, -1, 0, 0.5,
+        1, 0, 0, 0,
+        0, 0, 1, -0.25,
+        0, 0, 0, 1
+    };
+
+    ASSERT_EQ(mcSetMeshTransform(utest_fixture->context_, meshes[1], pose), MC_NO_ERROR);
+    ASSERT_EQ(mcDispatchMeshes(utest_fixture->context_, 0, meshes[0], meshes[1], NULL), MC_NO_ERROR);
+
+    ASSERT_EQ(getAndReleaseConnComps(utest_fixture->context_, result), MC_NO_ERROR);
+    ASSERT_TRUE(result == expected);
+
+    // the cut-mesh is moved away from the source-mesh
+    pose[3] = 1024;
+    ASSERT_EQ(mcSetMeshTransform(utest_fixture->context_, meshes[1], pose), MC_NO_ERROR);
+    ASSERT_EQ(mcDispatchMeshes(utest_fixture->context_, 0, meshes[0], meshes[1], NULL), MC_NO_ERROR);
+
+    uint32_t numConnComps = 0;
+    ASSERT_EQ(mcGetConnectedComponents(utest_fixture->context_, MC_CONNECTED_COMPONENT_TYPE_ALL, 0, NULL, &numConnComps), MC_NO_ERROR);
+    ASSERT_EQ(numConnComps, (uint32_t)0);
+}
+
+UTEST_F(MeshHandle, invalidVertexType)
+{
+    McMesh srcMesh = MC_NULL_HANDLE;
+
+    ASSERT_EQ(mcCreateMesh(utest_fixture->context_, 0,
+                  utest_fixture->pSrcMeshVertices, utest_fixture->pSrcMeshFaceIndices, utest_fixture->pSrcMeshFaceSizes, utest_fixture->numSrcMeshVertices, utest_fixture->numSrcMeshFaces, &srcMesh),
+        MC_INVALID_VALUE);
+    ASSERT_EQ(mcCreateMesh(utest_fixture->context_, MC_DISPATCH_VERTEX_ARRAY_FLOAT | MC_DISPATCH_VERTEX_ARRAY_DOUBLE,
+                  utest_fixture->pSrcMeshVertices, utest_fixture->pSrcMeshFaceIndices, utest_fixture->pSrcMeshFaceSizes, utest_fixture->numSrcMeshVertices, utest_fixture->numSrcMeshFaces, &srcMesh),
+        MC_INVALID_VALUE);
+    ASSERT_EQ(mcReleaseMeshes(utest_fixture->context_, 0, NULL), MC_NO_ERROR);
+}
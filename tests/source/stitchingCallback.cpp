@@ -0,0 +1,206 @@
+#include "utest.h"
+#include <mcut/mcut.h>
+#include <vector>
+
+#ifdef _WIN32
+#pragma warning(disable : 26812) // Unscoped enums from mcut.h
+#endif // _WIN32
+
+// a polygon received by the stitching callback
+struct StitchedPolygon {
+    McPatchLocation location;
+    uint32_t stitchIndex;
+    uint32_t cutMeshFace;
+    std::vector<uint32_t> vertexIds;
+    std::vector<double> vertexCoords;
+};
+
+struct StitchingCallback {
+    McContext context_ = MC_NULL_HANDLE;
+    std::vector<float> srcMeshVertices;
+    std::vector<uint32_t> srcMeshFaceIndices;
+    std::vector<uint32_t> srcMeshFaceSizes;
+    std::vector<float> cutMeshVertices;
+    std::vector<uint32_t> cutMeshFaceIndices;
+    std::vector<uint32_t> cutMeshFaceSizes;
+
+    std::vector<StitchedPolygon> stitchedPolygons;
+};
+
+static void saveStitchedPolygon(const McStitchedPolygonDesc* pPolygon, const void* userParam)
+{
+    std::vector<StitchedPolygon>& stitchedPolygons = *(std::vector<StitchedPolygon>*)userParam;
+
+    StitchedPolygon polygon;
+    polygon.location = pPolygon->location;
+    polygon.stitchIndex = pPolygon->stitchIndex;
+    polygon.cutMeshFace = pPolygon->cutMeshFace;
+    polygon.vertexIds.assign(pPolygon->pVertexIds, pPolygon->pVertexIds + pPolygon->numVertices);
+    polygon.vertexCoords.assign(pPolygon->pVertexCoords, pPolygon->pVertexCoords + ((size_t)pPolygon->numVertices * 3));
+
+    stitchedPolygons.push_back(polygon);
+}
+
+UTEST_F_SETUP(StitchingCallback)
+{
+    McResult err = mcCreateContext(&utest_fixture->context_, MC_NULL_HANDLE);
+    EXPECT_TRUE(utest_fixture->context_ != nullptr);
+    EXPECT_EQ(err, MC_NO_ERROR);
+
+    // NOTE: same meshes as hello world
+    utest_fixture->srcMeshVertices = {
+        -5, -5, 5, // 0
+        5, -5, 5, // 1
+        5, 5, 5, //2
+        -5, 5, 5, //3
+        -5, -5, -5, //4
+        5, -5, -5, //5
+        5, 5, -5, //6
+        -5, 5, -5 //7
+    };
+    utest_fixture->srcMeshFaceIndices = {
+        0, 1, 2, 3, //0
+        7, 6, 5, 4, //1
+        1, 5, 6, 2, //2
+        0, 3, 7, 4, //3
+        3, 2, 6, 7, //4
+        4, 5, 1, 0 //5
+    };
+    utest_fixture->srcMeshFaceSizes = { 4, 4, 4, 4, 4, 4 };
+
+    utest_fixture->cutMeshVertices = {
+        -20, -4, 0, //0
+        0, 20, 20, //1
+        20, -4, 0, //2
+        0, 20, -20 //3
+    };
+    utest_fixture->cutMeshFaceIndices = {
+        0, 1, 2, //0
+        0, 2, 3 //1
+    };
+    utest_fixture->cutMeshFaceSizes = { 3, 3 };
+}
+
+UTEST_F_TEARDOWN(StitchingCallback)
+{
+    EXPECT_EQ(mcReleaseContext(utest_fixture->context_), MC_NO_ERROR);
+}
+
+static McResult dispatch(StitchingCallback* fixture, McFlags dispatchFlags)
+{
+    return mcDispatch(
+        fixture->context_,
+        MC_DISPATCH_VERTEX_ARRAY_FLOAT | dispatchFlags,
+        fixture->srcMeshVertices.data(),
+        fixture->srcMeshFaceIndices.data(),
+        fixture->srcMeshFaceSizes.data(),
+        (uint32_t)(fixture->srcMeshVertices.size() / 3),
+        (uint32_t)fixture->srcMeshFaceSizes.size(),
+        fixture->cutMeshVertices.data(),
+        fixture->cutMeshFaceIndices.data(),
+        fixture->cutMeshFaceSizes.data(),
+        (uint32_t)(fixture->cutMeshVertices.size() / 3),
+        (uint32_t)fixture->cutMeshFaceSizes.size());
+}
+
+UTEST_F(StitchingCallback, invalidContext)
+{
+    ASSERT_EQ(mcSetStitchingCallback(MC_NULL_HANDLE, saveStitchedPolygon, &utest_fixture->stitchedPolygons), MC_INVALID_VALUE);
+}
+
+UTEST_F(StitchingCallback, stitchedPolygonsOfSealedFragments)
+{
+    ASSERT_EQ(mcSetStitchingCallback(utest_fixture->context_, saveStitchedPolygon, &utest_fixture->stitchedPolygons), MC_NO_ERROR);
+    ASSERT_EQ(dispatch(utest_fixture, MC_DISPATCH_INCLUDE_FACE_MAP), MC_NO_ERROR);
+
+    const std::vector<StitchedPolygon>& stitchedPolygons = utest_fixture->stitchedPolygons;
+    ASSERT_GT(stitchedPolygons.size(), (size_t)0);
+
+    const uint32_t srcMeshFaceCount = (uint32_t)utest_fixture->srcMeshFaceSizes.size();
+    const uint32_t cutMeshFaceCount = (uint32_t)utest_fixture->cutMeshFaceSizes.size();
+    uint32_t numStitchedPolygonsInside = 0;
+    uint32_t numStitchedPolygonsOutside = 0;
+
+    for (std::vector<StitchedPolygon>::const_iterator p = stitchedPolygons.cbegin(); p != stitchedPolygons.cend(); ++p) {
+        ASSERT_TRUE(p->location == MC_PATCH_LOCATION_INSIDE || p->location == MC_PATCH_LOCATION_OUTSIDE);
+        uint32_t& numStitchedPolygons = (p->location == MC_PATCH_LOCATION_INSIDE) ? numStitchedPolygonsInside : numStitchedPolygonsOutside;
+        ASSERT_EQ(p->stitchIndex, numStitchedPolygons); // in stitching order
+        numStitchedPolygons++;
+
+        ASSERT_LT(p->cutMeshFace, cutMeshFaceCount);
+        ASSERT_GE(p->vertexIds.size(), (size_t)3);
+        ASSERT_EQ(p->vertexCoords.size(), p->vertexIds.size() * 3);
+
+        for (std::vector<double>::const_iterator c = p->vertexCoords.cbegin(); c != p->vertexCoords.cend(); ++c) {
+            ASSERT_LE(*c, 20.0); // within the bounds of the cut-mesh
+            ASSERT_GE(*c, -20.0);
+
+            if (p->location == MC_PATCH_LOCATION_INSIDE) { // ... and the cube
+                ASSERT_LE(*c, 5.0);
+                ASSERT_GE(*c, -5.0);
+            }
+        }
+    }
+
+    // the stitched polygons are the cut-mesh faces of the completely sealed fragments
+    uint32_t numConnComps = 0;
+    ASSERT_EQ(mcGetConnectedComponents(utest_fixture->context_, MC_CONNECTED_COMPONENT_TYPE_FRAGMENT, 0, NULL, &numConnComps), MC_NO_ERROR);
+    std::vector<McConnectedComponent> connComps(numConnComps, MC_NULL_HANDLE);
+    ASSERT_EQ(mcGetConnectedComponents(utest_fixture->context_, MC_CONNECTED_COMPONENT_TYPE_FRAGMENT, (uint32_t)connComps.size(), connComps.data(), NULL), MC_NO_ERROR);
+
+    uint32_t numCutMeshFacesInside = 0;
+    uint32_t numCutMeshFacesOutside = 0;
+
+    for (uint32_t i = 0; i < numConnComps; ++i) {
+        McFragmentSealType sealType = (McFragmentSealType)0;
+        ASSERT_EQ(mcGetConnectedComponentData(utest_fixture->context_, connComps[i], MC_CONNECTED_COMPONENT_DATA_FRAGMENT_SEAL_TYPE, sizeof(McFragmentSealType), &sealType, NULL), MC_NO_ERROR);
+
+        if (sealType != MC_FRAGMENT_SEAL_TYPE_COMPLETE) {
+            continue;
+        }
+
+        McPatchLocation location = (McPatchLocation)0;
+        ASSERT_EQ(mcGetConnectedComponentData(utest_fixture->context_, connComps[i], MC_CONNECTED_COMPONENT_DATA_PATCH_LOCATION, sizeof(McPatchLocation), &location, NULL), MC_NO_ERROR);
+
+        uint64_t numBytes = 0;
+        ASSERT_EQ(mcGetConnectedComponentData(utest_fixture->context_, connComps[i], MC_CONNECTED_COMPONENT_DATA_FACE_MAP, 0, NULL, &numBytes), MC_NO_ERROR);
+        std::vector<uint32_t> faceMap(numBytes / sizeof(uint32_t));
+        ASSERT_EQ(mcGetConnectedComponentData(utest_fixture->context_, connComps[i], MC_CONNECTED_COMPONENT_DATA_FACE_MAP, numBytes, faceMap.data(), NULL), MC_NO_ERROR);
+
+        for (std::vector<uint32_t>::const_iterator f = faceMap.cbegin(); f != faceMap.cend(); ++f) {
+            if (*f >= srcMeshFaceCount) {
+                (location == MC_PATCH_LOCATION_INSIDE ? numCutMeshFacesInside : numCutMeshFacesOutside)++;
+            }
+        }
+    }
+
+    ASSERT_EQ(numStitchedPolygonsInside, numCutMeshFacesInside);
+    ASSERT_EQ(numStitchedPolygonsOutside, numCutMeshFacesOutside);
+
+    ASSERT_EQ(mcReleaseConnectedComponents(utest_fixture->context_, 0, NULL), MC_NO_ERROR);
+}
+
+UTEST_F(StitchingCallback, sealingFilterFlags)
+{
+    ASSERT_EQ(mcSetStitchingCallback(utest_fixture->context_, saveStitchedPolygon, &utest_fixture->stitchedPolygons), MC_NO_ERROR);
+    ASSERT_EQ(dispatch(utest_fixture, MC_DISPATCH_FILTER_FRAGMENT_SEALING_INSIDE), MC_NO_ERROR);
+
+    ASSERT_GT(utest_fixture->stitchedPolygons.size(), (size_t)0);
+
+    for (std::vector<StitchedPolygon>::const_iterator p = utest_fixture->stitchedPolygons.cbegin(); p != utest_fixture->stitchedPolygons.cend(); ++p) {
+        ASSERT_EQ(p->location, MC_PATCH_LOCATION_INSIDE);
+    }
+
+    // no stitching
+    utest_fixture->stitchedPolygons.clear();
+    ASSERT_EQ(dispatch(utest_fixture, MC_DISPATCH_FILTER_FRAGMENT_SEALING_NONE), MC_NO_ERROR);
+    ASSERT_EQ(utest_fixture->stitchedPolygons.size(), (size_t)0);
+}
+
+UTEST_F(StitchingCallback, disableCallback)
+{
+    ASSERT_EQ(mcSetStitchingCallback(utest_fixture->context_, saveStitchedPolygon, &utest_fixture->stitchedPolygons), MC_NO_ERROR);
+    ASSERT_EQ(mcSetStitchingCallback(utest_fixture->context_, NULL, NULL), MC_NO_ERROR);
+    ASSERT_EQ(dispatch(utest_fixture, 0), MC_NO_ERROR);
+    ASSERT_EQ(utest_fixture->stitchedPolygons.size(), (size_t)0);
+}